@@ -567,6 +567,7 @@ class SoundTouch(Dependence):
 
         if self.INTERNAL_LINK:
             env.Append(CPPPATH=['#' + self.SOUNDTOUCH_INTERNAL_PATH])
+            env.Append(CPPDEFINES='__SOUNDTOUCH_BUNDLED__')
 
             # Prevents circular import.
             from .features import Optimize
@@ -579,7 +580,10 @@ class SoundTouch(Dependence):
 
 class RubberBand(Dependence):
     def sources(self, build):
-        sources = ['src/engine/bufferscalers/enginebufferscalerubberband.cpp', ]
+        sources = [
+            'src/engine/bufferscalers/enginebufferscalerubberband.cpp',
+            'src/engine/bufferscalers/enginebufferscalerubberbandlookahead.cpp',
+        ]
         return sources
 
     def configure(self, build, conf, env=None):
@@ -862,6 +866,7 @@ class MixxxCore(Feature):
                    "src/engine/engineobject.cpp",
                    "src/engine/enginepregain.cpp",
                    "src/engine/enginemaster.cpp",
+                   "src/engine/enginechannelworkerpool.cpp",
                    "src/engine/enginedelay.cpp",
                    "src/engine/enginevumeter.cpp",
                    "src/engine/enginesidechaincompressor.cpp",
@@ -870,6 +875,8 @@ class MixxxCore(Feature):
                    "src/engine/sidechain/networkinputstreamworker.cpp",
                    "src/engine/enginexfader.cpp",
                    "src/engine/channelmixer_autogen.cpp",
+                   "src/engine/channelmixer.cpp",
+                   "src/engine/channelmixer_kernels_autogen.cpp",
                    "src/engine/positionscratchcontroller.cpp",
                    "src/engine/controls/bpmcontrol.cpp",
                    "src/engine/controls/clockcontrol.cpp",
@@ -887,12 +894,15 @@ class MixxxCore(Feature):
 
                    "src/analyzer/trackanalysisscheduler.cpp",
                    "src/analyzer/analyzerthread.cpp",
+                   "src/analyzer/analyzerfanout.cpp",
                    "src/analyzer/analyzerwaveform.cpp",
                    "src/analyzer/analyzergain.cpp",
                    "src/analyzer/analyzerbeats.cpp",
+                   "src/analyzer/analyzerdecodedaudiocache.cpp",
                    "src/analyzer/analyzerkey.cpp",
                    "src/analyzer/analyzerebur128.cpp",
                    "src/analyzer/analyzersilence.cpp",
+                   "src/analyzer/headlessanalysis.cpp",
                    "src/analyzer/plugins/analyzersoundtouchbeats.cpp",
                    "src/analyzer/plugins/analyzerqueenmarybeats.cpp",
                    "src/analyzer/plugins/analyzerqueenmarykey.cpp",
@@ -904,6 +914,7 @@ class MixxxCore(Feature):
                    "src/controllers/controllerenumerator.cpp",
                    "src/controllers/controllerlearningeventfilter.cpp",
                    "src/controllers/controllermanager.cpp",
+                   "src/controllers/controlleroutputscheduler.cpp",
                    "src/controllers/controllerpresetfilehandler.cpp",
                    "src/controllers/controllerpresetinfo.cpp",
                    "src/controllers/controllerpresetinfoenumerator.cpp",
@@ -934,6 +945,7 @@ class MixxxCore(Feature):
 
                    "src/sources/audiosource.cpp",
                    "src/sources/audiosourcestereoproxy.cpp",
+                   "src/sources/decodedaudiocache.cpp",
                    "src/sources/metadatasourcetaglib.cpp",
                    "src/sources/soundsource.cpp",
                    "src/sources/soundsourceproviderregistry.cpp",
@@ -1018,6 +1030,8 @@ class MixxxCore(Feature):
 
                    "src/library/trackcollection.cpp",
                    "src/library/trackcollectionmanager.cpp",
+                   "src/library/trackcolumnstore.cpp",
+                   "src/library/tracktrigramindex.cpp",
                    "src/library/externaltrackcollection.cpp",
                    "src/library/basesqltablemodel.cpp",
                    "src/library/basetrackcache.cpp",
@@ -1098,6 +1112,7 @@ class MixxxCore(Feature):
                    "src/library/scanner/scannertask.cpp",
                    "src/library/scanner/importfilestask.cpp",
                    "src/library/scanner/recursivescandirectorytask.cpp",
+                   "src/library/scanner/scannerjournal.cpp",
 
                    "src/library/dao/cuedao.cpp",
                    "src/library/dao/trackdao.cpp",
@@ -1137,6 +1152,7 @@ class MixxxCore(Feature):
                    "src/waveform/sharedglcontext.cpp",
                    "src/waveform/waveform.cpp",
                    "src/waveform/waveformfactory.cpp",
+                   "src/waveform/waveformpyramid.cpp",
                    "src/waveform/waveformwidgetfactory.cpp",
                    "src/waveform/vsyncthread.cpp",
                    "src/waveform/guitick.cpp",
@@ -1256,12 +1272,15 @@ class MixxxCore(Feature):
                    "src/encoder/encodervorbissettings.cpp",
                    "src/encoder/encoderwave.cpp",
                    "src/encoder/encoderwavesettings.cpp",
+                   "src/encoder/sharedencoder.cpp",
                    'src/encoder/encoderopussettings.cpp',
 
                    "src/util/sleepableqthread.cpp",
                    "src/util/statsmanager.cpp",
                    "src/util/stat.cpp",
                    "src/util/statmodel.cpp",
+                   "src/util/stattimeline.cpp",
+                   "src/util/streamingquantile.cpp",
                    "src/util/dnd.cpp",
                    "src/util/duration.cpp",
                    "src/util/time.cpp",
@@ -1281,6 +1300,7 @@ class MixxxCore(Feature):
                    "src/util/tapfilter.cpp",
                    "src/util/movinginterquartilemean.cpp",
                    "src/util/cache.cpp",
+                   "src/util/callbacktrace.cpp",
                    "src/util/console.cpp",
                    "src/util/color/color.cpp",
                    "src/util/db/dbconnection.cpp",
@@ -295,6 +295,7 @@ class VinylControl(Feature):
                    'src/vinylcontrol/vinylcontrolxwax.cpp',
                    'src/preferences/dialog/dlgprefvinyl.cpp',
                    'src/vinylcontrol/vinylcontrolsignalwidget.cpp',
+                   'src/vinylcontrol/vinylcontroldecoder.cpp',
                    'src/vinylcontrol/vinylcontrolmanager.cpp',
                    'src/vinylcontrol/vinylcontrolprocessor.cpp',
                    'src/vinylcontrol/steadypitch.cpp',
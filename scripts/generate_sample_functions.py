@@ -7,9 +7,14 @@ import sys
 #     --sample_autogen_h src/util/sample_autogen.h
 #     --channelmixer_autogen_cpp
 #     src/engine/channelmixer_autogen.cpp
+#     --channelmixer_kernels_autogen_cpp
+#     src/engine/channelmixer_kernels_autogen.cpp
 
 BASIC_INDENT = 4
 
+# Must match ChannelMixerKernels::kMaxUnrolledChannels.
+MAX_UNROLLED_MIX_CHANNELS = 8
+
 COPY_WITH_GAIN_METHOD_PATTERN = "copy%(i)dWithGain"
 
 
@@ -81,23 +86,24 @@ def write_channelmixer_autogen(output, num_channels):
             write("// Signal flow overview:", depth=1)
             write("// 1. Calculate gains for each channel", depth=1)
             write(
-                "// 2. Pass each channel's calculated gain and input buffer "
-                "to pEngineEffectsManager, which then:",
+                "// 2. Apply the calculated gain to the channel buffer, "
+                "modifying the original input buffer",
                 depth=1,
             )
             write(
-                "//    A) Applies the calculated gain to the channel buffer, "
+                "// 3. Pass each channel's input buffer to "
+                "pEngineEffectsManager, which applies effects to the buffer, "
                 "modifying the original input buffer",
                 depth=1,
             )
             write(
-                "//    B) Applies effects to the buffer, modifying the "
-                "original input buffer",
+                "// 4. Mix the channel buffers together to make pOutput, "
+                "overwriting the pOutput buffer from the last engine callback",
                 depth=1,
             )
             write(
-                "// 4. Mix the channel buffers together to make pOutput, "
-                "overwriting the pOutput buffer from the last engine callback",
+                "// Steps 2 and 4 use the ChannelMixerKernels selected for "
+                "this CPU.",
                 depth=1,
             )
         else:
@@ -197,7 +203,11 @@ def write_channelmixer_autogen(output, num_channels):
                 )
 
             if inplace:
-                write("// Process effects for each channel in place", depth=2)
+                write(
+                    "// Apply gain and process effects for each channel in "
+                    "place",
+                    depth=2,
+                )
             else:
                 write(
                     "// Process effects for each channel and mix the "
@@ -206,13 +216,20 @@ def write_channelmixer_autogen(output, num_channels):
                 )
             for j in range(i):
                 if inplace:
+                    write(
+                        (
+                            "ChannelMixer::applyRampingGain(pBuffer%(j)d, "
+                            "oldGain[%(j)d], newGain[%(j)d], iBufferSize);"
+                        )
+                        % {"j": j},
+                        depth=2,
+                    )
                     write(
                         (
                             "pEngineEffectsManager->processPostFaderInPlace("
                             "pChannel%(j)d->m_handle, outputHandle, "
                             "pBuffer%(j)d, iBufferSize, iSampleRate, "
-                            "pChannel%(j)d->m_features, oldGain[%(j)d], "
-                            "newGain[%(j)d]);"
+                            "pChannel%(j)d->m_features);"
                         )
                         % {"j": j},
                         depth=2,
@@ -237,14 +254,20 @@ def write_channelmixer_autogen(output, num_channels):
                     depth=2,
                 )
                 write(
-                    "for (unsigned int i = 0; i < iBufferSize; ++i) {", depth=2
+                    "const CSAMPLE* pBuffers[%(i)d] = {%(buffers)s};"
+                    % {
+                        "i": i,
+                        "buffers": ", ".join(
+                            "pBuffer%(k)d" % {"k": k} for k in range(i)
+                        ),
+                    },
+                    depth=2,
+                )
+                write(
+                    "ChannelMixer::mixChannelBuffers("
+                    "pOutput, pBuffers, %(i)d, iBufferSize);" % {"i": i},
+                    depth=2,
                 )
-                line = "pOutput[i] = pBuffer0[i]"
-                for k in range(1, i):
-                    line += " + pBuffer%(k)d[i]" % {"k": k}
-                line += ";"
-                write(line, depth=3)
-                write("}", depth=2)
 
         write("} else {", depth=1)
         write(
@@ -281,11 +304,15 @@ def write_channelmixer_autogen(output, num_channels):
 
         write("CSAMPLE* pBuffer = pChannelInfo->m_pBuffer;", depth=3)
         if inplace:
+            write(
+                "ChannelMixer::applyRampingGain("
+                "pBuffer, oldGain, newGain, iBufferSize);",
+                depth=3,
+            )
             write(
                 "pEngineEffectsManager->processPostFaderInPlace("
                 "pChannelInfo->m_handle, outputHandle, pBuffer, iBufferSize, "
-                "iSampleRate, pChannelInfo->m_features, oldGain, newGain);"
-                % {"j": j},
+                "iSampleRate, pChannelInfo->m_features);",
                 depth=3,
             )
             write("SampleUtil::add(pOutput, pBuffer, iBufferSize);", depth=3)
@@ -306,6 +333,324 @@ def write_channelmixer_autogen(output, num_channels):
     write_applyeffectsandmixchannels(True, output)
 
 
+KERNEL_ISAS = [
+    {
+        "suffix": "Scalar",
+        "member": "kScalar",
+        "name": "Scalar",
+        "guard": None,
+    },
+    {
+        "suffix": "SSE2",
+        "member": "kSSE2",
+        "name": "SSE2",
+        "guard": "MIXXX_CHANNELMIXER_X86",
+        "target": "MIXXX_TARGET_SSE2",
+        "width": 4,
+        "vector": "__m128",
+        "load": "_mm_loadu_ps(%s)",
+        "store": "_mm_storeu_ps(%s, %s);",
+        "add": "_mm_add_ps(%s, %s)",
+        "mul": "_mm_mul_ps(%s, %s)",
+        "set1": "_mm_set1_ps(%s)",
+        "frame_offsets": "_mm_set_ps(1.0f, 1.0f, 0.0f, 0.0f)",
+    },
+    {
+        "suffix": "AVX2",
+        "member": "kAVX2",
+        "name": "AVX2",
+        "guard": "MIXXX_CHANNELMIXER_X86",
+        "target": "MIXXX_TARGET_AVX2",
+        "width": 8,
+        "vector": "__m256",
+        "load": "_mm256_loadu_ps(%s)",
+        "store": "_mm256_storeu_ps(%s, %s);",
+        "add": "_mm256_add_ps(%s, %s)",
+        "mul": "_mm256_mul_ps(%s, %s)",
+        "set1": "_mm256_set1_ps(%s)",
+        "frame_offsets": (
+            "_mm256_set_ps(3.0f, 3.0f, 2.0f, 2.0f, 1.0f, 1.0f, 0.0f, 0.0f)"
+        ),
+    },
+    {
+        "suffix": "NEON",
+        "member": "kNEON",
+        "name": "NEON",
+        "guard": "MIXXX_CHANNELMIXER_NEON",
+        "target": "",
+        "width": 4,
+        "vector": "float32x4_t",
+        "load": "vld1q_f32(%s)",
+        "store": "vst1q_f32(%s, %s);",
+        "add": "vaddq_f32(%s, %s)",
+        "mul": "vmulq_f32(%s, %s)",
+        "set1": "vdupq_n_f32(%s)",
+        "frame_offsets": "vld1q_f32(kNeonFrameOffsets)",
+    },
+]
+
+
+def kernel_header(isa, name, args):
+    target = isa.get("target")
+    prefix = "static %svoid %s(" % (target + " " if target else "", name)
+    return hanging_indent(prefix, args, ",", ") {")
+
+
+def write_mix_kernel(output, isa, num_channels, accumulate):
+    def write(data, depth=0):
+        output.append(" " * (BASIC_INDENT * depth) + data)
+
+    name = "%sMix%d%s" % (
+        "add" if accumulate else "copy",
+        num_channels,
+        isa["suffix"],
+    )
+    output.extend(
+        kernel_header(
+            isa,
+            name,
+            [
+                "CSAMPLE* M_RESTRICT pDest",
+                "const CSAMPLE* const* ppSrc",
+                "int iNumSamples",
+            ],
+        )
+    )
+    for j in range(num_channels):
+        write(
+            "const CSAMPLE* M_RESTRICT pSrc%(j)d = ppSrc[%(j)d];" % {"j": j},
+            depth=1,
+        )
+    terms = ["pSrc%(j)d[i]" % {"j": j} for j in range(num_channels)]
+    if accumulate:
+        terms = ["pDest[i]"] + terms
+    scalar_sum = "pDest[i] = %s;" % " + ".join(terms)
+
+    if isa["guard"] is None:
+        write("// note: LOOP VECTORIZED.", depth=1)
+        write("for (int i = 0; i < iNumSamples; ++i) {", depth=1)
+        write(scalar_sum, depth=2)
+        write("}", depth=1)
+        write("}")
+        return
+
+    width = isa["width"]
+    write("int i = 0;", depth=1)
+    write(
+        "for (; i + %(w)d <= iNumSamples; i += %(w)d) {" % {"w": width},
+        depth=1,
+    )
+    sources = ["pSrc%(j)d + i" % {"j": j} for j in range(num_channels)]
+    if accumulate:
+        sources = ["pDest + i"] + sources
+    write(
+        "%s sum = %s;" % (isa["vector"], isa["load"] % sources[0]), depth=2
+    )
+    for source in sources[1:]:
+        write(
+            "sum = %s;" % (isa["add"] % ("sum", isa["load"] % source)),
+            depth=2,
+        )
+    write(isa["store"] % ("pDest + i", "sum"), depth=2)
+    write("}", depth=1)
+    write("for (; i < iNumSamples; ++i) {", depth=1)
+    write(scalar_sum, depth=2)
+    write("}", depth=1)
+    write("}")
+
+
+def write_gain_kernels(output, isa):
+    def write(data, depth=0):
+        output.append(" " * (BASIC_INDENT * depth) + data)
+
+    suffix = isa["suffix"]
+    vector_isa = isa["guard"] is not None
+
+    output.extend(
+        kernel_header(
+            isa,
+            "applyRampingGain%s" % suffix,
+            [
+                "CSAMPLE* pBuffer",
+                "CSAMPLE_GAIN gainIn",
+                "CSAMPLE_GAIN gainOut",
+                "int iNumSamples",
+            ],
+        )
+    )
+    write("const int iNumFrames = iNumSamples / 2;", depth=1)
+    write(
+        "const CSAMPLE_GAIN gainDelta = "
+        "(gainOut - gainIn) / CSAMPLE_GAIN(iNumFrames);",
+        depth=1,
+    )
+    write("const CSAMPLE_GAIN startGain = gainIn + gainDelta;", depth=1)
+    if vector_isa:
+        frames_per_vector = isa["width"] // 2
+        vector = isa["vector"]
+        write(
+            "const %s vStartGain = %s;"
+            % (vector, isa["set1"] % "startGain"),
+            depth=1,
+        )
+        write(
+            "const %s vGainDelta = %s;"
+            % (vector, isa["set1"] % "gainDelta"),
+            depth=1,
+        )
+        write(
+            "const %s vFrameStep = %s;"
+            % (vector, isa["set1"] % ("%d.0f" % frames_per_vector)),
+            depth=1,
+        )
+        write(
+            "// The frame index of each sample in the vector, both samples "
+            "of a stereo frame share the same gain.",
+            depth=1,
+        )
+        write(
+            "%s vFrameIndex = %s;" % (vector, isa["frame_offsets"]), depth=1
+        )
+        write("int frame = 0;", depth=1)
+        write(
+            "for (; frame + %(f)d <= iNumFrames; frame += %(f)d) {"
+            % {"f": frames_per_vector},
+            depth=1,
+        )
+        write(
+            "const %s vGain = %s;"
+            % (
+                vector,
+                isa["add"]
+                % ("vStartGain", isa["mul"] % ("vGainDelta", "vFrameIndex")),
+            ),
+            depth=2,
+        )
+        write(
+            isa["store"]
+            % (
+                "pBuffer + frame * 2",
+                isa["mul"] % (isa["load"] % "pBuffer + frame * 2", "vGain"),
+            ),
+            depth=2,
+        )
+        write(
+            "vFrameIndex = %s;" % (isa["add"] % ("vFrameIndex", "vFrameStep")),
+            depth=2,
+        )
+        write("}", depth=1)
+        write("for (; frame < iNumFrames; ++frame) {", depth=1)
+    else:
+        write("// note: LOOP VECTORIZED.", depth=1)
+        write("for (int frame = 0; frame < iNumFrames; ++frame) {", depth=1)
+    write(
+        "const CSAMPLE_GAIN gain = startGain + gainDelta * frame;", depth=2
+    )
+    write("pBuffer[frame * 2] *= gain;", depth=2)
+    write("pBuffer[frame * 2 + 1] *= gain;", depth=2)
+    write("}", depth=1)
+    write("}")
+    output.append("")
+
+    output.extend(
+        kernel_header(
+            isa,
+            "applyGain%s" % suffix,
+            ["CSAMPLE* pBuffer", "CSAMPLE_GAIN gain", "int iNumSamples"],
+        )
+    )
+    if vector_isa:
+        width = isa["width"]
+        write(
+            "const %s vGain = %s;" % (isa["vector"], isa["set1"] % "gain"),
+            depth=1,
+        )
+        write("int i = 0;", depth=1)
+        write(
+            "for (; i + %(w)d <= iNumSamples; i += %(w)d) {" % {"w": width},
+            depth=1,
+        )
+        scaled = isa["mul"] % (isa["load"] % "pBuffer + i", "vGain")
+        write(isa["store"] % ("pBuffer + i", scaled), depth=2)
+        write("}", depth=1)
+        write("for (; i < iNumSamples; ++i) {", depth=1)
+    else:
+        write("// note: LOOP VECTORIZED.", depth=1)
+        write("for (int i = 0; i < iNumSamples; ++i) {", depth=1)
+    write("pBuffer[i] *= gain;", depth=2)
+    write("}", depth=1)
+    write("}")
+
+
+def write_kernel_table(output, isa, max_channels):
+    def write(data, depth=0):
+        output.append(" " * (BASIC_INDENT * depth) + data)
+
+    suffix = isa["suffix"]
+    write("// static")
+    write(
+        "const ChannelMixerKernels ChannelMixerKernels::%s = {"
+        % isa["member"]
+    )
+    write('"%s",' % isa["name"], depth=1)
+    for kind in ["copy", "add"]:
+        names = ["nullptr"] + [
+            "%sMix%d%s" % (kind, n, suffix) for n in range(1, max_channels + 1)
+        ]
+        output.extend(hanging_indent("{", names, ",", "},", depth=1))
+    write("applyRampingGain%s," % suffix, depth=1)
+    write("applyGain%s," % suffix, depth=1)
+    write("};")
+
+
+def write_channelmixer_kernels_autogen(output, max_channels):
+    output.append('#include "engine/channelmixerkernels.h"')
+    output.append("")
+    output.append("#ifdef MIXXX_CHANNELMIXER_X86")
+    output.append("#include <immintrin.h>")
+    output.append("#if defined(__GNUC__)")
+    output.append(
+        "// Allows using the intrinsics without compiling the whole file for "
+        "the target."
+    )
+    output.append('#define MIXXX_TARGET_SSE2 __attribute__((target("sse2")))')
+    output.append('#define MIXXX_TARGET_AVX2 __attribute__((target("avx2")))')
+    output.append("#else")
+    output.append("#define MIXXX_TARGET_SSE2")
+    output.append("#define MIXXX_TARGET_AVX2")
+    output.append("#endif")
+    output.append("#endif")
+    output.append("")
+    output.append("#ifdef MIXXX_CHANNELMIXER_NEON")
+    output.append("#include <arm_neon.h>")
+    output.append("#endif")
+    output.append("")
+    output.append("////////////////////////////////////////////////////////")
+    output.append("// THIS FILE IS AUTO-GENERATED. DO NOT EDIT DIRECTLY! //")
+    output.append("// SEE scripts/generate_sample_functions.py           //")
+    output.append("////////////////////////////////////////////////////////")
+
+    for isa in KERNEL_ISAS:
+        output.append("")
+        if isa["guard"]:
+            output.append("#ifdef %s" % isa["guard"])
+        if isa["suffix"] == "NEON":
+            output.append(
+                "static const float kNeonFrameOffsets[4] = "
+                "{0.0f, 0.0f, 1.0f, 1.0f};"
+            )
+            output.append("")
+        for accumulate in [False, True]:
+            for n in range(1, max_channels + 1):
+                write_mix_kernel(output, isa, n, accumulate)
+                output.append("")
+        write_gain_kernels(output, isa)
+        output.append("")
+        write_kernel_table(output, isa, max_channels)
+        if isa["guard"]:
+            output.append("#endif // %s" % isa["guard"])
+
+
 def write_sample_autogen(output, num_channels):
     output.append("#ifndef MIXXX_UTIL_SAMPLEAUTOGEN_H")
     output.append("#define MIXXX_UTIL_SAMPLEAUTOGEN_H")
@@ -505,6 +850,18 @@ def main(args):
     )
     output.write("\n".join(channelmixer_output_lines) + "\n")
 
+    kernels_output_lines = []
+    write_channelmixer_kernels_autogen(
+        kernels_output_lines, MAX_UNROLLED_MIX_CHANNELS
+    )
+
+    output = (
+        open(args.channelmixer_kernels_autogen_cpp, "w")
+        if args.channelmixer_kernels_autogen_cpp
+        else sys.stdout
+    )
+    output.write("\n".join(kernels_output_lines) + "\n")
+
 
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(
@@ -513,11 +870,14 @@ if __name__ == "__main__":
             "Example Call:"
             "./generate_sample_functions.py --sample_autogen_h "
             "../src/util/sample_autogen.h --channelmixer_autogen_cpp "
-            "../src/engine/channelmixer_autogen.cpp"
+            "../src/engine/channelmixer_autogen.cpp "
+            "--channelmixer_kernels_autogen_cpp "
+            "../src/engine/channelmixer_kernels_autogen.cpp"
         ),
     )
     parser.add_argument("--sample_autogen_h")
     parser.add_argument("--channelmixer_autogen_cpp")
+    parser.add_argument("--channelmixer_kernels_autogen_cpp")
     parser.add_argument("--max_channels", type=int, default=32)
     args = parser.parse_args()
     main(args)
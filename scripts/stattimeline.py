@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Converts a timeline written by mixxx --timelinePath into CSV.
+
+The binary format is described in src/util/stattimeline.h. Each line of the
+output contains the time of an event in nanoseconds since Mixxx startup, the
+time since the previous event, the time since the last start and end of the
+same tag, the event type and the tag.
+"""
+import argparse
+import csv
+import struct
+import sys
+
+MAGIC = b"MIXXXTL1"
+TAG_RECORD = 1
+EVENT_RECORD = 2
+EVENT_TYPES = {
+    5: "EVENT",
+    6: "START",
+    7: "END",
+}
+
+
+def read_timeline(data):
+    """returns the tags and the events of a timeline, sorted by time"""
+    if not data.startswith(MAGIC):
+        raise ValueError("not a Mixxx timeline file")
+    tags = {}
+    events = []
+    offset = len(MAGIC)
+    while offset < len(data):
+        kind = data[offset]
+        offset += 1
+        if kind == TAG_RECORD:
+            tag_id, length = struct.unpack_from("<IH", data, offset)
+            offset += 6
+            tags[tag_id] = data[offset:offset + length].decode("utf-8")
+            offset += length
+        elif kind == EVENT_RECORD:
+            event_type, tag_id, time = struct.unpack_from("<BIq", data, offset)
+            offset += 13
+            events.append((time, tag_id, event_type))
+        else:
+            raise ValueError("unknown record {} at {}".format(kind, offset - 1))
+    events.sort(key=lambda event: event[0])
+    return tags, events
+
+
+def humanize_nanos(nanos):
+    for divisor, unit in ((1e9, "s"), (1e6, "ms"), (1e3, "us")):
+        if nanos / divisor > 1:
+            return "{:g}{}".format(nanos / divisor, unit)
+    return "{}ns".format(nanos)
+
+
+def write_csv(tags, events, output):
+    writer = csv.writer(output)
+    last_time = events[0][0] if events else 0
+    start_times = {}
+    end_times = {}
+    for time, tag_id, event_type in events:
+        last_start = start_times.get(tag_id)
+        last_end = end_times.get(tag_id)
+        tag = tags.get(tag_id, str(tag_id))
+        type_name = EVENT_TYPES.get(event_type, "UNKNOWN")
+        if event_type == 6:
+            if last_start is not None and (last_end is None or
+                                           last_start > last_end):
+                print("Mismatched start/end pair", tag, file=sys.stderr)
+            start_times[tag_id] = time
+        elif event_type == 7:
+            if last_end is not None and (last_start is None or
+                                         last_end > last_start):
+                print("Mismatched start/end pair", tag, file=sys.stderr)
+            end_times[tag_id] = time
+        writer.writerow([
+            time,
+            "+" + humanize_nanos(time - last_time),
+            "+" + humanize_nanos(0 if last_start is None else time - last_start),
+            "+" + humanize_nanos(0 if last_end is None else time - last_end),
+            type_name,
+            tag,
+        ])
+        last_time = time
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("timeline", help="file written by --timelinePath")
+    parser.add_argument("output", nargs="?", help="CSV file, default: stdout")
+    args = parser.parse_args()
+
+    with open(args.timeline, "rb") as timeline:
+        tags, events = read_timeline(timeline.read())
+    if args.output:
+        with open(args.output, "w", newline="") as output:
+            write_csv(tags, events, output)
+    else:
+        write_csv(tags, events, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,50 @@
+#include "analyzer/analyzerdecodedaudiocache.h"
+
+#include "analyzer/constants.h"
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("AnalyzerDecodedAudioCache");
+
+} // anonymous namespace
+
+AnalyzerDecodedAudioCache::AnalyzerDecodedAudioCache(UserSettingsPointer pConfig)
+        : m_cache(pConfig) {
+    // The cache stores the signal in the format that is read by the engine
+    static_assert(mixxx::kAnalysisChannels == 2,
+            "The decoded audio cache only stores stereo signals");
+}
+
+bool AnalyzerDecodedAudioCache::initialize(TrackPointer pTrack,
+        int sampleRate,
+        int totalSamples) {
+    if (totalSamples == 0 || m_cache.contains(pTrack->getFileInfo())) {
+        return false;
+    }
+    m_pWriter = m_cache.createWriter(
+            pTrack->getFileInfo(),
+            mixxx::AudioSignal::SampleRate(sampleRate));
+    return m_pWriter != nullptr;
+}
+
+bool AnalyzerDecodedAudioCache::processSamples(const CSAMPLE* pIn, const int iLen) {
+    DEBUG_ASSERT(m_pWriter);
+    return m_pWriter->writeSamples(pIn, iLen);
+}
+
+void AnalyzerDecodedAudioCache::storeResults(TrackPointer pTrack) {
+    DEBUG_ASSERT(m_pWriter);
+    if (!m_pWriter->commit()) {
+        kLogger.warning()
+                << "Failed to cache decoded audio data of"
+                << pTrack->getLocation();
+        return;
+    }
+    m_cache.evictLeastRecentlyUsed();
+}
+
+void AnalyzerDecodedAudioCache::cleanup() {
+    // Uncommitted entries are discarded
+    m_pWriter.reset();
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "analyzer/analyzer.h"
+#include "preferences/usersettings.h"
+#include "sources/decodedaudiocache.h"
+
+// Fills the DecodedAudioCache with the decoded audio data that passes
+// through the analyzer pipeline anyway. Tracks that are already cached
+// are skipped.
+class AnalyzerDecodedAudioCache : public Analyzer {
+  public:
+    explicit AnalyzerDecodedAudioCache(UserSettingsPointer pConfig);
+    ~AnalyzerDecodedAudioCache() override = default;
+
+    static bool isEnabled(UserSettingsPointer pConfig) {
+        return mixxx::DecodedAudioCache::isEnabled(pConfig);
+    }
+
+    bool initialize(TrackPointer pTrack, int sampleRate, int totalSamples) override;
+    bool processSamples(const CSAMPLE* pIn, const int iLen) override;
+    void storeResults(TrackPointer pTrack) override;
+    void cleanup() override;
+
+  private:
+    const mixxx::DecodedAudioCache m_cache;
+    std::unique_ptr<mixxx::DecodedAudioCache::Writer> m_pWriter;
+};
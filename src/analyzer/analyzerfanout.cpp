@@ -0,0 +1,120 @@
+#include "analyzer/analyzerfanout.h"
+
+#include <algorithm>
+
+#include "util/assert.h"
+#include "util/sample.h"
+
+AnalyzerFanOut::Lane::Lane(AnalyzerFanOut* pFanOut, int laneIndex)
+        : m_pFanOut(pFanOut),
+          m_laneIndex(laneIndex) {
+}
+
+void AnalyzerFanOut::Lane::run() {
+    setObjectName(QString("AnalyzerLane %1").arg(m_laneIndex));
+
+    std::unique_lock<std::mutex> locked(m_pFanOut->m_mutex);
+    quint64& processedBlocks = m_pFanOut->m_processedBlocks[m_laneIndex];
+    while (true) {
+        m_pFanOut->m_blockPublished.wait(locked, [this, &processedBlocks] {
+            return m_pFanOut->m_quit ||
+                    processedBlocks < m_pFanOut->m_publishedBlocks;
+        });
+        if (m_pFanOut->m_quit) {
+            return;
+        }
+        std::vector<AnalyzerWithState>* pAnalyzers = m_pFanOut->m_pAnalyzers;
+        const Block& block = m_pFanOut->m_blocks[
+                processedBlocks % m_pFanOut->m_blocks.size()];
+        locked.unlock();
+
+        // The block is not modified until all lanes have processed it
+        DEBUG_ASSERT(pAnalyzers);
+        const int numLanes = m_pFanOut->numLanes();
+        for (size_t i = m_laneIndex; i < pAnalyzers->size(); i += numLanes) {
+            (*pAnalyzers)[i].processSamples(
+                    block.buffer.data(),
+                    block.sampleCount);
+        }
+
+        locked.lock();
+        ++processedBlocks;
+        m_pFanOut->m_blockProcessed.notify_all();
+    }
+}
+
+AnalyzerFanOut::AnalyzerFanOut(int numLanes, SINT blockSize, int numBlocks)
+        : m_pAnalyzers(nullptr),
+          m_publishedBlocks(0),
+          m_processedBlocks(numLanes, 0),
+          m_quit(false) {
+    DEBUG_ASSERT(numLanes > 0);
+    DEBUG_ASSERT(numBlocks > 0);
+    m_blocks.reserve(numBlocks);
+    for (int i = 0; i < numBlocks; ++i) {
+        m_blocks.emplace_back(blockSize);
+    }
+    m_lanes.reserve(numLanes);
+    for (int i = 0; i < numLanes; ++i) {
+        m_lanes.push_back(std::make_unique<Lane>(this, i));
+    }
+    for (const auto& pLane : m_lanes) {
+        // Same priority as the analyzer threads
+        pLane->start(QThread::LowPriority);
+    }
+}
+
+AnalyzerFanOut::~AnalyzerFanOut() {
+    {
+        std::lock_guard<std::mutex> locked(m_mutex);
+        m_quit = true;
+    }
+    m_blockPublished.notify_all();
+    for (const auto& pLane : m_lanes) {
+        pLane->wait();
+    }
+}
+
+quint64 AnalyzerFanOut::minProcessedBlocks() const {
+    return *std::min_element(m_processedBlocks.begin(), m_processedBlocks.end());
+}
+
+void AnalyzerFanOut::begin(std::vector<AnalyzerWithState>* pAnalyzers) {
+    std::lock_guard<std::mutex> locked(m_mutex);
+    DEBUG_ASSERT(minProcessedBlocks() == m_publishedBlocks);
+    m_pAnalyzers = pAnalyzers;
+}
+
+mixxx::SampleBuffer::WritableSlice AnalyzerFanOut::nextWritableBlock() {
+    std::unique_lock<std::mutex> locked(m_mutex);
+    m_blockProcessed.wait(locked, [this] {
+        return m_publishedBlocks - minProcessedBlocks() < m_blocks.size();
+    });
+    return mixxx::SampleBuffer::WritableSlice(
+            m_blocks[m_publishedBlocks % m_blocks.size()].buffer);
+}
+
+void AnalyzerFanOut::publishBlock(const CSAMPLE* pSamples, SINT sampleCount) {
+    const mixxx::SampleBuffer::WritableSlice writableBlock = nextWritableBlock();
+    VERIFY_OR_DEBUG_ASSERT(sampleCount <= writableBlock.length()) {
+        sampleCount = writableBlock.length();
+    }
+    if (pSamples != writableBlock.data()) {
+        SampleUtil::copy(writableBlock.data(), pSamples, sampleCount);
+    }
+    {
+        std::lock_guard<std::mutex> locked(m_mutex);
+        DEBUG_ASSERT(m_pAnalyzers);
+        m_blocks[m_publishedBlocks % m_blocks.size()].sampleCount = sampleCount;
+        ++m_publishedBlocks;
+    }
+    m_blockPublished.notify_all();
+}
+
+void AnalyzerFanOut::waitUntilProcessed() {
+    std::unique_lock<std::mutex> locked(m_mutex);
+    m_blockProcessed.wait(locked, [this] {
+        return minProcessedBlocks() == m_publishedBlocks;
+    });
+    m_pAnalyzers = nullptr;
+}
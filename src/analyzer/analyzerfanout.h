@@ -0,0 +1,87 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <QThread>
+
+#include "analyzer/analyzer.h"
+#include "util/memory.h"
+#include "util/samplebuffer.h"
+
+// Runs the analyzers of a single track concurrently. The thread that
+// decodes the track writes blocks of samples into a small ring of
+// buffers, which are then processed by all analyzers in parallel on
+// dedicated lane threads. The analyzers are distributed among the lanes
+// and each lane processes the blocks in order. A buffer is only reused
+// after all lanes have finished processing it, so the analyzers can read
+// the shared samples without copying.
+//
+// All functions must be invoked from the same (decoding) thread.
+class AnalyzerFanOut {
+  public:
+    AnalyzerFanOut(int numLanes, SINT blockSize, int numBlocks = 4);
+    ~AnalyzerFanOut();
+
+    int numLanes() const {
+        return static_cast<int>(m_lanes.size());
+    }
+
+    // Starts processing blocks with the given analyzers. The analyzers
+    // must not be accessed until waitUntilProcessed() has returned.
+    void begin(std::vector<AnalyzerWithState>* pAnalyzers);
+
+    // Returns the buffer for the next block. Blocks while the ring is
+    // full. The same buffer is returned again until publishBlock() is
+    // invoked.
+    mixxx::SampleBuffer::WritableSlice nextWritableBlock();
+
+    // Hands the next block over to the analyzers. The samples are
+    // copied into the ring if they have not been written into the
+    // buffer returned by nextWritableBlock().
+    void publishBlock(const CSAMPLE* pSamples, SINT sampleCount);
+
+    // Blocks until all published blocks have been processed by all
+    // analyzers.
+    void waitUntilProcessed();
+
+  private:
+    class Lane : public QThread {
+      public:
+        Lane(AnalyzerFanOut* pFanOut, int laneIndex);
+
+      protected:
+        void run() override;
+
+      private:
+        AnalyzerFanOut* const m_pFanOut;
+        const int m_laneIndex;
+    };
+
+    struct Block {
+        explicit Block(SINT capacity)
+                : buffer(capacity),
+                  sampleCount(0) {
+        }
+        mixxx::SampleBuffer buffer;
+        SINT sampleCount;
+    };
+
+    // The number of blocks that have been processed by all lanes.
+    // Needs to be invoked while holding m_mutex.
+    quint64 minProcessedBlocks() const;
+
+    std::vector<std::unique_ptr<Lane>> m_lanes;
+    std::vector<Block> m_blocks;
+
+    std::mutex m_mutex;
+    std::condition_variable m_blockPublished;
+    std::condition_variable m_blockProcessed;
+
+    // All following members are protected by m_mutex
+    std::vector<AnalyzerWithState>* m_pAnalyzers;
+    quint64 m_publishedBlocks;
+    std::vector<quint64> m_processedBlocks;
+    bool m_quit;
+};
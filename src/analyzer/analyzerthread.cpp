@@ -3,6 +3,7 @@
 #include <mutex>
 
 #include "analyzer/analyzerbeats.h"
+#include "analyzer/analyzerdecodedaudiocache.h"
 #include "analyzer/analyzerebur128.h"
 #include "analyzer/analyzergain.h"
 #include "analyzer/analyzerkey.h"
@@ -64,12 +65,14 @@ AnalyzerThread::Pointer AnalyzerThread::createInstance(
         int id,
         mixxx::DbConnectionPoolPtr dbConnectionPool,
         UserSettingsPointer pConfig,
-        AnalyzerModeFlags modeFlags) {
+        AnalyzerModeFlags modeFlags,
+        int maxAnalyzerLanes) {
     return Pointer(new AnalyzerThread(
                            id,
                            dbConnectionPool,
                            pConfig,
-                           modeFlags),
+                           modeFlags,
+                           maxAnalyzerLanes),
             deleteAnalyzerThread);
 }
 
@@ -77,12 +80,14 @@ AnalyzerThread::AnalyzerThread(
         int id,
         mixxx::DbConnectionPoolPtr dbConnectionPool,
         UserSettingsPointer pConfig,
-        AnalyzerModeFlags modeFlags)
+        AnalyzerModeFlags modeFlags,
+        int maxAnalyzerLanes)
         : WorkerThread(QString("AnalyzerThread %1").arg(id)),
           m_id(id),
           m_dbConnectionPool(std::move(dbConnectionPool)),
           m_pConfig(pConfig),
           m_modeFlags(modeFlags),
+          m_maxAnalyzerLanes(maxAnalyzerLanes),
           m_nextTrack(2), // minimum capacity
           m_sampleBuffer(mixxx::kAnalysisSamplesPerChunk),
           m_emittedState(AnalyzerThreadState::Void) {
@@ -117,9 +122,21 @@ void AnalyzerThread::doRun() {
     m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerBeats>(m_pConfig, enforceBpmDetection)));
     m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerKey>(m_pConfig)));
     m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerSilence>(m_pConfig)));
+    if (AnalyzerDecodedAudioCache::isEnabled(m_pConfig)) {
+        m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerDecodedAudioCache>(m_pConfig)));
+    }
     DEBUG_ASSERT(!m_analyzers.empty());
     kLogger.debug() << "Activated" << m_analyzers.size() << "analyzers";
 
+    const int numAnalyzerLanes = math_min(
+            m_maxAnalyzerLanes, static_cast<int>(m_analyzers.size()));
+    if (numAnalyzerLanes > 1) {
+        kLogger.debug() << "Running analyzers on" << numAnalyzerLanes << "threads";
+        m_pAnalyzerFanOut = std::make_unique<AnalyzerFanOut>(
+                numAnalyzerLanes,
+                mixxx::kAnalysisSamplesPerChunk);
+    }
+
     m_lastBusyProgressEmittedTimer.start();
 
     mixxx::AudioSource::OpenParams openParams;
@@ -181,6 +198,8 @@ void AnalyzerThread::doRun() {
     DEBUG_ASSERT(!m_currentTrack);
     DEBUG_ASSERT(isStopping());
 
+    // Join the lanes before destroying the analyzers
+    m_pAnalyzerFanOut.reset();
     m_analyzers.clear();
 
     kLogger.debug() << "Exiting worker thread";
@@ -228,6 +247,17 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
             mixxx::kAnalysisFramesPerChunk);
     DEBUG_ASSERT(audioSourceProxy.channelCount() == mixxx::kAnalysisChannels);
 
+    if (m_pAnalyzerFanOut) {
+        m_pAnalyzerFanOut->begin(&m_analyzers);
+    }
+    // The analyzers must not be accessed from this thread after returning
+    // until all blocks that have been handed over have been processed.
+    const auto waitForAnalyzers = [this] {
+        if (m_pAnalyzerFanOut) {
+            m_pAnalyzerFanOut->waitUntilProcessed();
+        }
+    };
+
     // Analysis starts now
     emitBusyProgress(kAnalyzerProgressNone);
 
@@ -235,6 +265,7 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
     while (!remainingFrameRange.empty()) {
         sleepWhileSuspended();
         if (isStopping()) {
+            waitForAnalyzers();
             return AnalysisResult::Cancelled;
         }
 
@@ -246,12 +277,16 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
                         math_min(mixxx::kAnalysisFramesPerChunk, remainingFrameRange.length()));
         DEBUG_ASSERT(!chunkFrameRange.empty());
 
-        // Request the next chunk of audio data
+        // Request the next chunk of audio data. When running the analyzers
+        // concurrently the samples are decoded directly into the next free
+        // buffer of the ring that is shared with the analyzer lanes.
         const auto readableSampleFrames =
                 audioSourceProxy.readSampleFrames(
                         mixxx::WritableSampleFrames(
                                 chunkFrameRange,
-                                mixxx::SampleBuffer::WritableSlice(m_sampleBuffer)));
+                                m_pAnalyzerFanOut
+                                        ? m_pAnalyzerFanOut->nextWritableBlock()
+                                        : mixxx::SampleBuffer::WritableSlice(m_sampleBuffer)));
         // The returned range fits into the requested range
         DEBUG_ASSERT(readableSampleFrames.frameIndexRange() <= chunkFrameRange);
 
@@ -290,15 +325,22 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
 
         sleepWhileSuspended();
         if (isStopping()) {
+            waitForAnalyzers();
             return AnalysisResult::Cancelled;
         }
 
         // 2nd: step: Analyze chunk of decoded audio data
         if (!readableSampleFrames.frameIndexRange().empty()) {
-            for (auto&& analyzer : m_analyzers) {
-                analyzer.processSamples(
+            if (m_pAnalyzerFanOut) {
+                m_pAnalyzerFanOut->publishBlock(
                         readableSampleFrames.readableData(),
                         readableSampleFrames.readableLength());
+            } else {
+                for (auto&& analyzer : m_analyzers) {
+                    analyzer.processSamples(
+                            readableSampleFrames.readableData(),
+                            readableSampleFrames.readableLength());
+                }
             }
         }
 
@@ -323,6 +365,7 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
         }
     }
 
+    waitForAnalyzers();
     return AnalysisResult::Finished;
 }
 
@@ -5,6 +5,7 @@
 #include "rigtorp/SPSCQueue.h"
 
 #include "analyzer/analyzer.h"
+#include "analyzer/analyzerfanout.h"
 #include "analyzer/analyzerprogress.h"
 #include "preferences/usersettings.h"
 #include "sources/audiosource.h"
@@ -52,17 +53,21 @@ class AnalyzerThread : public WorkerThread {
         NullPointer();
     };
 
+    // If maxAnalyzerLanes > 1 the analyzers of each track are run
+    // concurrently on up to maxAnalyzerLanes additional threads.
     static Pointer createInstance(
             int id,
             mixxx::DbConnectionPoolPtr dbConnectionPool,
             UserSettingsPointer pConfig,
-            AnalyzerModeFlags modeFlags);
+            AnalyzerModeFlags modeFlags,
+            int maxAnalyzerLanes = 1);
 
     /*private*/ AnalyzerThread(
             int id,
             mixxx::DbConnectionPoolPtr dbConnectionPool,
             UserSettingsPointer pConfig,
-            AnalyzerModeFlags modeFlags);
+            AnalyzerModeFlags modeFlags,
+            int maxAnalyzerLanes);
     ~AnalyzerThread() override = default;
 
     int id() const {
@@ -97,6 +102,7 @@ class AnalyzerThread : public WorkerThread {
     const mixxx::DbConnectionPoolPtr m_dbConnectionPool;
     const UserSettingsPointer m_pConfig;
     const AnalyzerModeFlags m_modeFlags;
+    const int m_maxAnalyzerLanes;
 
     /////////////////////////////////////////////////////////////////////////
     // Thread-safe atomic values
@@ -115,6 +121,9 @@ class AnalyzerThread : public WorkerThread {
 
     std::vector<AnalyzerWithState> m_analyzers;
 
+    // Only created if the analyzers run concurrently
+    std::unique_ptr<AnalyzerFanOut> m_pAnalyzerFanOut;
+
     mixxx::SampleBuffer m_sampleBuffer;
 
     TrackPointer m_currentTrack;
@@ -12,6 +12,10 @@ namespace {
 
 mixxx::Logger kLogger("AnalyzerWaveform");
 
+// The GUI is notified about newly analyzed parts of the waveform summary in
+// steps of at least 8 of its 1920 visual samples
+constexpr int kSummaryAnalyzedNotifySize = 8 * ChannelCount;
+
 } // namespace
 
 AnalyzerWaveform::AnalyzerWaveform(
@@ -22,7 +26,8 @@ AnalyzerWaveform::AnalyzerWaveform(
           m_waveformSummaryData(nullptr),
           m_stride(0, 0),
           m_currentStride(0),
-          m_currentSummaryStride(0) {
+          m_currentSummaryStride(0),
+          m_analyzedSummaryStride(0) {
     m_filter[0] = 0;
     m_filter[1] = 0;
     m_filter[2] = 0;
@@ -66,6 +71,7 @@ bool AnalyzerWaveform::initialize(TrackPointer tio, int sampleRate, int totalSam
     // now.
     tio->setWaveform(m_waveform);
     tio->setWaveformSummary(m_waveformSummary);
+    m_pTrack = tio;
 
     m_waveformData = m_waveform->data();
     m_waveformSummaryData = m_waveformSummary->data();
@@ -75,6 +81,7 @@ bool AnalyzerWaveform::initialize(TrackPointer tio, int sampleRate, int totalSam
 
     m_currentStride = 0;
     m_currentSummaryStride = 0;
+    m_analyzedSummaryStride = 0;
 
     //debug
     //m_waveform->dump();
@@ -251,6 +258,11 @@ bool AnalyzerWaveform::processSamples(const CSAMPLE* buffer, const int bufferLen
         }
     }
 
+    if (m_currentSummaryStride - m_analyzedSummaryStride >= kSummaryAnalyzedNotifySize) {
+        m_pTrack->setWaveformSummaryAnalyzed(m_analyzedSummaryStride, m_currentSummaryStride);
+        m_analyzedSummaryStride = m_currentSummaryStride;
+    }
+
     //kLogger.debug() << "process - m_waveform->getCompletion()" << m_waveform->getCompletion() << "off" << m_waveform->getDataSize();
     //kLogger.debug() << "process - m_waveformSummary->getCompletion()" << m_waveformSummary->getCompletion() << "off" << m_waveformSummary->getDataSize();
     return true;
@@ -261,6 +273,7 @@ void AnalyzerWaveform::cleanup() {
     m_waveformData = nullptr;
     m_waveformSummary.clear();
     m_waveformSummaryData = nullptr;
+    m_pTrack.reset();
 }
 
 void AnalyzerWaveform::storeResults(TrackPointer tio) {
@@ -270,6 +283,7 @@ void AnalyzerWaveform::storeResults(TrackPointer tio) {
         m_waveform->setCompletion(m_waveform->getDataSize());
         m_waveform->setVersion(WaveformFactory::currentWaveformVersion());
         m_waveform->setDescription(WaveformFactory::currentWaveformDescription());
+        m_waveform->buildPyramid();
     }
     tio->setWaveform(m_waveform);
 
@@ -279,6 +293,7 @@ void AnalyzerWaveform::storeResults(TrackPointer tio) {
         m_waveformSummary->setCompletion(m_waveformSummary->getDataSize());
         m_waveformSummary->setVersion(WaveformFactory::currentWaveformSummaryVersion());
         m_waveformSummary->setDescription(WaveformFactory::currentWaveformSummaryDescription());
+        m_waveformSummary->buildPyramid();
     }
     tio->setWaveformSummary(m_waveformSummary);
 
@@ -163,11 +163,14 @@ class AnalyzerWaveform : public Analyzer {
     WaveformPointer m_waveformSummary;
     WaveformData* m_waveformData;
     WaveformData* m_waveformSummaryData;
+    TrackPointer m_pTrack;
 
     WaveformStride m_stride;
 
     int m_currentStride;
     int m_currentSummaryStride;
+    // The end of the summary data that has been announced to the GUI
+    int m_analyzedSummaryStride;
 
     EngineFilterIIRBase* m_filter[FilterCount];
     std::vector<float> m_buffers[FilterCount];
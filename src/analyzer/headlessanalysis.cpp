@@ -0,0 +1,207 @@
+#include "analyzer/headlessanalysis.h"
+
+#include <stdio.h>
+
+#include <QDirIterator>
+#include <QEventLoop>
+#include <QFileInfo>
+#include <QThread>
+
+#include "database/mixxxdb.h"
+#include "library/trackcollection.h"
+#include "library/trackcollectionmanager.h"
+#include "sources/soundsourceproxy.h"
+#include "util/db/dbconnectionpooled.h"
+#include "util/logger.h"
+#include "util/math.h"
+
+namespace {
+
+const mixxx::Logger kLogger("HeadlessAnalysis");
+
+QList<TrackFile> listSupportedFiles(const QString& location) {
+    QList<TrackFile> trackFiles;
+    const QFileInfo fileInfo(location);
+    if (fileInfo.isDir()) {
+        QDirIterator it(
+                fileInfo.absoluteFilePath(),
+                SoundSourceProxy::getSupportedFileNamePatterns(),
+                QDir::Files | QDir::NoDotAndDotDot,
+                QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+        while (it.hasNext()) {
+            trackFiles.append(TrackFile(it.next()));
+        }
+    } else if (fileInfo.isFile() && SoundSourceProxy::isFileSupported(fileInfo)) {
+        trackFiles.append(TrackFile(fileInfo));
+    } else {
+        kLogger.warning() << "Ignoring unsupported file" << location;
+    }
+    return trackFiles;
+}
+
+} // anonymous namespace
+
+HeadlessAnalysis::HeadlessAnalysis(
+        UserSettingsPointer pConfig,
+        QStringList locations)
+        : m_pConfig(std::move(pConfig)),
+          m_locations(std::move(locations)),
+          m_pTrackCollectionManager(nullptr),
+          m_pTrackAnalysisScheduler(TrackAnalysisScheduler::NullPointer()),
+          m_totalFileSize(0),
+          m_totalTracksCount(0),
+          m_finishedTracksCount(0),
+          m_failedTracksCount(0) {
+}
+
+HeadlessAnalysis::~HeadlessAnalysis() {
+    closeDatabase();
+}
+
+bool HeadlessAnalysis::openDatabase() {
+    m_pDbConnectionPool = MixxxDb(m_pConfig).connectionPool();
+    if (!m_pDbConnectionPool) {
+        return false;
+    }
+    m_pDbConnectionPool->createThreadLocalConnection();
+    QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
+    if (!dbConnection.isOpen()) {
+        kLogger.critical() << "Unable to establish a database connection";
+        return false;
+    }
+    if (!MixxxDb::initDatabaseSchema(dbConnection)) {
+        return false;
+    }
+    m_pTrackCollectionManager = new TrackCollectionManager(
+            this,
+            m_pConfig,
+            m_pDbConnectionPool);
+    return true;
+}
+
+void HeadlessAnalysis::closeDatabase() {
+    m_pTrackAnalysisScheduler.reset();
+    // Deleting the track collections saves all modified tracks
+    delete m_pTrackCollectionManager;
+    m_pTrackCollectionManager = nullptr;
+    if (m_pDbConnectionPool) {
+        m_pDbConnectionPool->destroyThreadLocalConnection();
+        m_pDbConnectionPool.reset();
+    }
+}
+
+QList<TrackId> HeadlessAnalysis::resolveTrackIds() {
+    TrackCollection* pTrackCollection =
+            m_pTrackCollectionManager->internalCollection();
+    if (m_locations.isEmpty()) {
+        QList<TrackId> trackIds;
+        for (const auto& dir : pTrackCollection->getDirectoryDAO().getDirs()) {
+            for (const auto& trackRef :
+                    pTrackCollection->getTrackDAO().getAllTrackRefs(QDir(dir))) {
+                trackIds.append(trackRef.getId());
+            }
+        }
+        return trackIds;
+    }
+    QList<TrackFile> trackFiles;
+    for (const auto& location : m_locations) {
+        trackFiles.append(listSupportedFiles(location));
+    }
+    return pTrackCollection->resolveTrackIds(
+            trackFiles,
+            TrackDAO::ResolveTrackIdFlag::UnhideHidden |
+                    TrackDAO::ResolveTrackIdFlag::AddMissing);
+}
+
+int HeadlessAnalysis::run() {
+    if (!openDatabase()) {
+        return -1;
+    }
+
+    const QList<TrackId> trackIds = resolveTrackIds();
+    for (const auto& trackId : trackIds) {
+        const QString location =
+                m_pTrackCollectionManager->internalCollection()
+                        ->getTrackDAO()
+                        .getTrackLocation(trackId);
+        m_totalFileSize += QFileInfo(location).size();
+    }
+    if (trackIds.isEmpty()) {
+        fputs("No tracks found for analysis\n", stdout);
+        return 0;
+    }
+
+    // Utilize all available cores. The analyzers of each track run on
+    // the same thread, which is the most efficient way for many tracks.
+    const int numWorkerThreads = math_max(1, QThread::idealThreadCount());
+    m_pTrackAnalysisScheduler = TrackAnalysisScheduler::createInstance(
+            m_pTrackCollectionManager->internalCollection(),
+            m_pDbConnectionPool,
+            numWorkerThreads,
+            m_pConfig,
+            AnalyzerModeFlags::All);
+    connect(m_pTrackAnalysisScheduler.get(),
+            &TrackAnalysisScheduler::trackProgress,
+            this,
+            &HeadlessAnalysis::slotTrackProgress);
+
+    QEventLoop eventLoop;
+    connect(m_pTrackAnalysisScheduler.get(),
+            &TrackAnalysisScheduler::finished,
+            &eventLoop,
+            &QEventLoop::quit);
+
+    m_totalTracksCount =
+            m_pTrackAnalysisScheduler->scheduleTracksById(trackIds);
+    fprintf(stdout,
+            "Analyzing %d tracks using %d threads\n",
+            m_totalTracksCount,
+            numWorkerThreads);
+    m_timer.start();
+    m_pTrackAnalysisScheduler->resume();
+    eventLoop.exec();
+
+    printStats();
+    closeDatabase();
+    return m_failedTracksCount > 0 ? 1 : 0;
+}
+
+void HeadlessAnalysis::slotTrackProgress(
+        TrackId trackId,
+        AnalyzerProgress analyzerProgress) {
+    const char* result;
+    if (analyzerProgress == kAnalyzerProgressDone) {
+        result = "done";
+    } else if (analyzerProgress == kAnalyzerProgressUnknown) {
+        // The analysis of this track failed
+        ++m_failedTracksCount;
+        result = "failed";
+    } else {
+        return;
+    }
+    ++m_finishedTracksCount;
+    const QString location =
+            m_pTrackCollectionManager->internalCollection()
+                    ->getTrackDAO()
+                    .getTrackLocation(trackId);
+    fprintf(stdout,
+            "[%d/%d] %s: %s\n",
+            m_finishedTracksCount,
+            m_totalTracksCount,
+            result,
+            location.toLocal8Bit().constData());
+    fflush(stdout);
+}
+
+void HeadlessAnalysis::printStats() const {
+    const double elapsedSecs = math_max(m_timer.elapsed(), qint64(1)) / 1000.0;
+    const double fileSizeMB = m_totalFileSize / (1024.0 * 1024.0);
+    fprintf(stdout,
+            "Analyzed %d tracks (%d failed) in %.1f s\n"
+            "Throughput: %.2f tracks/s, %.2f MB/s of decoded files\n",
+            m_finishedTracksCount,
+            m_failedTracksCount,
+            elapsedSecs,
+            m_finishedTracksCount / elapsedSecs,
+            fileSizeMB / elapsedSecs);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QStringList>
+
+#include "analyzer/trackanalysisscheduler.h"
+#include "preferences/usersettings.h"
+#include "track/trackid.h"
+#include "util/db/dbconnectionpool.h"
+
+class TrackCollectionManager;
+
+// Batch analysis of tracks without a GUI and without opening any audio
+// devices, e.g. for preparing a library on a different machine before
+// copying it to the machine that is used for performing. The results are
+// stored in the database and the analysis directory in the settings path
+// exactly as if the tracks have been analyzed from the GUI.
+//
+// Prints the progress and some statistics about the throughput to stdout.
+class HeadlessAnalysis : public QObject {
+    Q_OBJECT
+
+  public:
+    // Tracks in the given locations (files or directories) that are not
+    // yet in the library will be added. All tracks of the library are
+    // analyzed if no locations are given.
+    HeadlessAnalysis(
+            UserSettingsPointer pConfig,
+            QStringList locations);
+    ~HeadlessAnalysis() override;
+
+    // Runs the analysis and blocks until it is finished. Returns the exit
+    // code of the application.
+    int run();
+
+  private slots:
+    void slotTrackProgress(TrackId trackId, AnalyzerProgress analyzerProgress);
+
+  private:
+    bool openDatabase();
+    void closeDatabase();
+
+    QList<TrackId> resolveTrackIds();
+
+    void printStats() const;
+
+    const UserSettingsPointer m_pConfig;
+    const QStringList m_locations;
+
+    mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+    TrackCollectionManager* m_pTrackCollectionManager;
+
+    TrackAnalysisScheduler::Pointer m_pTrackAnalysisScheduler;
+
+    // The sum of the file sizes of all scheduled tracks
+    qint64 m_totalFileSize;
+    int m_totalTracksCount;
+    int m_finishedTracksCount;
+    int m_failedTracksCount;
+    QElapsedTimer m_timer;
+};
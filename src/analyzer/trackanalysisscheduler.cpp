@@ -2,8 +2,10 @@
 
 #include "library/library.h"
 #include "library/trackcollection.h"
+#include "library/trackcollectionmanager.h"
 
 #include "util/logger.h"
+#include "util/math.h"
 
 
 namespace {
@@ -36,8 +38,25 @@ TrackAnalysisScheduler::Pointer TrackAnalysisScheduler::createInstance(
         int numWorkerThreads,
         const UserSettingsPointer& pConfig,
         AnalyzerModeFlags modeFlags) {
+    DEBUG_ASSERT(library);
+    return createInstance(
+            library->trackCollections()->internalCollection(),
+            library->dbConnectionPool(),
+            numWorkerThreads,
+            pConfig,
+            modeFlags);
+}
+
+//static
+TrackAnalysisScheduler::Pointer TrackAnalysisScheduler::createInstance(
+        TrackCollection* pTrackCollection,
+        mixxx::DbConnectionPoolPtr pDbConnectionPool,
+        int numWorkerThreads,
+        const UserSettingsPointer& pConfig,
+        AnalyzerModeFlags modeFlags) {
     return Pointer(new TrackAnalysisScheduler(
-            library,
+            pTrackCollection,
+            std::move(pDbConnectionPool),
             numWorkerThreads,
             pConfig,
             modeFlags),
@@ -45,16 +64,18 @@ TrackAnalysisScheduler::Pointer TrackAnalysisScheduler::createInstance(
 }
 
 TrackAnalysisScheduler::TrackAnalysisScheduler(
-        Library* library,
+        TrackCollection* pTrackCollection,
+        mixxx::DbConnectionPoolPtr pDbConnectionPool,
         int numWorkerThreads,
         const UserSettingsPointer& pConfig,
         AnalyzerModeFlags modeFlags)
-        : m_library(library),
+        : m_pTrackCollection(pTrackCollection),
           m_currentTrackProgress(kAnalyzerProgressUnknown),
           m_currentTrackNumber(0),
           m_dequeuedTracksCount(0),
           // The first signal should always be emitted
           m_lastProgressEmittedAt(Clock::now() - kProgressInhibitDuration) {
+    DEBUG_ASSERT(m_pTrackCollection);
     VERIFY_OR_DEBUG_ASSERT(numWorkerThreads > 0) {
             kLogger.warning()
                     << "Invalid number of worker threads:"
@@ -65,14 +86,20 @@ TrackAnalysisScheduler::TrackAnalysisScheduler(
                 << numWorkerThreads
                 << "worker threads";
     }
+    // Idle worker threads pick up the next track from the shared queue.
+    // Remaining cores are used for running the analyzers of each track
+    // concurrently.
+    const int maxAnalyzerLanes = math_max(1,
+            QThread::idealThreadCount() / math_max(1, numWorkerThreads));
     // 1st pass: Create worker threads
     m_workers.reserve(numWorkerThreads);
     for (int threadId = 0; threadId < numWorkerThreads; ++threadId) {
         m_workers.emplace_back(AnalyzerThread::createInstance(
                 threadId,
-                library->dbConnectionPool(),
+                pDbConnectionPool,
                 pConfig,
-                modeFlags));
+                modeFlags,
+                maxAnalyzerLanes));
         connect(m_workers.back().thread(), &AnalyzerThread::progress,
             this, &TrackAnalysisScheduler::onWorkerThreadProgress);
     }
@@ -275,7 +302,7 @@ bool TrackAnalysisScheduler::submitNextTrack(Worker* worker) {
         DEBUG_ASSERT(nextTrackId.isValid());
         if (nextTrackId.isValid()) {
             TrackPointer nextTrack =
-                    m_library->trackCollection().getTrackById(nextTrackId);
+                    m_pTrackCollection->getTrackById(nextTrackId);
             if (nextTrack) {
                 if (m_pendingTrackIds.insert(nextTrackId).second) {
                     if (worker->submitNextTrack(std::move(nextTrack))) {
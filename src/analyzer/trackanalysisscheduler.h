@@ -13,6 +13,7 @@
 
 // forward declaration(s)
 class Library;
+class TrackCollection;
 
 class TrackAnalysisScheduler : public QObject {
     Q_OBJECT
@@ -30,9 +31,18 @@ class TrackAnalysisScheduler : public QObject {
             int numWorkerThreads,
             const UserSettingsPointer& pConfig,
             AnalyzerModeFlags modeFlags);
+    // Variant that does not depend on the Library, e.g. for analyzing
+    // tracks without a GUI.
+    static Pointer createInstance(
+            TrackCollection* pTrackCollection,
+            mixxx::DbConnectionPoolPtr pDbConnectionPool,
+            int numWorkerThreads,
+            const UserSettingsPointer& pConfig,
+            AnalyzerModeFlags modeFlags);
 
     /*private*/ TrackAnalysisScheduler(
-            Library* library,
+            TrackCollection* pTrackCollection,
+            mixxx::DbConnectionPoolPtr pDbConnectionPool,
             int numWorkerThreads,
             const UserSettingsPointer& pConfig,
             AnalyzerModeFlags modeFlags);
@@ -146,7 +156,7 @@ class TrackAnalysisScheduler : public QObject {
                 m_pendingTrackIds.empty();
     }
 
-    Library* m_library;
+    TrackCollection* const m_pTrackCollection;
 
     std::vector<Worker> m_workers;
 
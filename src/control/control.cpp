@@ -36,6 +36,7 @@ ControlDoublePrivate::ControlDoublePrivate(ConfigKey key,
           m_bPersistInConfiguration(bPersist),
           m_bIgnoreNops(bIgnoreNops),
           m_bTrack(bTrack),
+          m_trackTagId(Stat::kInvalidTagId),
           m_trackType(Stat::UNSPECIFIED),
           m_trackFlags(Stat::COUNT | Stat::SUM | Stat::AVERAGE |
                        Stat::SAMPLE_VARIANCE | Stat::MIN | Stat::MAX),
@@ -55,12 +56,13 @@ void ControlDoublePrivate::initialize(double defaultValue) {
     m_defaultValue.setValue(defaultValue);
     m_value.setValue(value);
 
-    //qDebug() << "Creating:" << m_trackKey << "at" << &m_value << sizeof(m_value);
+    //qDebug() << "Creating:" << m_key << "at" << &m_value << sizeof(m_value);
 
     if (m_bTrack) {
         // TODO(rryan): Make configurable.
-        m_trackKey = "control " + m_key.group + "," + m_key.item;
-        Stat::track(m_trackKey, static_cast<Stat::StatType>(m_trackType),
+        m_trackTagId = Stat::registerTag(
+                "control " + m_key.group + "," + m_key.item);
+        Stat::track(m_trackTagId, static_cast<Stat::StatType>(m_trackType),
                     static_cast<Stat::ComputeFlags>(m_trackFlags),
                     m_value.getValue());
     }
@@ -198,7 +200,7 @@ void ControlDoublePrivate::setInner(double value, QObject* pSender) {
     emit valueChanged(value, pSender);
 
     if (m_bTrack) {
-        Stat::track(m_trackKey, static_cast<Stat::StatType>(m_trackType),
+        Stat::track(m_trackTagId, static_cast<Stat::StatType>(m_trackType),
                     static_cast<Stat::ComputeFlags>(m_trackFlags), value);
     }
 }
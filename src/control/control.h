@@ -155,7 +155,7 @@ class ControlDoublePrivate : public QObject {
 
     // Whether to track value changes with the stats framework.
     bool m_bTrack;
-    QString m_trackKey;
+    int m_trackTagId;
     int m_trackType;
     int m_trackFlags;
     bool m_confirmRequired;
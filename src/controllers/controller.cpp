@@ -11,6 +11,9 @@
 #include "controllers/controller.h"
 #include "controllers/controllerdebug.h"
 #include "controllers/defs_controllers.h"
+#include "util/assert.h"
+#include "util/counter.h"
+#include "util/math.h"
 #include "util/screensaver.h"
 
 Controller::Controller()
@@ -19,8 +22,19 @@ Controller::Controller()
           m_bIsOutputDevice(false),
           m_bIsInputDevice(false),
           m_bIsOpen(false),
-          m_bLearning(false) {
+          m_bLearning(false),
+          m_outputTimer(this),
+          m_outputFrameMillis(0),
+          m_outputSentCount(0),
+          m_outputCoalescedCount(0),
+          m_outputDeferredCount(0),
+          m_outputDeferredPending(0),
+          m_outputCoalescedTagId(Stat::kInvalidTagId),
+          m_outputDeferredTagId(Stat::kInvalidTagId) {
         m_userActivityInhibitTimer.start();
+        m_outputTimer.setSingleShot(true);
+        connect(&m_outputTimer, SIGNAL(timeout()),
+                this, SLOT(slotSendOutputFrame()));
 }
 
 Controller::~Controller() {
@@ -47,6 +61,10 @@ void Controller::stopEngine() {
     m_pEngine->gracefulShutdown();
     delete m_pEngine;
     m_pEngine = NULL;
+
+    // Send what the scripts have scheduled on shutdown, e.g. to turn off all
+    // LEDs, before the device is closed.
+    setOutputScheduling(0);
 }
 
 bool Controller::applyPreset(QList<QString> scriptPaths, bool initializeScripts) {
@@ -97,6 +115,93 @@ void Controller::send(QList<int> data, unsigned int length) {
     send(msg);
 }
 
+void Controller::setOutputScheduling(int frameMillis, int maxMessagesPerFrame) {
+    if (frameMillis < 0 || maxMessagesPerFrame < 0) {
+        qWarning() << "Controller: Invalid output scheduling" << frameMillis
+                   << maxMessagesPerFrame << "for" << m_sDeviceName << ", ignoring.";
+        return;
+    }
+    m_outputScheduler.setMaxMessagesPerFrame(maxMessagesPerFrame);
+    if (frameMillis > 0) {
+        if (m_outputCoalescedTagId == Stat::kInvalidTagId) {
+            // Registered once, scheduleOutput() is called for every message
+            m_outputCoalescedTagId = Stat::registerTag(
+                    "%1 output coalesced", m_sDeviceName);
+            m_outputDeferredTagId = Stat::registerTag(
+                    "%1 output deferred", m_sDeviceName);
+        }
+        m_outputFrameMillis = frameMillis;
+        m_outputTimer.setInterval(frameMillis);
+        return;
+    }
+    if (!isOutputScheduling()) {
+        return;
+    }
+    m_outputTimer.stop();
+    sendAllScheduledOutput();
+    m_outputFrameMillis = 0;
+    qDebug() << m_sDeviceName << "scheduled output:" << m_outputSentCount
+             << "messages sent," << m_outputCoalescedCount << "coalesced,"
+             << m_outputDeferredCount << "deferred";
+    m_outputSentCount = 0;
+    m_outputCoalescedCount = 0;
+    m_outputDeferredCount = 0;
+}
+
+void Controller::scheduleOutput(quint32 address, const QByteArray& message) {
+    VERIFY_OR_DEBUG_ASSERT(isOutputScheduling()) {
+        sendScheduledOutput(address, message);
+        return;
+    }
+    if (!m_outputScheduler.schedule(address, message)) {
+        ++m_outputCoalescedCount;
+        Counter(m_outputCoalescedTagId).increment();
+    }
+    // The timer only runs while messages are pending, so an idle
+    // controller does not wake up the thread.
+    if (!m_outputTimer.isActive()) {
+        m_outputTimer.start();
+    }
+}
+
+void Controller::sendScheduledOutput(quint32 address, const QByteArray& message) {
+    Q_UNUSED(address);
+    send(message);
+}
+
+void Controller::slotSendOutputFrame() {
+    const QList<ControllerOutputScheduler::Message> messages =
+            m_outputScheduler.takeFrame();
+    for (const auto& message : messages) {
+        sendScheduledOutput(message.first, message.second);
+    }
+    m_outputSentCount += messages.size();
+    // The messages are sent in order, so those that have been deferred
+    // before are sent first and only the others are counted.
+    const int previouslyDeferred =
+            math_max(m_outputDeferredPending - messages.size(), 0);
+    m_outputDeferredPending = m_outputScheduler.size();
+    if (!m_outputScheduler.isEmpty()) {
+        // Rate limited, the rest has to wait for the next frame
+        const int deferred = m_outputDeferredPending - previouslyDeferred;
+        if (deferred > 0) {
+            m_outputDeferredCount += deferred;
+            Counter(m_outputDeferredTagId).increment(deferred);
+        }
+        m_outputTimer.start();
+    }
+}
+
+void Controller::sendAllScheduledOutput() {
+    const QList<ControllerOutputScheduler::Message> messages =
+            m_outputScheduler.takeAll();
+    for (const auto& message : messages) {
+        sendScheduledOutput(message.first, message.second);
+    }
+    m_outputSentCount += messages.size();
+    m_outputDeferredPending = 0;
+}
+
 void Controller::triggerActivity()
 {
      // Inhibit Updates for 1000 milliseconds
@@ -136,7 +241,7 @@ void Controller::receive(const QByteArray data, mixxx::Duration timestamp) {
             continue;
         }
         function.append(".incomingData");
-        QScriptValue incomingData = m_pEngine->wrapFunctionCode(function, 2);
+        QScriptValue incomingData = m_pEngine->wrapFunctionCode(function, 3);
         if (!m_pEngine->execute(incomingData, data, timestamp)) {
             qWarning() << "Controller: Invalid script function" << function;
         }
@@ -12,7 +12,10 @@
 #ifndef CONTROLLER_H
 #define CONTROLLER_H
 
+#include <QTimer>
+
 #include "controllers/controllerengine.h"
+#include "controllers/controlleroutputscheduler.h"
 #include "controllers/controllervisitor.h"
 #include "controllers/controllerpreset.h"
 #include "controllers/controllerpresetinfo.h"
@@ -94,6 +97,13 @@ class Controller : public QObject, ConstControllerPresetVisitor {
     // were required to specify it.
     Q_INVOKABLE void send(QList<int> data, unsigned int length = 0);
 
+    // Enables output scheduling for scripts that update many LEDs or
+    // displays. Scheduled messages are collected for frameMillis and only the
+    // latest message to each address is sent, at most maxMessagesPerFrame
+    // per frame if it is not 0. A frameMillis of 0 sends the pending messages
+    // and disables output scheduling again.
+    Q_INVOKABLE void setOutputScheduling(int frameMillis, int maxMessagesPerFrame = 0);
+
     // To be called in sub-class' open() functions after opening the device but
     // before starting any input polling/processing.
     void startEngine();
@@ -124,6 +134,21 @@ class Controller : public QObject, ConstControllerPresetVisitor {
         m_bIsOpen = open;
     }
 
+    inline bool isOutputScheduling() const {
+        return m_outputFrameMillis > 0;
+    }
+    // Sends the message at the end of the current output frame, unless it is
+    // replaced by another message to the same address until then.
+    void scheduleOutput(quint32 address, const QByteArray& message);
+    // Sends a message that has been passed to scheduleOutput()
+    virtual void sendScheduledOutput(quint32 address, const QByteArray& message);
+
+  private slots:
+    void slotSendOutputFrame();
+
+  private:
+    void sendAllScheduledOutput();
+
   private: // but used by ControllerManager
 
     virtual int open() = 0;
@@ -162,6 +187,21 @@ class Controller : public QObject, ConstControllerPresetVisitor {
     bool m_bLearning;
     QElapsedTimer m_userActivityInhibitTimer;
 
+    ControllerOutputScheduler m_outputScheduler;
+    QTimer m_outputTimer;
+    int m_outputFrameMillis;
+    // Statistics of the scheduled output, reported when output scheduling
+    // is disabled
+    int m_outputSentCount;
+    int m_outputCoalescedCount;
+    int m_outputDeferredCount;
+    // The number of messages at the front of m_outputScheduler that have
+    // already been counted as deferred
+    int m_outputDeferredPending;
+    // Stat tags of the counters above
+    int m_outputCoalescedTagId;
+    int m_outputDeferredTagId;
+
     // accesses lots of our stuff, but in the same thread
     friend class ControllerManager;
     // For testing
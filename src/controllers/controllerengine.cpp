@@ -419,7 +419,6 @@ bool ControllerEngine::execute(QScriptValue functionObject,
                                unsigned char status,
                                const QString& group,
                                mixxx::Duration timestamp) {
-    Q_UNUSED(timestamp);
     if (m_pEngine == nullptr) {
         return false;
     }
@@ -429,18 +428,19 @@ bool ControllerEngine::execute(QScriptValue functionObject,
     args << QScriptValue(value);
     args << QScriptValue(status);
     args << QScriptValue(group);
+    args << QScriptValue(timestamp.toDoubleMillis());
     return internalExecute(m_pEngine->globalObject(), functionObject, args);
 }
 
 bool ControllerEngine::execute(QScriptValue function, const QByteArray data,
                                mixxx::Duration timestamp) {
-    Q_UNUSED(timestamp);
     if (m_pEngine == nullptr) {
         return false;
     }
     QScriptValueList args;
     args << m_pBaClass->newInstance(data);
     args << QScriptValue(data.size());
+    args << QScriptValue(timestamp.toDoubleMillis());
     return internalExecute(m_pEngine->globalObject(), function, args);
 }
 
@@ -581,9 +581,15 @@ void ControllerEngine::setValue(QString group, QString name, double newValue) {
 
     if (coScript != nullptr) {
         ControlObject* pControl = ControlObject::getControl(coScript->getKey());
-        if (pControl && !m_st.ignore(pControl, coScript->getParameterForValue(newValue))) {
-            coScript->slotSet(newValue);
-        }
+        setControlValue(coScript, pControl, newValue);
+    }
+}
+
+void ControllerEngine::setControlValue(ControlObjectScript* coScript,
+                                       ControlObject* pControl,
+                                       double newValue) {
+    if (pControl && !m_st.ignore(pControl, coScript->getParameterForValue(newValue))) {
+        coScript->slotSet(newValue);
     }
 }
 
@@ -618,9 +624,15 @@ void ControllerEngine::setParameter(QString group, QString name, double newParam
 
     if (coScript != nullptr) {
         ControlObject* pControl = ControlObject::getControl(coScript->getKey());
-        if (pControl && !m_st.ignore(pControl, newParameter)) {
-          coScript->setParameter(newParameter);
-        }
+        setControlParameter(coScript, pControl, newParameter);
+    }
+}
+
+void ControllerEngine::setControlParameter(ControlObjectScript* coScript,
+                                           ControlObject* pControl,
+                                           double newParameter) {
+    if (pControl && !m_st.ignore(pControl, newParameter)) {
+        coScript->setParameter(newParameter);
     }
 }
 
@@ -690,6 +702,72 @@ double ControllerEngine::getDefaultParameter(QString group, QString name) {
     return coScript->getParameterForValue(coScript->getDefault());
 }
 
+// Purpose: Look up a Mixxx control once for repeated access (for scripts)
+// Input:   Control group (e.g. '[Channel1]'), Key name (e.g. 'jog')
+// Output:  a ScriptControlHandle turned into a QtScriptValue. The script
+//          should store this object and call its 'get', 'set',
+//          'getParameter' and 'setParameter' methods.
+//          If the control does not exist, returns undefined.
+QScriptValue ControllerEngine::getControl(QString group, QString name) {
+    VERIFY_OR_DEBUG_ASSERT(m_pEngine != nullptr) {
+        return QScriptValue();
+    }
+
+    ControlObjectScript* coScript = getControlObjectScript(group, name);
+    if (coScript == nullptr) {
+        qWarning() << "ControllerEngine: Unknown control" << group << name
+                   << ", returning undefined";
+        return QScriptValue();
+    }
+
+    ControlObject* pControl = ControlObject::getControl(coScript->getKey());
+    return m_pEngine->newQObject(
+            new ScriptControlHandle(this, coScript, pControl),
+            QScriptEngine::ScriptOwnership);
+}
+
+ScriptControlHandle::ScriptControlHandle(ControllerEngine* pEngine,
+                                         ControlObjectScript* pControlScript,
+                                         ControlObject* pControl)
+        : m_pEngine(pEngine),
+          m_pControlScript(pControlScript),
+          m_pControl(pControl) {
+}
+
+QString ScriptControlHandle::readGroup() const {
+    return m_pControlScript->getKey().group;
+}
+
+QString ScriptControlHandle::readKey() const {
+    return m_pControlScript->getKey().item;
+}
+
+double ScriptControlHandle::get() const {
+    return m_pControlScript->get();
+}
+
+void ScriptControlHandle::set(double newValue) {
+    if (isnan(newValue)) {
+        qWarning() << "ControllerEngine: script setting" << m_pControlScript->getKey()
+                   << "to NotANumber, ignoring.";
+        return;
+    }
+    m_pEngine->setControlValue(m_pControlScript, m_pControl, newValue);
+}
+
+double ScriptControlHandle::getParameter() const {
+    return m_pControlScript->getParameter();
+}
+
+void ScriptControlHandle::setParameter(double newParameter) {
+    if (isnan(newParameter)) {
+        qWarning() << "ControllerEngine: script setting" << m_pControlScript->getKey()
+                   << "to NotANumber, ignoring.";
+        return;
+    }
+    m_pEngine->setControlParameter(m_pControlScript, m_pControl, newParameter);
+}
+
 /* -------- ------------------------------------------------------
    Purpose: qDebugs script output so it ends up in mixxx.log
    Input:   String to log
@@ -11,6 +11,7 @@
 #include <QTimerEvent>
 #include <QFileSystemWatcher>
 #include <QMessageBox>
+#include <QPointer>
 #include <QtScript>
 
 #include "bytearrayclass.h"
@@ -24,6 +25,7 @@
 
 // Forward declaration(s)
 class Controller;
+class ControlObject;
 class ControlObjectScript;
 class ControllerEngine;
 
@@ -77,6 +79,34 @@ class ScriptConnectionInvokableWrapper : public QObject {
     bool m_isConnected;
 };
 
+// ScriptControlHandle gives scripts access to a single control that is
+// looked up only once by engine.getControl(). Its methods skip the hashing of
+// the group and key strings that engine.getValue() and engine.setValue() do
+// on every call, which adds up for jog wheels and LED feedback that access
+// the same controls many times per second.
+class ScriptControlHandle : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(QString group READ readGroup)
+    Q_PROPERTY(QString key READ readKey)
+  public:
+    ScriptControlHandle(ControllerEngine* pEngine,
+                        ControlObjectScript* pControlScript,
+                        ControlObject* pControl);
+    QString readGroup() const;
+    QString readKey() const;
+    Q_INVOKABLE double get() const;
+    Q_INVOKABLE void set(double newValue);
+    Q_INVOKABLE double getParameter() const;
+    Q_INVOKABLE void setParameter(double newParameter);
+
+  private:
+    ControllerEngine* m_pEngine;
+    // Owned by m_pEngine, which outlives its scripts
+    ControlObjectScript* m_pControlScript;
+    // The control may be deleted while the script keeps the handle
+    QPointer<ControlObject> m_pControl;
+};
+
 class ControllerEngine : public QObject {
     Q_OBJECT
   public:
@@ -106,6 +136,12 @@ class ControllerEngine : public QObject {
     bool removeScriptConnection(const ScriptConnection conn);
     void triggerScriptConnection(const ScriptConnection conn);
 
+    // Set the control unless soft takeover ignores the new value
+    void setControlValue(ControlObjectScript* coScript, ControlObject* pControl,
+                         double newValue);
+    void setControlParameter(ControlObjectScript* coScript,
+                             ControlObject* pControl, double newParameter);
+
   protected:
     Q_INVOKABLE double getValue(QString group, QString name);
     Q_INVOKABLE void setValue(QString group, QString name, double newValue);
@@ -115,6 +151,7 @@ class ControllerEngine : public QObject {
     Q_INVOKABLE void reset(QString group, QString name);
     Q_INVOKABLE double getDefaultValue(QString group, QString name);
     Q_INVOKABLE double getDefaultParameter(QString group, QString name);
+    Q_INVOKABLE QScriptValue getControl(QString group, QString name);
     Q_INVOKABLE QScriptValue makeConnection(QString group, QString name,
                                             const QScriptValue callback);
     // DEPRECATED: Use makeConnection instead.
@@ -144,7 +181,10 @@ class ControllerEngine : public QObject {
     // Evaluate a script file
     bool evaluate(const QString& filepath);
 
-    // Execute a basic MIDI message callback.
+    // Execute a basic MIDI message callback. The timestamp is passed as the
+    // last argument in milliseconds. Only the differences between the
+    // timestamps of one device are meaningful, e.g. to compute the speed of a
+    // jog wheel independent of when the messages are processed.
     bool execute(QScriptValue function,
                  unsigned char channel,
                  unsigned char control,
@@ -153,7 +193,8 @@ class ControllerEngine : public QObject {
                  const QString& group,
                  mixxx::Duration timestamp);
 
-    // Execute a byte array callback.
+    // Execute a byte array callback. The timestamp is passed as the last
+    // argument in milliseconds, like for MIDI messages.
     bool execute(QScriptValue function, const QByteArray data,
                  mixxx::Duration timestamp);
 
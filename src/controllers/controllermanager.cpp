@@ -30,7 +30,9 @@
 namespace {
 // http://developer.qt.nokia.com/wiki/Threads_Events_QObjects
 
-// Poll every 1ms (where possible) for good controller response
+// Poll every 1ms (where possible) for good controller response. Only
+// PortMidi input devices are polled, the other backends read their input in
+// threads of their own that wake up when data arrives.
 #ifdef __LINUX__
 // Many Linux distros ship with the system tick set to 250Hz so 1ms timer
 // reportedly causes CPU hosage. See Bug #990992 rryan 6/2012
@@ -0,0 +1,49 @@
+#include "controllers/controlleroutputscheduler.h"
+
+#include "util/assert.h"
+#include "util/math.h"
+
+ControllerOutputScheduler::ControllerOutputScheduler()
+        : m_maxMessagesPerFrame(0) {
+}
+
+void ControllerOutputScheduler::setMaxMessagesPerFrame(int maxMessagesPerFrame) {
+    DEBUG_ASSERT(maxMessagesPerFrame >= 0);
+    m_maxMessagesPerFrame = maxMessagesPerFrame;
+}
+
+bool ControllerOutputScheduler::schedule(quint32 address, const QByteArray& message) {
+    auto it = m_messages.find(address);
+    if (it != m_messages.end()) {
+        // Keep the position in the queue, so a control that changes
+        // continuously does not starve the others.
+        it.value() = message;
+        return false;
+    }
+    m_messages.insert(address, message);
+    m_addresses.enqueue(address);
+    return true;
+}
+
+QList<ControllerOutputScheduler::Message> ControllerOutputScheduler::takeFrame() {
+    if (m_maxMessagesPerFrame > 0) {
+        return take(m_maxMessagesPerFrame);
+    }
+    return takeAll();
+}
+
+QList<ControllerOutputScheduler::Message> ControllerOutputScheduler::takeAll() {
+    return take(m_addresses.size());
+}
+
+QList<ControllerOutputScheduler::Message> ControllerOutputScheduler::take(int count) {
+    QList<Message> messages;
+    count = math_min(count, m_addresses.size());
+    messages.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const quint32 address = m_addresses.dequeue();
+        messages.append(Message(address, m_messages.take(address)));
+    }
+    DEBUG_ASSERT(m_messages.size() == m_addresses.size());
+    return messages;
+}
@@ -0,0 +1,51 @@
+#ifndef CONTROLLEROUTPUTSCHEDULER_H
+#define CONTROLLEROUTPUTSCHEDULER_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QQueue>
+
+// Collects the output messages of a controller until the end of a frame, so
+// that a slow link, e.g. USB MIDI, is not flooded by LEDs and displays that
+// change many times per second. Each message has an address, e.g. the status
+// and control of a MIDI message for an LED or the ID of an HID report. A
+// message replaces the pending message to the same address, so only the
+// latest state is sent. The messages are sent in the order in which their
+// addresses have been scheduled first.
+class ControllerOutputScheduler {
+  public:
+    typedef QPair<quint32, QByteArray> Message;
+
+    ControllerOutputScheduler();
+
+    // Limits the number of messages per frame, the remaining messages are
+    // deferred to the next frames. 0 means no limit.
+    void setMaxMessagesPerFrame(int maxMessagesPerFrame);
+
+    // Returns false if the message replaces a pending message
+    bool schedule(quint32 address, const QByteArray& message);
+
+    bool isEmpty() const {
+        return m_addresses.isEmpty();
+    }
+    int size() const {
+        return m_addresses.size();
+    }
+
+    // Removes the messages of the next frame and returns them
+    QList<Message> takeFrame();
+    // Removes all pending messages and returns them, e.g. when the device is
+    // about to be closed
+    QList<Message> takeAll();
+
+  private:
+    QList<Message> take(int count);
+
+    int m_maxMessagesPerFrame;
+    QQueue<quint32> m_addresses;
+    QHash<quint32, QByteArray> m_messages;
+};
+
+#endif // CONTROLLEROUTPUTSCHEDULER_H
@@ -12,12 +12,61 @@
 #include "util/path.h" // for PATH_MAX on Windows
 #include "controllers/hid/hidcontroller.h"
 #include "controllers/defs_controllers.h"
+#include "util/compatibility.h"
 #include "util/trace.h"
 #include "controllers/controllerdebug.h"
 #include "util/time.h"
 
+namespace {
+
+// The reader wakes up this often while the device is idle to check if it
+// has been stopped, which delays closing the device by at most this time.
+const int kReadTimeoutMillis = 100;
+
+} // anonymous namespace
+
+HidReader::HidReader(hid_device* device)
+        : QThread(),
+          m_pHidDevice(device),
+          m_stop(0) {
+}
+
+HidReader::~HidReader() {
+}
+
+void HidReader::stop() {
+    m_stop = 1;
+}
+
+void HidReader::run() {
+    // m_stop is not reset here, stop() may be called before the thread
+    // has started.
+    unsigned char data[255];
+
+    while (atomicLoadAcquire(m_stop) == 0) {
+        int result = hid_read_timeout(m_pHidDevice, data, sizeof(data),
+                                      kReadTimeoutMillis);
+        // Take the timestamp before the report is queued for the controller
+        // thread, which may be busy with the scripts of earlier reports.
+        mixxx::Duration timestamp = mixxx::Time::elapsed();
+        if (result > 0) {
+            Trace process("HidReader process packet");
+            QByteArray outData(reinterpret_cast<char*>(data), result);
+            emit incomingData(outData, timestamp);
+        } else if (result < 0) {
+            // The device is gone, e.g. unplugged. Retrying would only spin.
+            qWarning() << "Unable to read from HID device:"
+                       << HidController::safeDecodeWideString(
+                                  hid_error(m_pHidDevice), 512);
+            break;
+        }
+    }
+    qDebug() << "Stopped Reader";
+}
+
 HidController::HidController(const hid_device_info deviceInfo)
-        : m_pHidDevice(NULL) {
+        : m_pHidDevice(NULL),
+          m_pReader(NULL) {
     // Copy required variables from deviceInfo, which will be freed after
     // this class is initialized by caller.
     hid_vendor_id = deviceInfo.vendor_id;
@@ -213,15 +262,23 @@ int HidController::open() {
         return -1;
     }
 
-    // Set hid controller to non-blocking
-    if (hid_set_nonblocking(m_pHidDevice, 1) != 0) {
-        qWarning() << "Unable to set HID device " << getName() << " to non-blocking";
-        return -1;
-    }
-
     setOpen(true);
     startEngine();
 
+    if (m_pReader != NULL) {
+        qWarning() << "HidReader already present for" << getName();
+    } else {
+        m_pReader = new HidReader(m_pHidDevice);
+        m_pReader->setObjectName(QString("HidReader %1").arg(getName()));
+
+        connect(m_pReader, SIGNAL(incomingData(QByteArray, mixxx::Duration)),
+                this, SLOT(receive(QByteArray, mixxx::Duration)));
+
+        // Controller input needs to be prioritized since it can affect the
+        // audio directly, like when scratching
+        m_pReader->start(QThread::HighPriority);
+    }
+
     return 0;
 }
 
@@ -233,6 +290,20 @@ int HidController::close() {
 
     qDebug() << "Shutting down HID device" << getName();
 
+    // Stop the reading thread
+    if (m_pReader == NULL) {
+        qWarning() << "HidReader not present for" << getName()
+                   << "yet the device is open!";
+    } else {
+        disconnect(m_pReader, SIGNAL(incomingData(QByteArray, mixxx::Duration)),
+                   this, SLOT(receive(QByteArray, mixxx::Duration)));
+        m_pReader->stop();
+        controllerDebug("  Waiting on reader to finish");
+        m_pReader->wait();
+        delete m_pReader;
+        m_pReader = NULL;
+    }
+
     // Stop controller engine here to ensure it's done before the device is closed
     //  in case it has any final parting messages
     stopEngine();
@@ -244,38 +315,37 @@ int HidController::close() {
     return 0;
 }
 
-bool HidController::poll() {
-    Trace hidRead("HidController poll");
-
-    int result = hid_read(m_pHidDevice, m_pPollData, sizeof(m_pPollData) / sizeof(m_pPollData[0]));
-    if (result == -1) {
-        return false;
-    } else if (result > 0) {
-        Trace process("HidController process packet");
-        QByteArray outData(reinterpret_cast<char*>(m_pPollData), result);
-        receive(outData, mixxx::Time::elapsed());
+void HidController::send(QList<int> data, unsigned int length, unsigned int reportID) {
+    Q_UNUSED(length);
+    QByteArray temp;
+    foreach (int datum, data) {
+        temp.append(datum);
     }
-
-    return true;
-}
-
-bool HidController::isPolling() const {
-    return isOpen();
+    send(temp, reportID);
 }
 
-void HidController::send(QList<int> data, unsigned int length, unsigned int reportID) {
+void HidController::scheduleSend(QList<int> data, unsigned int length,
+                                 unsigned int reportID) {
+    if (!isOutputScheduling()) {
+        send(data, length, reportID);
+        return;
+    }
     Q_UNUSED(length);
     QByteArray temp;
     foreach (int datum, data) {
         temp.append(datum);
     }
-    send(temp, reportID);
+    scheduleOutput(reportID, temp);
 }
 
 void HidController::send(QByteArray data) {
     send(data, 0);
 }
 
+void HidController::sendScheduledOutput(quint32 address, const QByteArray& message) {
+    send(message, address);
+}
+
 void HidController::send(QByteArray data, unsigned int reportID) {
     // Append the Report ID to the beginning of data[] per the API..
     data.prepend(reportID);
@@ -11,12 +11,35 @@
 #include <hidapi.h>
 
 #include <QAtomicInt>
+#include <QThread>
 
 #include "controllers/controller.h"
 #include "controllers/hid/hidcontrollerpreset.h"
 #include "controllers/hid/hidcontrollerpresetfilehandler.h"
 #include "util/duration.h"
 
+// Reads the input reports of an HID device in a thread of its own. It blocks
+// until a report arrives, so the device is neither polled nor does a report
+// wait for the next poll cycle.
+class HidReader : public QThread {
+    Q_OBJECT
+  public:
+    HidReader(hid_device* device);
+    ~HidReader() override;
+
+    void stop();
+
+  signals:
+    void incomingData(QByteArray data, mixxx::Duration timestamp);
+
+  protected:
+    void run() override;
+
+  private:
+    hid_device* m_pHidDevice;
+    QAtomicInt m_stop;
+};
+
 class HidController final : public Controller {
     Q_OBJECT
   public:
@@ -52,19 +75,22 @@ class HidController final : public Controller {
 
   protected:
     Q_INVOKABLE void send(QList<int> data, unsigned int length, unsigned int reportID = 0);
+    // Like send(), but with output scheduling enabled the report replaces a
+    // pending report with the same report ID, because a report usually
+    // contains the state of all LEDs or a whole display.
+    Q_INVOKABLE void scheduleSend(QList<int> data, unsigned int length,
+                                  unsigned int reportID = 0);
 
   private slots:
     int open() override;
     int close() override;
 
-    bool poll() override;
-    bool isPolling() const override;
-
   private:
     // For devices which only support a single report, reportID must be set to
     // 0x0.
     void send(QByteArray data) override;
     void virtual send(QByteArray data, unsigned int reportID);
+    void sendScheduledOutput(quint32 address, const QByteArray& message) override;
 
     // Returns a pointer to the currently loaded controller preset. For internal
     // use only.
@@ -89,9 +115,8 @@ class HidController final : public Controller {
 
     QString m_sUID;
     hid_device* m_pHidDevice;
+    HidReader* m_pReader;
     HidControllerPreset m_preset;
-
-    unsigned char m_pPollData[255];
 };
 
 #endif
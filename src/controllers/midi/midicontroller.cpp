@@ -161,6 +161,25 @@ void MidiController::destroyOutputHandlers() {
     }
 }
 
+void MidiController::scheduleShortMsg(unsigned char status,
+                                      unsigned char byte1, unsigned char byte2) {
+    if (!isOutputScheduling()) {
+        sendShortMsg(status, byte1, byte2);
+        return;
+    }
+    QByteArray message(3, 0);
+    message[0] = status;
+    message[1] = byte1;
+    message[2] = byte2;
+    scheduleOutput((static_cast<quint32>(status) << 8) | byte1, message);
+}
+
+void MidiController::sendScheduledOutput(quint32 address, const QByteArray& message) {
+    Q_UNUSED(address);
+    DEBUG_ASSERT(message.size() == 3);
+    sendShortMsg(message[0], message[1], message[2]);
+}
+
 void MidiController::learnTemporaryInputMappings(const MidiInputMappings& mappings) {
     foreach (const MidiInputMapping& mapping, mappings) {
         m_temporaryInputMappings.insert(mapping.key.key, mapping);
@@ -230,7 +249,6 @@ void MidiController::processInputMapping(const MidiInputMapping& mapping,
                                          unsigned char control,
                                          unsigned char value,
                                          mixxx::Duration timestamp) {
-    Q_UNUSED(timestamp);
     unsigned char channel = MidiUtils::channelFromStatus(status);
     unsigned char opCode = MidiUtils::opCodeFromStatus(status);
 
@@ -240,7 +258,7 @@ void MidiController::processInputMapping(const MidiInputMapping& mapping,
             return;
         }
 
-        QScriptValue function = pEngine->wrapFunctionCode(mapping.control.item, 5);
+        QScriptValue function = pEngine->wrapFunctionCode(mapping.control.item, 6);
         if (!pEngine->execute(function, channel, control, value, status,
                               mapping.control.group, timestamp)) {
             qDebug() << "MidiController: Invalid script function"
@@ -485,7 +503,7 @@ void MidiController::processInputMapping(const MidiInputMapping& mapping,
         if (pEngine == NULL) {
             return;
         }
-        QScriptValue function = pEngine->wrapFunctionCode(mapping.control.item, 2);
+        QScriptValue function = pEngine->wrapFunctionCode(mapping.control.item, 3);
         if (!pEngine->execute(function, data, timestamp)) {
             qDebug() << "MidiController: Invalid script function"
                      << mapping.control.item;
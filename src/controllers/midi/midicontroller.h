@@ -59,6 +59,12 @@ class MidiController : public Controller {
     Q_INVOKABLE virtual void sendShortMsg(unsigned char status,
                                           unsigned char byte1, unsigned char byte2) = 0;
 
+    // Like sendShortMsg(), but with output scheduling enabled the message
+    // replaces a pending message with the same status and control, e.g. to
+    // update an LED. Message sequences like NRPNs must not be scheduled.
+    Q_INVOKABLE void scheduleShortMsg(unsigned char status,
+                                      unsigned char byte1, unsigned char byte2);
+
     // Alias for send()
     // The length parameter is here for backwards compatibility for when scripts
     // were required to specify it.
@@ -92,6 +98,8 @@ class MidiController : public Controller {
                              const QByteArray& data,
                              mixxx::Duration timestamp);
 
+    void sendScheduledOutput(quint32 address, const QByteArray& message) override;
+
     double computeValue(MidiOptions options, double _prevmidivalue, double _newmidivalue);
     void createOutputHandlers();
     void updateAllOutputs();
@@ -109,7 +117,7 @@ class MidiController : public Controller {
     SoftTakeoverCtrl m_st;
     QList<QPair<MidiInputMapping, unsigned char> > m_fourteen_bit_queued_mappings;
 
-    // So it can access sendShortMsg()
+    // So it can access sendShortMsg() and scheduleShortMsg()
     friend class MidiOutputHandler;
     friend class MidiControllerTest;
 };
@@ -56,8 +56,10 @@ void MidiOutputHandler::controlChanged(double value) {
         controllerDebug("sending MIDI bytes:" << m_mapping.output.status
                      << "," << m_mapping.output.control << ","
                      << byte3);
-        m_pController->sendShortMsg(m_mapping.output.status,
-                                    m_mapping.output.control, byte3);
+        // The mapped control is an LED or a display, so with output
+        // scheduling only its latest state is sent.
+        m_pController->scheduleShortMsg(m_mapping.output.status,
+                                        m_mapping.output.control, byte3);
         m_lastVal = static_cast<int>(byte3);
     }
 }
@@ -80,8 +80,10 @@ class PortMidiController : public MidiController {
     // 0xf7.
     void send(QByteArray data) override;
 
+    // PortMidi has no way to wait for input, so open input devices are
+    // polled. Output-only devices don't need to keep the poll timer running.
     bool isPolling() const override {
-        return true;
+        return m_pInputDevice && m_pInputDevice->isOpen();
     }
 
     // For testing only so that test fixtures can install mock PortMidiDevices.
@@ -31,6 +31,9 @@ EffectManifestPointer EchoEffect::getManifest() {
 
     pManifest->setAddDryToWet(true);
     pManifest->setEffectRampsFromDry(true);
+    // Keep the delay buffers of the master and headphone outputs of one
+    // input channel when it is disabled
+    pManifest->setSpareStateCount(2);
 
     pManifest->setId(getId());
     pManifest->setName(QObject::tr("Echo"));
@@ -29,6 +29,15 @@ class EchoGroupState : public EffectState {
                 * bufferParameters.sampleRate() * bufferParameters.channelCount());
     };
 
+    bool reset(const mixxx::EngineParameters& bufferParameters) override {
+        if (delay_buf.size() != static_cast<SINT>(kMaxDelaySeconds
+                * bufferParameters.sampleRate() * bufferParameters.channelCount())) {
+            audioParametersChanged(bufferParameters);
+        }
+        clear();
+        return true;
+    }
+
     void clear() {
         delay_buf.clear();
         prev_send = 0.0f;
@@ -14,6 +14,9 @@ EffectManifestPointer ReverbEffect::getManifest() {
     EffectManifestPointer pManifest(new EffectManifest());
     pManifest->setAddDryToWet(true);
     pManifest->setEffectRampsFromDry(true);
+    // Keep the reverb states of the master and headphone outputs of one
+    // input channel when it is disabled
+    pManifest->setSpareStateCount(2);
 
     pManifest->setId(getId());
     pManifest->setName(QObject::tr("Reverb"));
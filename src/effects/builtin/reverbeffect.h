@@ -20,9 +20,21 @@ class ReverbGroupState : public EffectState {
   public:
     ReverbGroupState(const mixxx::EngineParameters& bufferParameters)
         : EffectState(bufferParameters),
+          sampleRate(0),
           sendPrevious(0) {
     }
 
+    bool reset(const mixxx::EngineParameters& bufferParameters) override {
+        // The reverb is initialized for a different sample rate by the
+        // next call of processChannel(). Otherwise only clear its delay
+        // lines instead of reallocating them.
+        if (sampleRate == bufferParameters.sampleRate()) {
+            reverb.activate();
+        }
+        sendPrevious = 0;
+        return true;
+    }
+
     void engineParametersChanged(const mixxx::EngineParameters& bufferParameters) {
         sampleRate = bufferParameters.sampleRate();
         sendPrevious = 0;
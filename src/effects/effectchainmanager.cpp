@@ -219,6 +219,7 @@ void EffectChainManager::loadEffectChains() {
             if (pChain) { // null = ejected chains.
                 EffectChainSlotPointer pChainSlot = getStandardEffectRack(0)->getEffectChainSlot(i);
                 if (pChainSlot) {
+                    EffectsRequestBatch batch(m_pEffectsManager);
                     pChainSlot->loadEffectChainToSlot(pChain);
                     pChainSlot->loadChainSlotFromXml(chainElement);
                     pChain->addToEngine(getStandardEffectRack(0)->getEngineEffectRack(), i);
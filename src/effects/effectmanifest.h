@@ -29,7 +29,8 @@ class EffectManifest final {
           m_isMasterEQ(false),
           m_effectRampsFromDry(false),
           m_bAddDryToWet(false),
-          m_metaknobDefault(0.5) {
+          m_metaknobDefault(0.5),
+          m_spareStateCount(0) {
     }
 
     const QString& id() const {
@@ -142,6 +143,16 @@ class EffectManifest final {
         m_metaknobDefault = metaknobDefault;
     }
 
+    // The number of EffectStates that are kept for reuse when an input
+    // channel is disabled. Only worthwhile for effects with large states
+    // that implement EffectState::reset().
+    int spareStateCount() const {
+        return m_spareStateCount;
+    }
+    void setSpareStateCount(int spareStateCount) {
+        m_spareStateCount = spareStateCount;
+    }
+
     QString backendName() {
         switch (m_backendType) {
             case EffectBackendType::BuiltIn:
@@ -194,6 +205,7 @@ class EffectManifest final {
     bool m_effectRampsFromDry;
     bool m_bAddDryToWet;
     double m_metaknobDefault;
+    int m_spareStateCount;
 };
 
 #endif /* EFFECTMANIFEST_H */
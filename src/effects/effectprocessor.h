@@ -6,6 +6,7 @@
 #include <QHash>
 #include <QDebug>
 #include <QPair>
+#include <QVector>
 
 #include "util/types.h"
 #include "engine/engine.h"
@@ -38,6 +39,11 @@ class EngineEffect;
 // EffectStates are only allocated for input signals that are enabled at that
 // time. This allows for scaling up to an arbitrary number of input signals
 // without wasting a lot of memory.
+//
+// When an input signal is disabled, its EffectStates are not necessarily
+// deleted. Up to EffectManifest::spareStateCount() of them are kept and
+// handed out again when the next input signal is enabled, which avoids
+// reallocating large buffers, e.g. delay lines, whenever the routing changes.
 class EffectState {
   public:
     EffectState(const mixxx::EngineParameters& bufferParameters) {
@@ -45,6 +51,15 @@ class EffectState {
         Q_UNUSED(bufferParameters);
     };
     virtual ~EffectState() {};
+
+    // Called from the main thread to prepare a spare state for another
+    // input signal. Subclasses that support reuse must restore the state
+    // of a newly constructed instance for the given parameters and return
+    // true. Otherwise the spare state is deleted and a new one is allocated.
+    virtual bool reset(const mixxx::EngineParameters& bufferParameters) {
+        Q_UNUSED(bufferParameters);
+        return false;
+    }
 };
 
 // EffectProcessor is an abstract base class for interfacing with the main
@@ -65,6 +80,11 @@ class EffectProcessor {
     // Called from main thread for garbage collection after the last audio thread
     // callback executes process() with EffectEnableState::Disabling
     virtual void deleteStatesForInputChannel(const ChannelHandle* inputChannel) = 0;
+    // Called from main thread. The maximum number of EffectStates that are
+    // kept for reuse after their input channel has been disabled.
+    virtual void setSpareStateCount(int spareStateCount) {
+        Q_UNUSED(spareStateCount);
+    }
 
     // Take a buffer of audio samples as pInput, process the buffer according to
     // Effect-specific logic, and output it to the buffer pOutput. Both pInput
@@ -92,7 +112,8 @@ template <typename EffectSpecificState>
 class EffectProcessorImpl : public EffectProcessor {
   public:
     EffectProcessorImpl()
-      : m_pEffectsManager(nullptr) {
+      : m_pEffectsManager(nullptr),
+        m_spareStateCount(0) {
     }
     // Subclasses should not implement their own destructor. All state should
     // be stored in the EffectState subclass, not the EffectProcessorImpl subclass.
@@ -119,6 +140,8 @@ class EffectProcessorImpl : public EffectProcessor {
             inputChannelHandleNumber++;
         }
         m_channelStateMatrix.clear();
+        qDeleteAll(m_spareStates);
+        m_spareStates.clear();
     };
 
     // NOTE: Subclasses must implement the following static methods for
@@ -151,7 +174,8 @@ class EffectProcessorImpl : public EffectProcessor {
                            << "EffectState should have been preallocated in the"
                               "main thread.";
             }
-            pState = createSpecificState(bufferParameters);
+            // The spare states must not be touched from the engine thread
+            pState = allocateSpecificState(bufferParameters);
             m_channelStateMatrix[inputHandle][outputHandle] = pState;
         }
         processChannel(inputHandle, pState, pInput, pOutput, bufferParameters,
@@ -253,6 +277,14 @@ class EffectProcessorImpl : public EffectProcessor {
                 VERIFY_OR_DEBUG_ASSERT(pState != nullptr) {
                       continue;
                 }
+                if (m_spareStates.size() < m_spareStateCount) {
+                      if (kEffectDebugOutput) {
+                            qDebug() << "EffectProcessorImpl::deleteStatesForInputChannel"
+                                     << this << "keeping spare state" << pState;
+                      }
+                      m_spareStates.append(pState);
+                      continue;
+                }
                 if (kEffectDebugOutput) {
                       qDebug() << "EffectProcessorImpl::deleteStatesForInputChannel"
                                << this << "deleting state" << pState;
@@ -262,9 +294,34 @@ class EffectProcessorImpl : public EffectProcessor {
           stateMap.clear();
     };
 
-  private:
+    void setSpareStateCount(int spareStateCount) final {
+        DEBUG_ASSERT(spareStateCount >= 0);
+        m_spareStateCount = spareStateCount;
+        // Spare states are only ever added when an input channel is
+        // disabled, so excess states are trimmed immediately
+        while (m_spareStates.size() > m_spareStateCount) {
+            delete m_spareStates.takeLast();
+        }
+        m_spareStates.reserve(m_spareStateCount);
+    }
 
+  private:
+    // Called from main thread
     EffectSpecificState* createSpecificState(const mixxx::EngineParameters& bufferParameters) {
+        while (!m_spareStates.isEmpty()) {
+            EffectSpecificState* pState = m_spareStates.takeLast();
+            if (pState->reset(bufferParameters)) {
+                if (kEffectDebugOutput) {
+                    qDebug() << this << "EffectProcessorImpl reusing EffectState" << pState;
+                }
+                return pState;
+            }
+            delete pState;
+        }
+        return allocateSpecificState(bufferParameters);
+    };
+
+    EffectSpecificState* allocateSpecificState(const mixxx::EngineParameters& bufferParameters) {
         EffectSpecificState* pState = new EffectSpecificState(bufferParameters);
         if (kEffectDebugOutput) {
             qDebug() << this << "EffectProcessorImpl creating EffectState" << pState;
@@ -274,6 +331,10 @@ class EffectProcessorImpl : public EffectProcessor {
 
     EffectsManager* m_pEffectsManager;
     ChannelHandleMap<ChannelHandleMap<EffectSpecificState*>> m_channelStateMatrix;
+    // States of disabled input channels that are waiting for reuse. Only
+    // accessed from the main thread.
+    QVector<EffectSpecificState*> m_spareStates;
+    int m_spareStateCount;
 };
 
 #endif /* EFFECTPROCESSOR_H */
@@ -114,6 +114,8 @@ void EffectRack::loadNextChain(const unsigned int iChainSlotNumber,
     EffectChainPointer pNextChain = m_pEffectChainManager->getNextEffectChain(
             pLoadedChain);
 
+    // Apply the whole chain preset within a single engine callback
+    EffectsRequestBatch batch(m_pEffectsManager);
     pNextChain = EffectChain::clone(pNextChain);
     pNextChain->addToEngine(m_pEngineEffectRack, iChainSlotNumber);
     m_effectChainSlots[iChainSlotNumber]->loadEffectChainToSlot(pNextChain);
@@ -130,6 +132,8 @@ void EffectRack::loadPrevChain(const unsigned int iChainSlotNumber,
     EffectChainPointer pPrevChain = m_pEffectChainManager->getPrevEffectChain(
         pLoadedChain);
 
+    // Apply the whole chain preset within a single engine callback
+    EffectsRequestBatch batch(m_pEffectsManager);
     pPrevChain = EffectChain::clone(pPrevChain);
     pPrevChain->addToEngine(m_pEngineEffectRack, iChainSlotNumber);
     m_effectChainSlots[iChainSlotNumber]->loadEffectChainToSlot(pPrevChain);
@@ -157,6 +161,7 @@ void EffectRack::maybeLoadEffect(const unsigned int iChainSlotNumber,
     }
 
     if (loadNew) {
+        EffectsRequestBatch batch(m_pEffectsManager);
         EffectChainPointer pChain = pChainSlot->getOrCreateEffectChain(m_pEffectsManager);
         EffectPointer pEffect = m_pEffectsManager->instantiateEffect(id);
         pChain->replaceEffect(iEffectSlotNumber, pEffect);
@@ -174,6 +179,7 @@ void EffectRack::loadNextEffect(const unsigned int iChainSlotNumber,
     QString nextEffectId = m_pEffectsManager->getNextEffectId(effectId);
     EffectPointer pNextEffect = m_pEffectsManager->instantiateEffect(nextEffectId);
 
+    EffectsRequestBatch batch(m_pEffectsManager);
     EffectChainSlotPointer pChainSlot = m_effectChainSlots[iChainSlotNumber];
     EffectChainPointer pChain = pChainSlot->getOrCreateEffectChain(m_pEffectsManager);
     pChain->replaceEffect(iEffectSlotNumber, pNextEffect);
@@ -191,6 +197,7 @@ void EffectRack::loadPrevEffect(const unsigned int iChainSlotNumber,
     QString prevEffectId = m_pEffectsManager->getPrevEffectId(effectId);
     EffectPointer pPrevEffect = m_pEffectsManager->instantiateEffect(prevEffectId);
 
+    EffectsRequestBatch batch(m_pEffectsManager);
     EffectChainSlotPointer pChainSlot = m_effectChainSlots[iChainSlotNumber];
     EffectChainPointer pChain = pChainSlot->getOrCreateEffectChain(m_pEffectsManager);
     pChain->replaceEffect(iEffectSlotNumber, pPrevEffect);
@@ -12,11 +12,14 @@
 #include "engine/effects/engineeffectrack.h"
 #include "engine/effects/engineeffectchain.h"
 #include "util/assert.h"
+#include "util/math.h"
 
 namespace {
 const QString kEffectGroupSeparator = "_";
 const QString kGroupClose = "]";
 const unsigned int kEffectMessagPipeFifoSize = 2048;
+// Larger batches are split and are no longer applied atomically
+const int kMaxRequestBatchSize = kEffectMessagPipeFifoSize / 2;
 } // anonymous namespace
 
 
@@ -26,6 +29,7 @@ EffectsManager::EffectsManager(QObject* pParent, UserSettingsPointer pConfig,
           m_pChannelHandleFactory(pChannelHandleFactory),
           m_pEffectChainManager(new EffectChainManager(pConfig, this)),
           m_nextRequestId(0),
+          m_requestBatchDepth(0),
           m_pLoEqFreq(NULL),
           m_pHiEqFreq(NULL),
           m_underDestruction(false) {
@@ -39,6 +43,8 @@ EffectsManager::EffectsManager(QObject* pParent, UserSettingsPointer pConfig,
 
     m_pNumEffectsAvailable = new ControlObject(ConfigKey("[Master]", "num_effectsavailable"));
     m_pNumEffectsAvailable->setReadOnly();
+
+    m_requestBatch.reserve(kMaxRequestBatchSize);
 }
 
 EffectsManager::~EffectsManager() {
@@ -421,6 +427,11 @@ bool EffectsManager::writeRequest(EffectsRequest* request) {
         return false;
     }
 
+    if (m_requestBatchDepth > 0) {
+        appendToRequestBatch(request);
+        return true;
+    }
+
     // This is effectively only garbage collection at this point so only deal
     // with responses when writing new requests.
     processEffectsResponses();
@@ -435,6 +446,83 @@ bool EffectsManager::writeRequest(EffectsRequest* request) {
     return false;
 }
 
+void EffectsManager::beginRequestBatch() {
+    ++m_requestBatchDepth;
+}
+
+void EffectsManager::endRequestBatch() {
+    VERIFY_OR_DEBUG_ASSERT(m_requestBatchDepth > 0) {
+        return;
+    }
+    if (--m_requestBatchDepth == 0) {
+        writeRequestBatch();
+    }
+}
+
+void EffectsManager::appendToRequestBatch(EffectsRequest* request) {
+    QPair<const void*, int> target;
+    switch (request->type) {
+    case EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS:
+        target = qMakePair<const void*, int>(request->pTargetChain, -2);
+        break;
+    case EffectsRequest::SET_EFFECT_PARAMETERS:
+        target = qMakePair<const void*, int>(request->pTargetEffect, -1);
+        break;
+    case EffectsRequest::SET_PARAMETER_PARAMETERS:
+        target = qMakePair<const void*, int>(request->pTargetEffect,
+                request->SetParameterParameters.iParameter);
+        break;
+    default:
+        // Parameter updates must not be moved across structural changes
+        m_coalescableRequests.clear();
+        m_requestBatch.append(request);
+        return;
+    }
+    // Each of these requests contains the complete state of its target,
+    // so a previous update of the same target is obsolete.
+    const auto it = m_coalescableRequests.constFind(target);
+    if (it != m_coalescableRequests.constEnd()) {
+        delete m_requestBatch[it.value()];
+        m_requestBatch[it.value()] = request;
+    } else {
+        m_coalescableRequests.insert(target, m_requestBatch.size());
+        m_requestBatch.append(request);
+    }
+}
+
+void EffectsManager::writeRequestBatch() {
+    m_coalescableRequests.clear();
+    if (m_requestBatch.isEmpty()) {
+        return;
+    }
+
+    processEffectsResponses();
+
+    for (int begin = 0; begin < m_requestBatch.size(); begin += kMaxRequestBatchSize) {
+        const int batchSize = math_min(kMaxRequestBatchSize, m_requestBatch.size() - begin);
+        if (m_pRequestPipe->writeAvailable() < batchSize) {
+            // A partially written batch would never be applied
+            qWarning() << debugString()
+                       << "Discarding a batch of" << batchSize
+                       << "requests, the engine is not reading requests";
+            for (int i = begin; i < begin + batchSize; ++i) {
+                delete m_requestBatch[i];
+            }
+            continue;
+        }
+        m_requestBatch[begin]->batch_size = batchSize;
+        for (int i = begin; i < begin + batchSize; ++i) {
+            EffectsRequest* request = m_requestBatch[i];
+            request->request_id = m_nextRequestId++;
+            const bool written = m_pRequestPipe->writeMessage(request);
+            DEBUG_ASSERT(written);
+            Q_UNUSED(written);
+            m_activeRequests[request->request_id] = request;
+        }
+    }
+    m_requestBatch.clear();
+}
+
 void EffectsManager::processEffectsResponses() {
     if (m_pRequestPipe.isNull()) {
         return;
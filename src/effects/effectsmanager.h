@@ -7,6 +7,7 @@
 #include <QSet>
 #include <QScopedPointer>
 #include <QPair>
+#include <QVector>
 
 #include "preferences/usersettings.h"
 #include "control/controlpotmeter.h"
@@ -104,6 +105,14 @@ class EffectsManager : public QObject {
     // ownership of request and deletes it once a response is received.
     bool writeRequest(EffectsRequest* request);
 
+    // While a batch is open, requests are collected instead of being written
+    // to the engine immediately. Redundant parameter updates are coalesced.
+    // When the outermost batch is closed, all collected requests are written
+    // at once and the engine applies them within a single callback. Use
+    // EffectsRequestBatch instead of calling these directly.
+    void beginRequestBatch();
+    void endRequestBatch();
+
   signals:
     // TODO() Not connected. Can be used when we implement effect PlugIn loading at runtime
     void availableEffectsUpdated(EffectManifestPointer);
@@ -113,12 +122,16 @@ class EffectsManager : public QObject {
     void slotBackendRegisteredEffect(EffectManifestPointer pManifest);
 
   private:
+    friend class EffectsManagerTest;
+
     QString debugString() const {
         return "EffectsManager";
     }
 
     void processEffectsResponses();
     void collectGarbage(const EffectsRequest* pResponse);
+    void appendToRequestBatch(EffectsRequest* request);
+    void writeRequestBatch();
 
     ChannelHandleFactory* m_pChannelHandleFactory;
 
@@ -133,6 +146,13 @@ class EffectsManager : public QObject {
     qint64 m_nextRequestId;
     QHash<qint64, EffectsRequest*> m_activeRequests;
 
+    int m_requestBatchDepth;
+    QVector<EffectsRequest*> m_requestBatch;
+    // Indices of parameter updates in m_requestBatch that can be replaced by
+    // subsequent updates of the same target. Cleared whenever a request
+    // that changes the structure of racks, chains or effects is collected.
+    QHash<QPair<const void*, int>, int> m_coalescableRequests;
+
     ControlObject* m_pNumEffectsAvailable;
     // We need to create Control Objects for Equalizers' frequencies
     ControlPotmeter* m_pLoEqFreq;
@@ -143,5 +163,23 @@ class EffectsManager : public QObject {
     DISALLOW_COPY_AND_ASSIGN(EffectsManager);
 };
 
+// Collects all requests that are written to the EffectsManager during its
+// lifetime into a single batch, e.g. while loading an effect chain preset.
+class EffectsRequestBatch {
+  public:
+    explicit EffectsRequestBatch(EffectsManager* pEffectsManager)
+            : m_pEffectsManager(pEffectsManager) {
+        m_pEffectsManager->beginRequestBatch();
+    }
+    ~EffectsRequestBatch() {
+        m_pEffectsManager->endRequestBatch();
+    }
+
+  private:
+    EffectsManager* const m_pEffectsManager;
+
+    DISALLOW_COPY_AND_ASSIGN(EffectsRequestBatch);
+};
+
 
 #endif /* EFFECTSMANAGER_H */
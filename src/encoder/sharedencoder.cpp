@@ -0,0 +1,279 @@
+#include "encoder/sharedencoder.h"
+
+#include <QHash>
+#include <QMutexLocker>
+#include <cstring>
+
+#include "encoder/encodermp3settings.h"
+#include "encoder/encoderopussettings.h"
+#include "recording/defs_recording.h"
+#include "util/assert.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("SharedEncoder");
+
+// 43 s of a 192 kbit/s stream
+constexpr int kPacketFifoSize = 1 << 20;
+
+// The encoders of all subscribed settings by their key
+QMutex s_encodersMutex;
+QHash<QString, std::weak_ptr<SharedEncoder>> s_encoders;
+
+// Ogg pages with a granule position of 0 carry the stream headers, which
+// every subscriber needs before any audio data
+bool isOggHeaderPage(const unsigned char* header, int headerLen) {
+    if (headerLen < 14 || memcmp(header, "OggS", 4) != 0) {
+        return false;
+    }
+    for (int i = 6; i < 14; ++i) {
+        if (header[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+SharedEncoderSubscription::SharedEncoderSubscription(
+        std::shared_ptr<SharedEncoder> pEncoder,
+        EncoderCallback* pCallback)
+        : m_pEncoder(std::move(pEncoder)),
+          m_pCallback(pCallback),
+          m_packets(kPacketFifoSize),
+          m_overflowCount(0),
+          m_active(false) {
+}
+
+SharedEncoderSubscription::~SharedEncoderSubscription() {
+    m_pEncoder->removeSubscription(this);
+}
+
+void SharedEncoderSubscription::process(const CSAMPLE* pBuffer, int iBufferSize) {
+    m_pEncoder->encodeBuffer(this, pBuffer, iBufferSize);
+
+    const int readAvailable = m_packets.readAvailable();
+    if (readAvailable <= 0) {
+        return;
+    }
+    unsigned char* dataPtr1;
+    ring_buffer_size_t size1;
+    unsigned char* dataPtr2;
+    ring_buffer_size_t size2;
+    // We use size1 and size2, so we can ignore the return value
+    (void)m_packets.aquireReadRegions(readAvailable, &dataPtr1, &size1, &dataPtr2, &size2);
+    // The packets are passed on as a plain byte stream, which is all that
+    // a file or a network stream needs
+    m_pCallback->write(nullptr, dataPtr1, 0, size1);
+    if (size2 > 0) {
+        m_pCallback->write(nullptr, dataPtr2, 0, size2);
+    }
+    m_packets.releaseReadRegions(readAvailable);
+}
+
+void SharedEncoderSubscription::setActive(bool active) {
+    if (active) {
+        // Drop what is left from a previous connection
+        m_packets.flushReadData(m_packets.readAvailable());
+    }
+    m_pEncoder->setActive(this, active);
+}
+
+int SharedEncoderSubscription::takeOverflowCount() {
+    return m_overflowCount.fetchAndStoreRelaxed(0);
+}
+
+void SharedEncoderSubscription::enqueue(const unsigned char* header,
+        int headerLen,
+        const unsigned char* body,
+        int bodyLen) {
+    // Packets are dropped as a whole, a partial packet would corrupt the
+    // stream
+    if (m_packets.writeAvailable() < headerLen + bodyLen) {
+        m_overflowCount.fetchAndAddRelaxed(1);
+        return;
+    }
+    if (headerLen > 0) {
+        m_packets.write(header, headerLen);
+    }
+    m_packets.write(body, bodyLen);
+}
+
+SharedEncoder::SharedEncoder(const QString& key)
+        : m_key(key),
+          m_pPreferredDriver(nullptr),
+          m_pDriver(nullptr) {
+}
+
+SharedEncoder::~SharedEncoder() {
+    DEBUG_ASSERT(m_subscriptions.isEmpty());
+    kLogger.debug() << "Destroying encoder" << m_key;
+    // Deleting the encoder may still call write(), which does nothing
+    // without subscriptions
+    m_pEncoder.reset();
+}
+
+// static
+QString SharedEncoder::key(const EncoderSettings& settings, int sampleRate) {
+    // Only the option group of the format itself is used by its encoder
+    int modeOption = -1;
+    if (settings.getFormat() == ENCODING_MP3) {
+        modeOption = settings.getSelectedOption(
+                EncoderMp3Settings::ENCODING_MODE_GROUP);
+    } else if (settings.getFormat() == ENCODING_OPUS) {
+        modeOption = settings.getSelectedOption(
+                EncoderOpusSettings::BITRATE_MODE_GROUP);
+    }
+    return QString("%1 %2 %3 %4 %5 %6")
+            .arg(settings.getFormat(),
+                    QString::number(settings.getQuality()),
+                    QString::number(static_cast<int>(settings.getChannelMode())),
+                    QString::number(settings.getCompression()),
+                    QString::number(modeOption),
+                    QString::number(sampleRate));
+}
+
+// static
+SharedEncoderSubscriptionPointer SharedEncoder::subscribe(
+        EncoderSettingsPointer pSettings,
+        int sampleRate,
+        EncoderCallback* pCallback) {
+    const QString encoderKey = key(*pSettings, sampleRate);
+    QMutexLocker locker(&s_encodersMutex);
+    std::shared_ptr<SharedEncoder> pEncoder = s_encoders.value(encoderKey).lock();
+    if (!pEncoder) {
+        pEncoder = std::shared_ptr<SharedEncoder>(new SharedEncoder(encoderKey));
+        pEncoder->m_pEncoder = EncoderFactory::getFactory().createEncoder(
+                pSettings, pEncoder.get());
+        QString errorMessage;
+        if (pEncoder->m_pEncoder->initEncoder(sampleRate, errorMessage) < 0) {
+            kLogger.warning() << "Failed to initialize encoder" << encoderKey
+                              << errorMessage;
+            return SharedEncoderSubscriptionPointer();
+        }
+        s_encoders.insert(encoderKey, pEncoder);
+        kLogger.debug() << "Created encoder" << encoderKey;
+    }
+    return pEncoder->addSubscription(pEncoder, pCallback, false, false);
+}
+
+// static
+SharedEncoderSubscriptionPointer SharedEncoder::join(
+        const EncoderSettings& settings,
+        int sampleRate,
+        EncoderCallback* pCallback) {
+    const QString encoderKey = key(settings, sampleRate);
+    QMutexLocker locker(&s_encodersMutex);
+    std::shared_ptr<SharedEncoder> pEncoder = s_encoders.value(encoderKey).lock();
+    if (!pEncoder) {
+        return SharedEncoderSubscriptionPointer();
+    }
+    kLogger.debug() << "Joining encoder" << encoderKey;
+    return pEncoder->addSubscription(pEncoder, pCallback, false, true);
+}
+
+SharedEncoderSubscriptionPointer SharedEncoder::addSubscription(
+        std::shared_ptr<SharedEncoder> pThis,
+        EncoderCallback* pCallback,
+        bool active,
+        bool driving) {
+    DEBUG_ASSERT(pThis.get() == this);
+    SharedEncoderSubscriptionPointer pSubscription(
+            new SharedEncoderSubscription(std::move(pThis), pCallback));
+    QMutexLocker locker(&m_mutex);
+    m_subscriptions.append(pSubscription.get());
+    if (driving) {
+        m_pPreferredDriver = pSubscription.get();
+    }
+    locker.unlock();
+    if (active) {
+        pSubscription->setActive(true);
+    }
+    return pSubscription;
+}
+
+void SharedEncoder::removeSubscription(SharedEncoderSubscription* pSubscription) {
+    QMutexLocker locker(&m_mutex);
+    m_subscriptions.removeOne(pSubscription);
+    if (m_pPreferredDriver == pSubscription) {
+        m_pPreferredDriver = nullptr;
+    }
+    updateDriver();
+}
+
+void SharedEncoder::setActive(SharedEncoderSubscription* pSubscription, bool active) {
+    QMutexLocker locker(&m_mutex);
+    if (pSubscription->m_active == active) {
+        return;
+    }
+    pSubscription->m_active = active;
+    if (active && !m_streamHeader.isEmpty()) {
+        pSubscription->enqueue(nullptr,
+                0,
+                reinterpret_cast<const unsigned char*>(m_streamHeader.constData()),
+                m_streamHeader.size());
+    }
+    updateDriver();
+}
+
+void SharedEncoder::encodeBuffer(SharedEncoderSubscription* pSubscription,
+        const CSAMPLE* pBuffer,
+        int iBufferSize) {
+    QMutexLocker locker(&m_mutex);
+    if (pSubscription != m_pDriver || iBufferSize <= 0) {
+        return;
+    }
+    // The encoded packets are received by write()
+    m_pEncoder->encodeBuffer(pBuffer, iBufferSize);
+}
+
+void SharedEncoder::updateDriver() {
+    SharedEncoderSubscription* pDriver = nullptr;
+    if (m_pPreferredDriver && m_pPreferredDriver->m_active) {
+        pDriver = m_pPreferredDriver;
+    } else {
+        for (SharedEncoderSubscription* pSubscription : m_subscriptions) {
+            if (pSubscription->m_active) {
+                pDriver = pSubscription;
+                break;
+            }
+        }
+    }
+    if (m_pDriver != pDriver) {
+        // The streams of the subscribers have different latencies, so
+        // the audio may jump once here.
+        kLogger.debug() << "Changing the driver of encoder" << m_key;
+        m_pDriver = pDriver;
+    }
+}
+
+void SharedEncoder::write(const unsigned char* header,
+        const unsigned char* body,
+        int headerLen,
+        int bodyLen) {
+    // Called from encodeBuffer() with m_mutex held, or while the encoder is
+    // initialized or destroyed without any subscriptions
+    if (isOggHeaderPage(header, headerLen)) {
+        m_streamHeader.append(reinterpret_cast<const char*>(header), headerLen);
+        m_streamHeader.append(reinterpret_cast<const char*>(body), bodyLen);
+    }
+    for (SharedEncoderSubscription* pSubscription : m_subscriptions) {
+        if (pSubscription->m_active) {
+            pSubscription->enqueue(header, headerLen, body, bodyLen);
+        }
+    }
+}
+
+int SharedEncoder::tell() {
+    return -1;
+}
+
+void SharedEncoder::seek(int pos) {
+    Q_UNUSED(pos);
+}
+
+int SharedEncoder::filelen() {
+    return 0;
+}
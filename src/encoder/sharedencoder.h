@@ -0,0 +1,134 @@
+#pragma once
+
+#include <QAtomicInt>
+#include <QByteArray>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <memory>
+
+#include "encoder/encoder.h"
+#include "encoder/encodercallback.h"
+#include "util/class.h"
+#include "util/fifo.h"
+#include "util/types.h"
+
+class SharedEncoder;
+class SharedEncoderSubscription;
+typedef std::shared_ptr<SharedEncoderSubscription> SharedEncoderSubscriptionPointer;
+
+// A subscriber of a SharedEncoder. The encoded packets are queued in a FIFO
+// that belongs to this subscription only, so a subscriber that is not able
+// to keep up, e.g. because of a slow network connection, only loses its own
+// packets. Unsubscribes when it is destroyed.
+class SharedEncoderSubscription {
+  public:
+    ~SharedEncoderSubscription();
+
+    // Encodes the samples if this subscription currently drives the shared
+    // encoder and passes the packets that have been queued for it since the
+    // last call to its EncoderCallback. Samples passed by the other
+    // subscriptions are discarded; all subscribers receive the same mix.
+    void process(const CSAMPLE* pBuffer, int iBufferSize);
+
+    // Inactive subscriptions neither drive the encoder nor receive packets,
+    // e.g. a broadcast connection that is not connected yet.
+    void setActive(bool active);
+
+    // Returns the number of packets that have been dropped since the last
+    // call because the FIFO of this subscription was full
+    int takeOverflowCount();
+
+  private:
+    friend class SharedEncoder;
+
+    SharedEncoderSubscription(std::shared_ptr<SharedEncoder> pEncoder,
+            EncoderCallback* pCallback);
+
+    void enqueue(const unsigned char* header,
+            int headerLen,
+            const unsigned char* body,
+            int bodyLen);
+
+    const std::shared_ptr<SharedEncoder> m_pEncoder;
+    EncoderCallback* const m_pCallback;
+    // Written by the driving subscription while holding the lock of the
+    // SharedEncoder, read by the thread of this subscription.
+    FIFO<unsigned char> m_packets;
+    QAtomicInt m_overflowCount;
+    bool m_active;
+
+    DISALLOW_COPY_AND_ASSIGN(SharedEncoderSubscription);
+};
+
+// Shares one encoder between all subscribers with the same format, quality,
+// channel mode and sample rate, e.g. several broadcast connections that
+// stream the same mix to different servers, and a recording of it.
+//
+// The encoder is driven by the samples of one active subscription, the
+// others only receive its packets. The header pages of Ogg streams are
+// replayed to every subscription that becomes active. The encoder is never
+// flushed and it is destroyed together with its last subscription.
+class SharedEncoder : public EncoderCallback {
+  public:
+    ~SharedEncoder();
+
+    // Subscribes to the encoder with the given settings, which is created
+    // and initialized if there is none yet. Returns nullptr if the encoder
+    // could not be initialized. The subscription is inactive initially.
+    static SharedEncoderSubscriptionPointer subscribe(
+            EncoderSettingsPointer pSettings,
+            int sampleRate,
+            EncoderCallback* pCallback);
+    // Subscribes to an existing encoder with the given settings only, and
+    // returns nullptr if there is none. The subscription is inactive
+    // initially. Once activated, it drives the encoder, because it is meant
+    // for the recording in the engine side chain, which never waits for a
+    // network connection.
+    static SharedEncoderSubscriptionPointer join(
+            const EncoderSettings& settings,
+            int sampleRate,
+            EncoderCallback* pCallback);
+
+    // The key of all settings that are taken into account by the encoders
+    static QString key(const EncoderSettings& settings, int sampleRate);
+
+    // Called by the encoder with the encoded packets
+    void write(const unsigned char* header,
+            const unsigned char* body,
+            int headerLen,
+            int bodyLen) override;
+    // These are not used for streaming, but the interface requires them
+    int tell() override;
+    void seek(int pos) override;
+    int filelen() override;
+
+  private:
+    friend class SharedEncoderSubscription;
+
+    explicit SharedEncoder(const QString& key);
+
+    SharedEncoderSubscriptionPointer addSubscription(
+            std::shared_ptr<SharedEncoder> pThis,
+            EncoderCallback* pCallback,
+            bool active,
+            bool driving);
+    void removeSubscription(SharedEncoderSubscription* pSubscription);
+    void setActive(SharedEncoderSubscription* pSubscription, bool active);
+    void encodeBuffer(SharedEncoderSubscription* pSubscription,
+            const CSAMPLE* pBuffer,
+            int iBufferSize);
+    // Must be called with m_mutex held
+    void updateDriver();
+
+    const QString m_key;
+    EncoderPointer m_pEncoder;
+    QMutex m_mutex;
+    QList<SharedEncoderSubscription*> m_subscriptions;
+    SharedEncoderSubscription* m_pPreferredDriver;
+    SharedEncoderSubscription* m_pDriver;
+    // The header pages of Ogg streams
+    QByteArray m_streamHeader;
+
+    DISALLOW_COPY_AND_ASSIGN(SharedEncoder);
+};
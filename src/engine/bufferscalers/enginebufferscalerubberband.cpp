@@ -25,7 +25,9 @@ EngineBufferScaleRubberBand::EngineBufferScaleRubberBand(
         ReadAheadManager* pReadAheadManager)
         : m_pReadAheadManager(pReadAheadManager),
           m_buffer_back(SampleUtil::alloc(MAX_BUFFER_LEN)),
-          m_bBackwards(false) {
+          m_bBackwards(false),
+          m_underflowTagId(Stat::registerTag(
+                  "EngineBufferScaleRubberBand::getScaled underflow")) {
     m_retrieve_buffer[0] = SampleUtil::alloc(MAX_BUFFER_LEN);
     m_retrieve_buffer[1] = SampleUtil::alloc(MAX_BUFFER_LEN);
     initRubberBand();
@@ -223,8 +225,7 @@ double EngineBufferScaleRubberBand::scaleBuffer(
 
     if (remaining_frames > 0) {
         SampleUtil::clear(read, getAudioSignal().frames2samples(remaining_frames));
-        Counter counter("EngineBufferScaleRubberBand::getScaled underflow");
-        counter.increment();
+        Counter(m_underflowTagId).increment();
     }
 
     // framesRead is interpreted as the total number of virtual sample frames
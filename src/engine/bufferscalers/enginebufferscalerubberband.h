@@ -48,6 +48,8 @@ class EngineBufferScaleRubberBand : public EngineBufferScale {
 
     // Holds the playback direction
     bool m_bBackwards;
+
+    const int m_underflowTagId;
 };
 
 
@@ -0,0 +1,468 @@
+#include "engine/bufferscalers/enginebufferscalerubberbandlookahead.h"
+
+#include <rubberband/RubberBandStretcher.h>
+
+#include <QtDebug>
+
+#include "engine/engineworkerscheduler.h"
+#include "engine/readaheadmanager.h"
+#include "util/counter.h"
+#include "util/defs.h"
+#include "util/math.h"
+#include "util/sample.h"
+
+using RubberBand::RubberBandStretcher;
+
+namespace {
+
+// Large enough for the look-ahead including partially filled chunks
+constexpr int kInputChunkCount = 32;
+constexpr int kOutputChunkCount = 64;
+
+// The number of output buffers that are rendered in advance, limited
+// by kMaxLookAheadFrames for large buffer sizes.
+constexpr SINT kLookAheadBuffers = 3;
+constexpr SINT kMaxLookAheadFrames = 16 * RubberBandLookAheadChunk::kMaxFrames;
+
+// Rendering happens outside of the callback, which leaves room for
+// settings that are too expensive for EngineBufferScaleRubberBand.
+#if RUBBERBAND_API_MAJOR_VERSION > 2 || \
+        (RUBBERBAND_API_MAJOR_VERSION == 2 && RUBBERBAND_API_MINOR_VERSION >= 7)
+const RubberBandStretcher::Options kRubberBandOptions =
+        RubberBandStretcher::OptionProcessRealTime |
+        RubberBandStretcher::OptionEngineFiner;
+#else
+const RubberBandStretcher::Options kRubberBandOptions =
+        RubberBandStretcher::OptionProcessRealTime |
+        RubberBandStretcher::OptionWindowLong;
+#endif
+
+// The fallback plays right after seeking, in the callback, and needs to be
+// as inexpensive as EngineBufferScaleRubberBand.
+const RubberBandStretcher::Options kFallbackRubberBandOptions =
+        RubberBandStretcher::OptionProcessRealTime;
+
+}  // namespace
+
+RubberBandLookAheadWorker::RubberBandLookAheadWorker(
+        EngineBufferScaleRubberBandLookAhead* pScale)
+        : m_pScale(pScale),
+          m_stop(false) {
+}
+
+void RubberBandLookAheadWorker::run() {
+    QThread::currentThread()->setObjectName("RubberBandLookAheadWorker");
+    while (!m_stop.load()) {
+        m_semaRun.acquire();
+        if (m_stop.load()) {
+            break;
+        }
+        m_pScale->renderLookAhead();
+    }
+}
+
+void RubberBandLookAheadWorker::quitWait() {
+    m_stop = true;
+    m_semaRun.release();
+    wait();
+}
+
+EngineBufferScaleRubberBandLookAhead::EngineBufferScaleRubberBandLookAhead(
+        ReadAheadManager* pReadAheadManager)
+        : m_pReadAheadManager(pReadAheadManager),
+          m_inputChunks(kInputChunkCount),
+          m_outputChunks(kOutputChunkCount),
+          m_renderedInputFrames(0),
+          m_queuedOutputFrames(0),
+          m_generation(0),
+          m_bBackwards(false),
+          m_timeRatio(1.0),
+          m_pitchScale(1.0),
+          m_bLastReadFailed(false),
+          m_bScheduled(false),
+          m_underflowTagId(Stat::registerTag(
+                  "EngineBufferScaleRubberBandLookAhead::getScaled underflow")),
+          m_outputChunkOffset(0),
+          m_submittedInputFrames(0),
+          m_clearedInputFrames(0),
+          m_bPriming(true),
+          m_primingFramesToSkip(0),
+          m_bFallbackFlushed(false),
+          m_pCrossfadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
+          m_renderSampleRate(0),
+          m_renderGeneration(0),
+          m_renderTimeRatio(1.0),
+          m_worker(this) {
+    m_deinterleaved[0] = SampleUtil::alloc(RubberBandLookAheadChunk::kMaxFrames);
+    m_deinterleaved[1] = SampleUtil::alloc(RubberBandLookAheadChunk::kMaxFrames);
+    m_fallbackBuffer[0] = SampleUtil::alloc(RubberBandLookAheadChunk::kMaxFrames);
+    m_fallbackBuffer[1] = SampleUtil::alloc(RubberBandLookAheadChunk::kMaxFrames);
+    initRubberBand(getAudioSignal().sampleRate());
+    initFallbackRubberBand(getAudioSignal().sampleRate());
+    m_worker.start(QThread::HighPriority);
+}
+
+EngineBufferScaleRubberBandLookAhead::~EngineBufferScaleRubberBandLookAhead() {
+    m_worker.quitWait();
+    SampleUtil::free(m_deinterleaved[0]);
+    SampleUtil::free(m_deinterleaved[1]);
+    SampleUtil::free(m_fallbackBuffer[0]);
+    SampleUtil::free(m_fallbackBuffer[1]);
+    SampleUtil::free(m_pCrossfadeBuffer);
+}
+
+void EngineBufferScaleRubberBandLookAhead::setScheduler(
+        EngineWorkerScheduler* pScheduler) {
+    m_worker.setScheduler(pScheduler);
+    m_bScheduled = true;
+}
+
+void EngineBufferScaleRubberBandLookAhead::initRubberBand(SINT sampleRate) {
+    m_pRubberBand = std::make_unique<RubberBandStretcher>(
+            sampleRate,
+            getAudioSignal().channelCount(),
+            kRubberBandOptions);
+    m_pRubberBand->setMaxProcessSize(RubberBandLookAheadChunk::kMaxFrames);
+    // Preallocate buffers, see EngineBufferScaleRubberBand::initRubberBand()
+    m_pRubberBand->setTimeRatio(2.0);
+    m_pRubberBand->setTimeRatio(1.0);
+    m_renderSampleRate = sampleRate;
+}
+
+void EngineBufferScaleRubberBandLookAhead::initFallbackRubberBand(SINT sampleRate) {
+    m_pFallbackRubberBand = std::make_unique<RubberBandStretcher>(
+            sampleRate,
+            getAudioSignal().channelCount(),
+            kFallbackRubberBandOptions);
+    // The fallback receives the whole look-ahead while priming, not only
+    // the input it needs for the next buffer.
+    m_pFallbackRubberBand->setMaxProcessSize(kMaxLookAheadFrames);
+    m_pFallbackRubberBand->setTimeRatio(2.0);
+    m_pFallbackRubberBand->setTimeRatio(1.0);
+    m_bFallbackFlushed = false;
+}
+
+void EngineBufferScaleRubberBandLookAhead::setScaleParameters(double base_rate,
+                                                              double* pTempoRatio,
+                                                              double* pPitchRatio) {
+    // Negative speed means we are going backwards. pitch does not affect
+    // the playback direction.
+    m_bBackwards = *pTempoRatio < 0;
+
+    // Limit the minimum seek speed for the same reasons as
+    // EngineBufferScaleRubberBand.
+    const double kMinSeekSpeed = 1.0 / 128.0;
+    double speed_abs = fabs(*pTempoRatio);
+    if (speed_abs < kMinSeekSpeed) {
+        // Let the caller know we ignored their speed.
+        speed_abs = *pTempoRatio = 0;
+    }
+
+    // The new parameters are applied by the renderer with the next chunk
+    // of input.
+    double pitchScale = fabs(base_rate * *pPitchRatio);
+    if (pitchScale > 0) {
+        m_pitchScale = pitchScale;
+    }
+    double timeRatioInverse = base_rate * speed_abs;
+    if (timeRatioInverse > 0) {
+        m_timeRatio = 1.0 / timeRatioInverse;
+    }
+
+    // Used by other methods so we need to keep them up to date.
+    m_dBaseRate = base_rate;
+    m_dTempoRatio = speed_abs;
+    m_dPitchRatio = *pPitchRatio;
+}
+
+void EngineBufferScaleRubberBandLookAhead::setSampleRate(SINT iSampleRate) {
+    EngineBufferScale::setSampleRate(iSampleRate);
+    // The renderer recreates RubberBand for chunks with a new sample rate
+    initFallbackRubberBand(iSampleRate);
+    clear();
+}
+
+void EngineBufferScaleRubberBandLookAhead::clear() {
+    m_generation.store(m_generation.load() + 1);
+    // Drop all rendered output. Stale input chunks are skipped by the
+    // renderer and output chunks that it is rendering right now are
+    // skipped by readOutput().
+    while (m_outputChunks.read(&m_outputChunk, 1) == 1) {
+        m_queuedOutputFrames.fetch_sub(m_outputChunk.frames);
+    }
+    m_outputChunk.frames = 0;
+    m_outputChunkOffset = 0;
+    m_clearedInputFrames = m_submittedInputFrames;
+    m_bLastReadFailed = false;
+
+    // Play the fallback until the look-ahead is primed again
+    m_bPriming = true;
+    m_primingFramesToSkip = 0;
+    m_pFallbackRubberBand->reset();
+    m_bFallbackFlushed = false;
+}
+
+bool EngineBufferScaleRubberBandLookAhead::submitInput() {
+    if (m_inputChunks.writeAvailable() < 1) {
+        return false;
+    }
+    RubberBandLookAheadChunk& chunk = m_inputChunk;
+    const SINT samples = m_pReadAheadManager->getNextSamples(
+            // The value doesn't matter here. All that matters is we
+            // are going forward or backward.
+            (m_bBackwards ? -1.0 : 1.0) * m_dBaseRate * m_dTempoRatio,
+            chunk.samples,
+            getAudioSignal().frames2samples(RubberBandLookAheadChunk::kMaxFrames));
+    chunk.frames = getAudioSignal().samples2frames(samples);
+    chunk.flush = false;
+    if (chunk.frames == 0) {
+        if (!m_bLastReadFailed) {
+            m_bLastReadFailed = true;
+            return false;
+        }
+        // If we are at EOF this serves to get the last samples out of
+        // RubberBand.
+        chunk.flush = true;
+    }
+    m_bLastReadFailed = false;
+    chunk.generation = m_generation.load();
+    chunk.sampleRate = getAudioSignal().sampleRate();
+    chunk.timeRatio = m_timeRatio;
+    chunk.pitchScale = m_pitchScale;
+    m_submittedInputFrames += chunk.frames;
+    m_inputChunks.write(&chunk, 1);
+
+    if (m_bPriming && !m_bFallbackFlushed) {
+        // RubberBand handles checking whether these changes are no-ops.
+        m_pFallbackRubberBand->setPitchScale(chunk.pitchScale);
+        m_pFallbackRubberBand->setTimeRatio(chunk.timeRatio);
+        SampleUtil::deinterleaveBuffer(m_fallbackBuffer[0],
+                m_fallbackBuffer[1],
+                chunk.samples,
+                chunk.frames);
+        m_pFallbackRubberBand->process((const float* const*)m_fallbackBuffer,
+                chunk.frames, chunk.flush);
+        m_bFallbackFlushed = chunk.flush;
+    }
+    return !chunk.flush;
+}
+
+SINT EngineBufferScaleRubberBandLookAhead::readOutput(
+        CSAMPLE* pBuffer, SINT frames, double* pInputFrames) {
+    const int generation = m_generation.load();
+    SINT framesRead = 0;
+    while (framesRead < frames) {
+        if (m_outputChunkOffset >= m_outputChunk.frames) {
+            if (m_outputChunks.read(&m_outputChunk, 1) != 1) {
+                break;
+            }
+            m_queuedOutputFrames.fetch_sub(m_outputChunk.frames);
+            m_outputChunkOffset = 0;
+            if (m_outputChunk.generation != generation) {
+                m_outputChunkOffset = m_outputChunk.frames;
+                continue;
+            }
+        }
+        const SINT framesToCopy = math_min(
+                frames - framesRead, m_outputChunk.frames - m_outputChunkOffset);
+        if (pBuffer) {
+            SampleUtil::copy(
+                    pBuffer + getAudioSignal().frames2samples(framesRead),
+                    m_outputChunk.samples + getAudioSignal().frames2samples(m_outputChunkOffset),
+                    getAudioSignal().frames2samples(framesToCopy));
+        }
+        m_outputChunkOffset += framesToCopy;
+        framesRead += framesToCopy;
+        *pInputFrames += framesToCopy / m_outputChunk.timeRatio;
+    }
+    return framesRead;
+}
+
+SINT EngineBufferScaleRubberBandLookAhead::bufferedFrames() const {
+    // An estimate of the output that is rendered or will be rendered from
+    // the pending input of the current generation, without the frames that
+    // have already been played by the fallback.
+    const SINT pendingInputFrames = m_submittedInputFrames -
+            math_max(m_renderedInputFrames.load(), m_clearedInputFrames);
+    return (m_outputChunk.frames - m_outputChunkOffset) +
+            m_queuedOutputFrames.load() +
+            static_cast<SINT>(pendingInputFrames * m_timeRatio) -
+            m_primingFramesToSkip;
+}
+
+bool EngineBufferScaleRubberBandLookAhead::isPrimed(SINT frames) const {
+    // Stale output chunks are always followed by those of the current
+    // generation, so all queued frames are valid once the current chunk is.
+    return m_primingFramesToSkip == 0 &&
+            m_outputChunk.generation == m_generation.load() &&
+            (m_outputChunk.frames - m_outputChunkOffset) +
+                    m_queuedOutputFrames.load() >=
+            frames;
+}
+
+SINT EngineBufferScaleRubberBandLookAhead::readFallbackOutput(
+        CSAMPLE* pBuffer, SINT frames, double* pInputFrames) {
+    SINT framesRead = 0;
+    while (framesRead < frames) {
+        const SINT framesAvailable = m_pFallbackRubberBand->available();
+        if (framesAvailable <= 0) {
+            // The fallback is fed with the input of the look-ahead
+            if (m_bFallbackFlushed || !submitInput()) {
+                break;
+            }
+            continue;
+        }
+        const SINT framesToRead = math_min(framesAvailable,
+                math_min(frames - framesRead, RubberBandLookAheadChunk::kMaxFrames));
+        const SINT received = m_pFallbackRubberBand->retrieve(
+                (float* const*)m_fallbackBuffer, framesToRead);
+        SampleUtil::interleaveBuffer(
+                pBuffer + getAudioSignal().frames2samples(framesRead),
+                m_fallbackBuffer[0],
+                m_fallbackBuffer[1],
+                received);
+        framesRead += received;
+        *pInputFrames += received / m_timeRatio;
+    }
+    return framesRead;
+}
+
+double EngineBufferScaleRubberBandLookAhead::scaleBuffer(
+        CSAMPLE* pOutputBuffer,
+        SINT iOutputBufferSize) {
+    if (m_dBaseRate == 0.0 || m_dTempoRatio == 0.0) {
+        SampleUtil::clear(pOutputBuffer, iOutputBufferSize);
+        // No actual samples/frames have been read from the
+        // unscaled input buffer!
+        return 0.0;
+    }
+
+    const SINT outputFrames = getAudioSignal().samples2frames(iOutputBufferSize);
+    const SINT targetFrames = outputFrames +
+            math_min(kLookAheadBuffers * outputFrames, kMaxLookAheadFrames);
+    while (bufferedFrames() < targetFrames && submitInput()) {
+    }
+
+    double framesRead = 0.0;
+    SINT total_received_frames = 0;
+    if (m_bPriming) {
+        // Discard the look-ahead that has already been played by the
+        // fallback. Its input has already been accounted for.
+        double skippedInputFrames = 0.0;
+        m_primingFramesToSkip -= readOutput(
+                nullptr, m_primingFramesToSkip, &skippedInputFrames);
+    }
+    if (m_bPriming && !isPrimed(outputFrames)) {
+        total_received_frames = readFallbackOutput(
+                pOutputBuffer, outputFrames, &framesRead);
+        m_primingFramesToSkip += total_received_frames;
+    } else {
+        // The output may have been rendered with previous tempo ratios, so
+        // the consumed input is accounted per output chunk.
+        total_received_frames = readOutput(
+                pOutputBuffer, outputFrames, &framesRead);
+        if (m_bPriming) {
+            // Crossfade from the fallback, which has been playing the same
+            // input, to avoid a click due to their different latencies.
+            double fallbackInputFrames = 0.0;
+            const SINT fallbackFrames = readFallbackOutput(
+                    m_pCrossfadeBuffer, outputFrames, &fallbackInputFrames);
+            SampleUtil::clear(
+                    m_pCrossfadeBuffer + getAudioSignal().frames2samples(fallbackFrames),
+                    getAudioSignal().frames2samples(outputFrames - fallbackFrames));
+            SampleUtil::linearCrossfadeBuffers(pOutputBuffer,
+                    m_pCrossfadeBuffer,
+                    pOutputBuffer,
+                    iOutputBufferSize);
+            m_pFallbackRubberBand->reset();
+            m_bFallbackFlushed = false;
+            m_bPriming = false;
+        }
+    }
+
+    // Neither the look-ahead nor the fallback could provide enough output,
+    // e.g. because the input FIFO is full while the worker is behind.
+    const SINT remaining_frames = outputFrames - total_received_frames;
+    if (remaining_frames > 0) {
+        SampleUtil::clear(
+                pOutputBuffer + getAudioSignal().frames2samples(total_received_frames),
+                getAudioSignal().frames2samples(remaining_frames));
+        Counter(m_underflowTagId).increment();
+    }
+
+    if (m_bScheduled) {
+        m_worker.workReady();
+    }
+
+    return framesRead;
+}
+
+void EngineBufferScaleRubberBandLookAhead::renderLookAhead() {
+    const SINT maxQueuedOutputFrames =
+            kOutputChunkCount * RubberBandLookAheadChunk::kMaxFrames;
+    while (m_queuedOutputFrames.load() < maxQueuedOutputFrames) {
+        if (retrieveAvailable() > 0) {
+            continue;
+        }
+        if (m_outputChunks.writeAvailable() < 1) {
+            // Continue when the engine has caught up
+            return;
+        }
+        if (m_inputChunks.read(&m_renderChunk, 1) != 1) {
+            return;
+        }
+        m_renderedInputFrames.fetch_add(m_renderChunk.frames);
+        processChunk(m_renderChunk);
+    }
+}
+
+void EngineBufferScaleRubberBandLookAhead::processChunk(
+        const RubberBandLookAheadChunk& chunk) {
+    if (chunk.generation != m_generation.load()) {
+        // The look-ahead has been cleared since
+        return;
+    }
+    if (chunk.sampleRate != m_renderSampleRate) {
+        initRubberBand(chunk.sampleRate);
+    } else if (chunk.generation != m_renderGeneration) {
+        m_pRubberBand->reset();
+    }
+    m_renderGeneration = chunk.generation;
+
+    // RubberBand handles checking whether these changes are no-ops.
+    m_pRubberBand->setPitchScale(chunk.pitchScale);
+    m_pRubberBand->setTimeRatio(chunk.timeRatio);
+    m_renderTimeRatio = chunk.timeRatio;
+
+    SampleUtil::deinterleaveBuffer(
+            m_deinterleaved[0], m_deinterleaved[1], chunk.samples, chunk.frames);
+    m_pRubberBand->process((const float* const*)m_deinterleaved,
+                           chunk.frames, chunk.flush);
+    if (chunk.flush) {
+        // RubberBand needs to be reset after it has been flushed
+        while (retrieveAvailable() > 0) {
+        }
+        m_pRubberBand->reset();
+    }
+}
+
+SINT EngineBufferScaleRubberBandLookAhead::retrieveAvailable() {
+    const int frames_available = m_pRubberBand->available();
+    if (frames_available <= 0 || m_outputChunks.writeAvailable() < 1) {
+        return 0;
+    }
+    RubberBandLookAheadChunk& chunk = m_renderOutputChunk;
+    const SINT frames_to_read = math_min(
+            static_cast<SINT>(frames_available), RubberBandLookAheadChunk::kMaxFrames);
+    chunk.frames = m_pRubberBand->retrieve(
+            (float* const*)m_deinterleaved, frames_to_read);
+    chunk.generation = m_renderGeneration;
+    chunk.timeRatio = m_renderTimeRatio;
+    SampleUtil::interleaveBuffer(chunk.samples,
+                                 m_deinterleaved[0],
+                                 m_deinterleaved[1],
+                                 chunk.frames);
+    m_queuedOutputFrames.fetch_add(chunk.frames);
+    m_outputChunks.write(&chunk, 1);
+    return chunk.frames;
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+
+#include "engine/bufferscalers/enginebufferscale.h"
+#include "engine/engine.h"
+#include "engine/engineworker.h"
+#include "util/fifo.h"
+#include "util/memory.h"
+
+namespace RubberBand {
+class RubberBandStretcher;
+}  // namespace RubberBand
+
+class EngineBufferScaleRubberBandLookAhead;
+class EngineWorkerScheduler;
+class ReadAheadManager;
+
+// A block of interleaved samples that is passed between the engine thread
+// and the look-ahead renderer, tagged with the parameters it belongs to.
+struct RubberBandLookAheadChunk {
+    static constexpr SINT kMaxFrames = 256;
+
+    int generation = 0;
+    SINT sampleRate = 0;
+    double timeRatio = 1.0;
+    double pitchScale = 1.0;
+    SINT frames = 0;
+    bool flush = false;
+    CSAMPLE samples[kMaxFrames * mixxx::kEngineChannelCount];
+};
+
+class RubberBandLookAheadWorker : public EngineWorker {
+  public:
+    explicit RubberBandLookAheadWorker(
+            EngineBufferScaleRubberBandLookAhead* pScale);
+
+    void run() override;
+    void quitWait();
+
+  private:
+    EngineBufferScaleRubberBandLookAhead* const m_pScale;
+    std::atomic<bool> m_stop;
+};
+
+// Uses librubberband to scale audio like EngineBufferScaleRubberBand, but
+// runs the time-stretcher on a worker thread a few buffers ahead of the
+// playhead.
+//
+// The engine thread only copies samples between the ReadAheadManager and two
+// lock-free FIFOs of chunks. The worker is scheduled after each callback and
+// renders all pending input chunks. Tempo and pitch changes are passed along
+// with the input and take effect after the rendered look-ahead has been
+// played. Seeks and direction changes clear() the scaler, which discards the
+// look-ahead. Until the worker has rendered enough output again, the engine
+// thread plays the same input through a second, inexpensive RubberBand
+// instance with the settings of EngineBufferScaleRubberBand and crossfades
+// to the look-ahead once it is primed. The engine thread never waits for
+// the worker.
+class EngineBufferScaleRubberBandLookAhead : public EngineBufferScale {
+    Q_OBJECT
+  public:
+    explicit EngineBufferScaleRubberBandLookAhead(
+            ReadAheadManager* pReadAheadManager);
+    ~EngineBufferScaleRubberBandLookAhead() override;
+
+    void setScheduler(EngineWorkerScheduler* pScheduler);
+
+    void setScaleParameters(double base_rate,
+                            double* pTempoRatio,
+                            double* pPitchRatio) override;
+
+    void setSampleRate(SINT iSampleRate) override;
+
+    double scaleBuffer(
+            CSAMPLE* pOutputBuffer,
+            SINT iOutputBufferSize) override;
+
+    // Discards the rendered look-ahead.
+    void clear() override;
+
+  private:
+    friend class RubberBandLookAheadWorker;
+    friend class EngineBufferScaleRubberBandLookAheadTest;
+
+    // Called from the engine thread
+    bool submitInput();
+    // Returns the number of output frames that have been read. The number
+    // of input frames they have been rendered from is added to
+    // pInputFrames. The frames are discarded if pBuffer is null.
+    SINT readOutput(CSAMPLE* pBuffer, SINT frames, double* pInputFrames);
+    SINT bufferedFrames() const;
+    // True if the look-ahead of the current generation covers the next
+    // output buffer after the frames played by the fallback were skipped.
+    bool isPrimed(SINT frames) const;
+    // Retrieves output of the fallback RubberBand, which is fed by
+    // submitInput() while priming. Returns the number of frames retrieved.
+    SINT readFallbackOutput(CSAMPLE* pBuffer, SINT frames, double* pInputFrames);
+    void initFallbackRubberBand(SINT sampleRate);
+
+    // Called from the worker thread. Processes input chunks until the
+    // output FIFO is full or the input is exhausted.
+    void renderLookAhead();
+    void processChunk(const RubberBandLookAheadChunk& chunk);
+    SINT retrieveAvailable();
+    void initRubberBand(SINT sampleRate);
+
+    ReadAheadManager* m_pReadAheadManager;
+
+    FIFO<RubberBandLookAheadChunk> m_inputChunks;
+    FIFO<RubberBandLookAheadChunk> m_outputChunks;
+    // The total number of input frames read by the worker
+    std::atomic<SINT> m_renderedInputFrames;
+    std::atomic<SINT> m_queuedOutputFrames;
+    // Incremented by the engine thread whenever the look-ahead becomes
+    // invalid. Chunks of a previous generation are discarded.
+    std::atomic<int> m_generation;
+
+    // Only accessed from the engine thread
+    bool m_bBackwards;
+    double m_timeRatio;
+    double m_pitchScale;
+    bool m_bLastReadFailed;
+    bool m_bScheduled;
+    const int m_underflowTagId;
+    RubberBandLookAheadChunk m_inputChunk;
+    RubberBandLookAheadChunk m_outputChunk;
+    SINT m_outputChunkOffset;
+    // The total number of input frames submitted, and the total when the
+    // look-ahead has been cleared the last time. Input chunks are rendered
+    // in order, so the frames up to m_clearedInputFrames are stale.
+    SINT m_submittedInputFrames;
+    SINT m_clearedInputFrames;
+    // Set by clear() until the look-ahead is primed again
+    bool m_bPriming;
+    // The number of look-ahead frames that have already been played by the
+    // fallback and still need to be skipped.
+    SINT m_primingFramesToSkip;
+    std::unique_ptr<RubberBand::RubberBandStretcher> m_pFallbackRubberBand;
+    bool m_bFallbackFlushed;
+    CSAMPLE* m_fallbackBuffer[2];
+    CSAMPLE* m_pCrossfadeBuffer;
+
+    // Only accessed from the worker thread
+    std::unique_ptr<RubberBand::RubberBandStretcher> m_pRubberBand;
+    SINT m_renderSampleRate;
+    int m_renderGeneration;
+    double m_renderTimeRatio;
+    RubberBandLookAheadChunk m_renderChunk;
+    RubberBandLookAheadChunk m_renderOutputChunk;
+    CSAMPLE* m_deinterleaved[2];
+
+    RubberBandLookAheadWorker m_worker;
+};
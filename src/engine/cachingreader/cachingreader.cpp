@@ -38,6 +38,11 @@ const SINT kDefaultHintFrames = 1024;
 // massive drop outs are expected to occur Mixxx should run reliably!
 const SINT kNumberOfCachedChunksInMemory = 80;
 
+// Up to half of the chunks may be pinned, which is enough for the first
+// chunk of the cue point, all hotcues and both loop boundaries. The other
+// half remains available for the chunks around the playhead.
+const int kMaxNumberOfPinnedChunks = kNumberOfCachedChunksInMemory / 2;
+
 } // anonymous namespace
 
 CachingReader::CachingReader(QString group,
@@ -60,8 +65,11 @@ CachingReader::CachingReader(QString group,
           m_state(STATE_IDLE),
           m_mruCachingReaderChunk(nullptr),
           m_lruCachingReaderChunk(nullptr),
+          m_mruPinnedChunk(nullptr),
+          m_lruPinnedChunk(nullptr),
+          m_pinnedChunkCount(0),
           m_sampleBuffer(CachingReaderChunk::kSamples * kNumberOfCachedChunksInMemory),
-          m_worker(group, &m_chunkReadRequestFIFO, &m_readerStatusUpdateFIFO) {
+          m_worker(group, config, &m_chunkReadRequestFIFO, &m_readerStatusUpdateFIFO) {
     m_allocatedCachingReaderChunks.reserve(kNumberOfCachedChunksInMemory);
     // Divide up the allocated raw memory buffer into total_chunks
     // chunks. Initialize each chunk to hold nothing and add it to the free
@@ -97,9 +105,17 @@ CachingReader::~CachingReader() {
 }
 
 void CachingReader::freeChunkFromList(CachingReaderChunkForOwner* pChunk) {
-    pChunk->removeFromList(
-            &m_mruCachingReaderChunk,
-            &m_lruCachingReaderChunk);
+    if (pChunk->isPinned()) {
+        pChunk->removeFromList(
+                &m_mruPinnedChunk,
+                &m_lruPinnedChunk);
+        --m_pinnedChunkCount;
+        DEBUG_ASSERT(m_pinnedChunkCount >= 0);
+    } else {
+        pChunk->removeFromList(
+                &m_mruCachingReaderChunk,
+                &m_lruCachingReaderChunk);
+    }
     pChunk->free();
     m_freeChunks.push_back(pChunk);
 }
@@ -131,6 +147,8 @@ void CachingReader::freeAllChunks() {
     }
     DEBUG_ASSERT(!m_mruCachingReaderChunk);
     DEBUG_ASSERT(!m_lruCachingReaderChunk);
+    DEBUG_ASSERT(!m_mruPinnedChunk);
+    DEBUG_ASSERT(!m_lruPinnedChunk);
 
     m_allocatedCachingReaderChunks.clear();
 }
@@ -153,6 +171,11 @@ CachingReaderChunkForOwner* CachingReader::allocateChunkExpireLRU(SINT chunkInde
         if (m_lruCachingReaderChunk) {
             freeChunk(m_lruCachingReaderChunk);
             pChunk = allocateChunk(chunkIndex);
+        } else if (m_lruPinnedChunk) {
+            // Only pinned chunks are left, which should not happen
+            // unless kMaxNumberOfPinnedChunks is chosen too large.
+            freeChunk(m_lruPinnedChunk);
+            pChunk = allocateChunk(chunkIndex);
         } else {
             kLogger.warning() << "No cached LRU chunk available for freeing";
         }
@@ -180,18 +203,82 @@ void CachingReader::freshenChunk(CachingReaderChunkForOwner* pChunk) {
                 << pChunk;
     }
 
+    // Pinned chunks are freshened within the pinned list
+    CachingReaderChunkForOwner** ppHead = &m_mruCachingReaderChunk;
+    CachingReaderChunkForOwner** ppTail = &m_lruCachingReaderChunk;
+    if (pChunk->isPinned()) {
+        ppHead = &m_mruPinnedChunk;
+        ppTail = &m_lruPinnedChunk;
+    }
+
     // Remove the chunk from the MRU/LRU list
+    pChunk->removeFromList(ppHead, ppTail);
+
+    // Reinsert has new head of MRU list
+    pChunk->insertIntoListBefore(ppHead, ppTail, *ppHead);
+}
+
+void CachingReader::pinChunk(CachingReaderChunkForOwner* pChunk) {
+    DEBUG_ASSERT(pChunk);
+    DEBUG_ASSERT(pChunk->getState() == CachingReaderChunkForOwner::READY);
+    if (pChunk->isPinned() || !reservePinnedChunk()) {
+        freshenChunk(pChunk);
+        return;
+    }
+    if (kLogger.traceEnabled()) {
+        kLogger.trace()
+                << "pinChunk()"
+                << pChunk->getIndex()
+                << pChunk;
+    }
+
     pChunk->removeFromList(
             &m_mruCachingReaderChunk,
             &m_lruCachingReaderChunk);
+    pChunk->setPinned(true);
+    ++m_pinnedChunkCount;
+    pChunk->insertIntoListBefore(
+            &m_mruPinnedChunk,
+            &m_lruPinnedChunk,
+            m_mruPinnedChunk);
+}
 
-    // Reinsert has new head of MRU list
+void CachingReader::unpinChunk(CachingReaderChunkForOwner* pChunk) {
+    DEBUG_ASSERT(pChunk);
+    DEBUG_ASSERT(pChunk->isPinned());
+    if (kLogger.traceEnabled()) {
+        kLogger.trace()
+                << "unpinChunk()"
+                << pChunk->getIndex()
+                << pChunk;
+    }
+
+    pChunk->removeFromList(
+            &m_mruPinnedChunk,
+            &m_lruPinnedChunk);
+    pChunk->setPinned(false);
+    --m_pinnedChunkCount;
+    DEBUG_ASSERT(m_pinnedChunkCount >= 0);
+    // The demoted chunk has just been hinted and is more valuable than
+    // any other regular chunk.
     pChunk->insertIntoListBefore(
             &m_mruCachingReaderChunk,
             &m_lruCachingReaderChunk,
             m_mruCachingReaderChunk);
 }
 
+bool CachingReader::reservePinnedChunk() {
+    if (m_pinnedChunkCount < kMaxNumberOfPinnedChunks) {
+        return true;
+    }
+    if (!m_lruPinnedChunk) {
+        // All pinned chunks are still being read by the worker
+        return false;
+    }
+    unpinChunk(m_lruPinnedChunk);
+    return true;
+}
+
 CachingReaderChunkForOwner* CachingReader::lookupChunkAndFreshen(SINT chunkIndex) {
     auto pChunk = lookupChunk(chunkIndex);
     if (pChunk && (pChunk->getState() == CachingReaderChunkForOwner::READY)) {
@@ -263,9 +350,11 @@ void CachingReader::process() {
                 // TRACK_LOADED without a chunk in between, assert this here.
                 DEBUG_ASSERT(atomicLoadRelaxed(m_state) == STATE_TRACK_LOADING ||
                         (atomicLoadRelaxed(m_state) == STATE_TRACK_LOADED &&
-                                !m_mruCachingReaderChunk && !m_lruCachingReaderChunk));
+                                !m_mruCachingReaderChunk && !m_lruCachingReaderChunk &&
+                                !m_mruPinnedChunk && !m_lruPinnedChunk));
                 // now purge also the recently used chunk list from the old track.
-                if (m_mruCachingReaderChunk || m_lruCachingReaderChunk) {
+                if (m_mruCachingReaderChunk || m_lruCachingReaderChunk ||
+                        m_mruPinnedChunk || m_lruPinnedChunk) {
                     DEBUG_ASSERT(atomicLoadRelaxed(m_state) == STATE_TRACK_LOADING);
                     freeAllChunks();
                 }
@@ -554,6 +643,12 @@ void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
                             << "for read request";
                     continue;
                 }
+                // The chunk enters the pinned list when the worker
+                // returns it (see process())
+                if (hint.pinned && reservePinnedChunk()) {
+                    pChunk->setPinned(true);
+                    ++m_pinnedChunkCount;
+                }
                 // Do not insert the allocated chunk into the MRU/LRU list,
                 // because it will be handed over to the worker immediately
                 CachingReaderChunkReadRequest request;
@@ -574,7 +669,11 @@ void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
             } else if (pChunk->getState() == CachingReaderChunkForOwner::READY) {
                 // This will cause the chunk to be 'freshened' in the cache. The
                 // chunk will be moved to the end of the LRU list.
-                freshenChunk(pChunk);
+                if (hint.pinned) {
+                    pinChunk(pChunk);
+                } else {
+                    freshenChunk(pChunk);
+                }
             }
         }
     }
@@ -33,6 +33,11 @@ typedef struct Hint {
     // have the potential to be read (i.e. a cue point) should be issued with
     // priority >10.
     int priority;
+    // Hints for positions the user is likely to jump to (cue points, hotcues,
+    // loop boundaries) should be pinned. The CachingReader keeps pinned
+    // chunks in a separate tier that is not evicted when the playhead streams
+    // through the rest of the track.
+    bool pinned = false;
 
     // for the default frame count in forward direction
     static constexpr SINT kFrameCountForward = 0;
@@ -71,6 +76,11 @@ typedef QVarLengthArray<Hint, 512> HintVector;
 // least-recently-used list. When a chunk needs to be allocated and there are no
 // free chunks then the least recently used chunk is free'd (see
 // allocateChunkExpireLRU).
+//
+// Chunks that are hinted as pinned (see Hint::pinned) live in a second,
+// bounded MRU/LRU list. allocateChunkExpireLRU only expires pinned chunks if
+// no regular chunks are left. When the pinned tier is full, the least
+// recently hinted pinned chunk is demoted to the head of the regular list.
 class CachingReader : public QObject {
     Q_OBJECT
 
@@ -135,9 +145,22 @@ class CachingReader : public QObject {
     // returns it if it is present. If not, returns nullptr.
     CachingReaderChunkForOwner* lookupChunk(SINT chunkIndex);
 
-    // Moves the provided chunk to the MRU position.
+    // Moves the provided chunk to the MRU position of its list.
     void freshenChunk(CachingReaderChunkForOwner* pChunk);
 
+    // Moves the provided chunk to the MRU position of the pinned list. If
+    // the pinned tier is full the least recently pinned chunk is demoted.
+    void pinChunk(CachingReaderChunkForOwner* pChunk);
+
+    // Moves the provided pinned chunk to the MRU position of the regular
+    // list.
+    void unpinChunk(CachingReaderChunkForOwner* pChunk);
+
+    // Makes room for one more pinned chunk by demoting the LRU pinned chunk
+    // if needed. Returns false if the pinned tier is occupied by pending
+    // reads only.
+    bool reservePinnedChunk();
+
     // Returns a CachingReaderChunk to the free list
     void freeChunk(CachingReaderChunkForOwner* pChunk);
     void freeChunkFromList(CachingReaderChunkForOwner* pChunk);
@@ -174,6 +197,13 @@ class CachingReader : public QObject {
     CachingReaderChunkForOwner* m_mruCachingReaderChunk;
     CachingReaderChunkForOwner* m_lruCachingReaderChunk;
 
+    // The linked list of recently-hinted pinned chunks.
+    CachingReaderChunkForOwner* m_mruPinnedChunk;
+    CachingReaderChunkForOwner* m_lruPinnedChunk;
+
+    // The number of pinned chunks, including those with a pending read.
+    int m_pinnedChunkCount;
+
     // The raw memory buffer which is divided up into chunks.
     mixxx::SampleBuffer m_sampleBuffer;
 
@@ -121,6 +121,7 @@ CachingReaderChunkForOwner::CachingReaderChunkForOwner(
         mixxx::SampleBuffer::WritableSlice sampleBuffer)
         : CachingReaderChunk(std::move(sampleBuffer)),
           m_state(FREE),
+          m_pinned(false),
           m_pPrev(nullptr),
           m_pNext(nullptr) {
 }
@@ -134,6 +135,7 @@ void CachingReaderChunkForOwner::init(SINT index) {
 
     CachingReaderChunk::init(index);
     m_state = READY;
+    m_pinned = false;
 }
 
 void CachingReaderChunkForOwner::free() {
@@ -145,6 +147,7 @@ void CachingReaderChunkForOwner::free() {
 
     CachingReaderChunk::init(kInvalidChunkIndex);
     m_state = FREE;
+    m_pinned = false;
 }
 
 void CachingReaderChunkForOwner::insertIntoListBefore(
@@ -122,6 +122,16 @@ public:
         m_state = READY;
     }
 
+    // Pinned chunks are kept in a separate MRU/LRU list by the cache
+    // and are not expired to make room for regular chunks.
+    bool isPinned() const {
+        return m_pinned;
+    }
+    void setPinned(bool pinned) {
+        DEBUG_ASSERT(m_state != FREE);
+        m_pinned = pinned;
+    }
+
     // Inserts a chunk into the double-linked list before the
     // given chunk and adjusts the head/tail pointers. The
     // chunk is inserted at the tail of the list if
@@ -138,6 +148,7 @@ public:
 
 private:
     State m_state;
+    bool m_pinned;
 
     CachingReaderChunkForOwner* m_pPrev; // previous item in double-linked list
     CachingReaderChunkForOwner* m_pNext; // next item in double-linked list
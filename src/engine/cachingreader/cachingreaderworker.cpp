@@ -19,13 +19,15 @@ mixxx::Logger kLogger("CachingReaderWorker");
 
 CachingReaderWorker::CachingReaderWorker(
         QString group,
+        UserSettingsPointer pConfig,
         FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
         FIFO<ReaderStatusUpdate>* pReaderStatusFIFO)
         : m_group(group),
-          m_tag(QString("CachingReaderWorker %1").arg(m_group)),
+          m_tagId(Stat::registerTag("CachingReaderWorker %1", m_group)),
           m_pChunkReadRequestFIFO(pChunkReadRequestFIFO),
           m_pReaderStatusFIFO(pReaderStatusFIFO),
           m_newTrackAvailable(false),
+          m_decodedAudioCache(pConfig),
           m_stop(0) {
 }
 
@@ -88,7 +90,7 @@ void CachingReaderWorker::run() {
     unsigned static id = 0; //the id of this thread, for debugging purposes
     QThread::currentThread()->setObjectName(QString("CachingReaderWorker %1").arg(++id));
 
-    Event::start(m_tag);
+    Event::start(m_tagId);
     while (!atomicLoadAcquire(m_stop)) {
         // Request is initialized by reading from FIFO
         CachingReaderChunkReadRequest request;
@@ -106,9 +108,9 @@ void CachingReaderWorker::run() {
             const ReaderStatusUpdate update(processReadRequest(request));
             m_pReaderStatusFIFO->writeBlocking(&update, 1);
         } else {
-            Event::end(m_tag);
+            Event::end(m_tagId);
             m_semaRun.acquire();
-            Event::start(m_tag);
+            Event::start(m_tagId);
         }
     }
 }
@@ -147,9 +149,17 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
         return;
     }
 
-    mixxx::AudioSource::OpenParams config;
-    config.setChannelCount(CachingReaderChunk::kChannels);
-    m_pAudioSource = SoundSourceProxy(pTrack).openAudioSource(config);
+    m_pAudioSource = m_decodedAudioCache.openAudioSource(pTrack->getFileInfo());
+    if (m_pAudioSource) {
+        kLogger.debug()
+                << m_group
+                << "Reading decoded audio data from cache"
+                << filename;
+    } else {
+        mixxx::AudioSource::OpenParams config;
+        config.setChannelCount(CachingReaderChunk::kChannels);
+        m_pAudioSource = SoundSourceProxy(pTrack).openAudioSource(config);
+    }
     if (!m_pAudioSource) {
         kLogger.warning()
                 << m_group
@@ -11,6 +11,7 @@
 #include "track/track.h"
 #include "engine/engineworker.h"
 #include "sources/audiosource.h"
+#include "sources/decodedaudiocache.h"
 #include "util/fifo.h"
 
 
@@ -99,6 +100,7 @@ class CachingReaderWorker : public EngineWorker {
   public:
     // Construct a CachingReader with the given group.
     CachingReaderWorker(QString group,
+            UserSettingsPointer pConfig,
             FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
             FIFO<ReaderStatusUpdate>* pReaderStatusFIFO);
     ~CachingReaderWorker() override = default;
@@ -120,7 +122,7 @@ class CachingReaderWorker : public EngineWorker {
 
   private:
     QString m_group;
-    QString m_tag;
+    int m_tagId;
 
     // Thread-safe FIFOs for communication between the engine callback and
     // reader thread.
@@ -139,6 +141,10 @@ class CachingReaderWorker : public EngineWorker {
     ReaderStatusUpdate processReadRequest(
             const CachingReaderChunkReadRequest& request);
 
+    // Decoded audio data of tracks that have been analyzed before is
+    // read from this cache instead of decoding the file again.
+    const mixxx::DecodedAudioCache m_decodedAudioCache;
+
     // The current audio source of the track loaded
     mixxx::AudioSourcePointer m_pAudioSource;
 
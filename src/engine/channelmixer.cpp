@@ -0,0 +1,127 @@
+#include "engine/channelmixer.h"
+
+#if defined(MIXXX_CHANNELMIXER_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <QtDebug>
+
+#include "util/math.h"
+#include "util/sample.h"
+
+// static
+const ChannelMixerKernels* ChannelMixer::s_pKernels = &ChannelMixerKernels::kScalar;
+
+namespace {
+
+#ifdef MIXXX_CHANNELMIXER_X86
+bool cpuSupportsSSE2() {
+#if defined(__x86_64__) || defined(_M_X64)
+    // SSE2 is part of the x86-64 baseline.
+    return true;
+#elif defined(__GNUC__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26)) != 0;
+#else
+    return false;
+#endif
+}
+
+bool cpuSupportsAVX2() {
+#if defined(__GNUC__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    // The OS has to preserve the YMM registers across context switches.
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return false;
+#endif
+}
+#endif
+
+} // anonymous namespace
+
+// static
+std::vector<const ChannelMixerKernels*> ChannelMixer::supportedKernels() {
+    std::vector<const ChannelMixerKernels*> kernels;
+    kernels.push_back(&ChannelMixerKernels::kScalar);
+#ifdef MIXXX_CHANNELMIXER_X86
+    if (cpuSupportsSSE2()) {
+        kernels.push_back(&ChannelMixerKernels::kSSE2);
+    }
+    if (cpuSupportsAVX2()) {
+        kernels.push_back(&ChannelMixerKernels::kAVX2);
+    }
+#endif
+#ifdef MIXXX_CHANNELMIXER_NEON
+    // NEON is only enabled at compile time if the target has it.
+    kernels.push_back(&ChannelMixerKernels::kNEON);
+#endif
+    return kernels;
+}
+
+// static
+void ChannelMixer::selectKernels() {
+    setKernels(*supportedKernels().back());
+    qDebug() << "ChannelMixer: Using" << s_pKernels->name << "mixing kernels";
+}
+
+// static
+void ChannelMixer::setKernels(const ChannelMixerKernels& kernels) {
+    s_pKernels = &kernels;
+}
+
+// static
+void ChannelMixer::mixChannelBuffers(CSAMPLE* pOutput,
+        const CSAMPLE* const* ppBuffers, int numBuffers,
+        unsigned int iBufferSize) {
+    if (numBuffers <= 0) {
+        SampleUtil::clear(pOutput, iBufferSize);
+        return;
+    }
+    // Buffers are always summed up in order, so the result does not depend
+    // on the selected kernels.
+    int mixed = math_min(numBuffers, ChannelMixerKernels::kMaxUnrolledChannels);
+    s_pKernels->copyMix[mixed](pOutput, ppBuffers, iBufferSize);
+    while (mixed < numBuffers) {
+        const int count = math_min(numBuffers - mixed,
+                ChannelMixerKernels::kMaxUnrolledChannels);
+        s_pKernels->addMix[count](pOutput, ppBuffers + mixed, iBufferSize);
+        mixed += count;
+    }
+}
+
+// static
+void ChannelMixer::applyRampingGain(CSAMPLE* pBuffer,
+        CSAMPLE_GAIN oldGain, CSAMPLE_GAIN newGain,
+        unsigned int iBufferSize) {
+    if (oldGain == CSAMPLE_GAIN_ONE && newGain == CSAMPLE_GAIN_ONE) {
+        return;
+    }
+    if (oldGain == CSAMPLE_GAIN_ZERO && newGain == CSAMPLE_GAIN_ZERO) {
+        SampleUtil::clear(pBuffer, iBufferSize);
+        return;
+    }
+    if (oldGain == newGain) {
+        s_pKernels->applyGain(pBuffer, oldGain, iBufferSize);
+    } else {
+        s_pKernels->applyRampingGain(pBuffer, oldGain, newGain, iBufferSize);
+    }
+}
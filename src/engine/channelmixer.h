@@ -2,13 +2,35 @@
 #define CHANNELMIXER_H
 
 #include <QVarLengthArray>
+#include <vector>
 
 #include "util/types.h"
+#include "engine/channelmixerkernels.h"
 #include "engine/enginemaster.h"
 #include "effects/engineeffectsmanager.h"
 
 class ChannelMixer {
   public:
+    // Selects the fastest ChannelMixerKernels supported by the CPU. Called
+    // once at EngineMaster startup before the engine starts mixing.
+    static void selectKernels();
+    // Overrides the selected kernels. Only for tests and benchmarks.
+    static void setKernels(const ChannelMixerKernels& kernels);
+    static const ChannelMixerKernels& kernels() {
+        return *s_pKernels;
+    }
+    // All kernels the CPU can run, ordered from the slowest to the fastest.
+    static std::vector<const ChannelMixerKernels*> supportedKernels();
+
+    // Overwrites pOutput with the sum of numBuffers buffers.
+    static void mixChannelBuffers(CSAMPLE* pOutput,
+            const CSAMPLE* const* ppBuffers, int numBuffers,
+            unsigned int iBufferSize);
+    // Same as SampleUtil::applyRampingGain() but using the selected kernels.
+    static void applyRampingGain(CSAMPLE* pBuffer,
+            CSAMPLE_GAIN oldGain, CSAMPLE_GAIN newGain,
+            unsigned int iBufferSize);
+
     // This does not modify the input channel buffers. All manipulation of the input
     // channel buffers is done after copying to a temporary buffer, then they are mixed
     // to make the output buffer.
@@ -29,6 +51,9 @@ class ChannelMixer {
         unsigned int iBufferSize,
         unsigned int iSampleRate,
         EngineEffectsManager* pEngineEffectsManager);
+
+  private:
+    static const ChannelMixerKernels* s_pKernels;
 };
 
 #endif /* CHANNELMIXER_H */
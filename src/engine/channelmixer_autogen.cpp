@@ -7082,10 +7082,10 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
                                                      EngineEffectsManager* pEngineEffectsManager) {
     // Signal flow overview:
     // 1. Calculate gains for each channel
-    // 2. Pass each channel's calculated gain and input buffer to pEngineEffectsManager, which then:
-    //    A) Applies the calculated gain to the channel buffer, modifying the original input buffer
-    //    B) Applies effects to the buffer, modifying the original input buffer
+    // 2. Apply the calculated gain to the channel buffer, modifying the original input buffer
+    // 3. Pass each channel's input buffer to pEngineEffectsManager, which applies effects to the buffer, modifying the original input buffer
     // 4. Mix the channel buffers together to make pOutput, overwriting the pOutput buffer from the last engine callback
+    // Steps 2 and 4 use the ChannelMixerKernels selected for this CPU.
     int totalActive = activeChannels->size();
     if (totalActive == 0) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_0active");
@@ -7106,12 +7106,12 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache0.m_gain = newGain[0];
         CSAMPLE* pBuffer0 = pChannel0->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i];
-        }
+        const CSAMPLE* pBuffers[1] = {pBuffer0};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 1, iBufferSize);
     } else if (totalActive == 2) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_2active");
         CSAMPLE_GAIN oldGain[2];
@@ -7140,13 +7140,14 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache1.m_gain = newGain[1];
         CSAMPLE* pBuffer1 = pChannel1->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i];
-        }
+        const CSAMPLE* pBuffers[2] = {pBuffer0, pBuffer1};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 2, iBufferSize);
     } else if (totalActive == 3) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_3active");
         CSAMPLE_GAIN oldGain[3];
@@ -7187,14 +7188,16 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache2.m_gain = newGain[2];
         CSAMPLE* pBuffer2 = pChannel2->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i];
-        }
+        const CSAMPLE* pBuffers[3] = {pBuffer0, pBuffer1, pBuffer2};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 3, iBufferSize);
     } else if (totalActive == 4) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_4active");
         CSAMPLE_GAIN oldGain[4];
@@ -7247,15 +7250,18 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache3.m_gain = newGain[3];
         CSAMPLE* pBuffer3 = pChannel3->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i];
-        }
+        const CSAMPLE* pBuffers[4] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 4, iBufferSize);
     } else if (totalActive == 5) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_5active");
         CSAMPLE_GAIN oldGain[5];
@@ -7320,16 +7326,20 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache4.m_gain = newGain[4];
         CSAMPLE* pBuffer4 = pChannel4->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i];
-        }
+        const CSAMPLE* pBuffers[5] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 5, iBufferSize);
     } else if (totalActive == 6) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_6active");
         CSAMPLE_GAIN oldGain[6];
@@ -7406,17 +7416,22 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache5.m_gain = newGain[5];
         CSAMPLE* pBuffer5 = pChannel5->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i];
-        }
+        const CSAMPLE* pBuffers[6] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 6, iBufferSize);
     } else if (totalActive == 7) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_7active");
         CSAMPLE_GAIN oldGain[7];
@@ -7505,18 +7520,24 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache6.m_gain = newGain[6];
         CSAMPLE* pBuffer6 = pChannel6->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i];
-        }
+        const CSAMPLE* pBuffers[7] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 7, iBufferSize);
     } else if (totalActive == 8) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_8active");
         CSAMPLE_GAIN oldGain[8];
@@ -7617,19 +7638,26 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache7.m_gain = newGain[7];
         CSAMPLE* pBuffer7 = pChannel7->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i];
-        }
+        const CSAMPLE* pBuffers[8] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 8, iBufferSize);
     } else if (totalActive == 9) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_9active");
         CSAMPLE_GAIN oldGain[9];
@@ -7742,20 +7770,28 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache8.m_gain = newGain[8];
         CSAMPLE* pBuffer8 = pChannel8->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i];
-        }
+        const CSAMPLE* pBuffers[9] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 9, iBufferSize);
     } else if (totalActive == 10) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_10active");
         CSAMPLE_GAIN oldGain[10];
@@ -7880,21 +7916,30 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache9.m_gain = newGain[9];
         CSAMPLE* pBuffer9 = pChannel9->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i];
-        }
+        const CSAMPLE* pBuffers[10] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 10, iBufferSize);
     } else if (totalActive == 11) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_11active");
         CSAMPLE_GAIN oldGain[11];
@@ -8031,22 +8076,32 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache10.m_gain = newGain[10];
         CSAMPLE* pBuffer10 = pChannel10->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i];
-        }
+        const CSAMPLE* pBuffers[11] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 11, iBufferSize);
     } else if (totalActive == 12) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_12active");
         CSAMPLE_GAIN oldGain[12];
@@ -8195,23 +8250,34 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache11.m_gain = newGain[11];
         CSAMPLE* pBuffer11 = pChannel11->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i];
-        }
+        const CSAMPLE* pBuffers[12] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 12, iBufferSize);
     } else if (totalActive == 13) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_13active");
         CSAMPLE_GAIN oldGain[13];
@@ -8372,24 +8438,36 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache12.m_gain = newGain[12];
         CSAMPLE* pBuffer12 = pChannel12->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i];
-        }
+        const CSAMPLE* pBuffers[13] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 13, iBufferSize);
     } else if (totalActive == 14) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_14active");
         CSAMPLE_GAIN oldGain[14];
@@ -8562,25 +8640,38 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache13.m_gain = newGain[13];
         CSAMPLE* pBuffer13 = pChannel13->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i];
-        }
+        const CSAMPLE* pBuffers[14] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 14, iBufferSize);
     } else if (totalActive == 15) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_15active");
         CSAMPLE_GAIN oldGain[15];
@@ -8765,26 +8856,40 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache14.m_gain = newGain[14];
         CSAMPLE* pBuffer14 = pChannel14->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i];
-        }
+        const CSAMPLE* pBuffers[15] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 15, iBufferSize);
     } else if (totalActive == 16) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_16active");
         CSAMPLE_GAIN oldGain[16];
@@ -8981,27 +9086,42 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache15.m_gain = newGain[15];
         CSAMPLE* pBuffer15 = pChannel15->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i];
-        }
+        const CSAMPLE* pBuffers[16] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 16, iBufferSize);
     } else if (totalActive == 17) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_17active");
         CSAMPLE_GAIN oldGain[17];
@@ -9210,28 +9330,44 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache16.m_gain = newGain[16];
         CSAMPLE* pBuffer16 = pChannel16->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i];
-        }
+        const CSAMPLE* pBuffers[17] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 17, iBufferSize);
     } else if (totalActive == 18) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_18active");
         CSAMPLE_GAIN oldGain[18];
@@ -9452,29 +9588,46 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache17.m_gain = newGain[17];
         CSAMPLE* pBuffer17 = pChannel17->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i];
-        }
+        const CSAMPLE* pBuffers[18] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 18, iBufferSize);
     } else if (totalActive == 19) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_19active");
         CSAMPLE_GAIN oldGain[19];
@@ -9707,30 +9860,48 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache18.m_gain = newGain[18];
         CSAMPLE* pBuffer18 = pChannel18->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i];
-        }
+        const CSAMPLE* pBuffers[19] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 19, iBufferSize);
     } else if (totalActive == 20) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_20active");
         CSAMPLE_GAIN oldGain[20];
@@ -9975,31 +10146,50 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache19.m_gain = newGain[19];
         CSAMPLE* pBuffer19 = pChannel19->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i];
-        }
+        const CSAMPLE* pBuffers[20] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 20, iBufferSize);
     } else if (totalActive == 21) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_21active");
         CSAMPLE_GAIN oldGain[21];
@@ -10256,32 +10446,52 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache20.m_gain = newGain[20];
         CSAMPLE* pBuffer20 = pChannel20->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i];
-        }
+        const CSAMPLE* pBuffers[21] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 21, iBufferSize);
     } else if (totalActive == 22) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_22active");
         CSAMPLE_GAIN oldGain[22];
@@ -10550,33 +10760,54 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache21.m_gain = newGain[21];
         CSAMPLE* pBuffer21 = pChannel21->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i];
-        }
+        const CSAMPLE* pBuffers[22] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 22, iBufferSize);
     } else if (totalActive == 23) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_23active");
         CSAMPLE_GAIN oldGain[23];
@@ -10857,34 +11088,56 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache22.m_gain = newGain[22];
         CSAMPLE* pBuffer22 = pChannel22->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i];
-        }
+        const CSAMPLE* pBuffers[23] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 23, iBufferSize);
     } else if (totalActive == 24) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_24active");
         CSAMPLE_GAIN oldGain[24];
@@ -11177,35 +11430,58 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache23.m_gain = newGain[23];
         CSAMPLE* pBuffer23 = pChannel23->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
+        ChannelMixer::applyRampingGain(pBuffer23, oldGain[23], newGain[23], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i];
-        }
+        const CSAMPLE* pBuffers[24] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22, pBuffer23};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 24, iBufferSize);
     } else if (totalActive == 25) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_25active");
         CSAMPLE_GAIN oldGain[25];
@@ -11510,36 +11786,60 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache24.m_gain = newGain[24];
         CSAMPLE* pBuffer24 = pChannel24->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
+        ChannelMixer::applyRampingGain(pBuffer23, oldGain[23], newGain[23], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features);
+        ChannelMixer::applyRampingGain(pBuffer24, oldGain[24], newGain[24], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i];
-        }
+        const CSAMPLE* pBuffers[25] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22, pBuffer23, pBuffer24};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 25, iBufferSize);
     } else if (totalActive == 26) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_26active");
         CSAMPLE_GAIN oldGain[26];
@@ -11856,37 +12156,62 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache25.m_gain = newGain[25];
         CSAMPLE* pBuffer25 = pChannel25->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
+        ChannelMixer::applyRampingGain(pBuffer23, oldGain[23], newGain[23], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features);
+        ChannelMixer::applyRampingGain(pBuffer24, oldGain[24], newGain[24], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features);
+        ChannelMixer::applyRampingGain(pBuffer25, oldGain[25], newGain[25], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i];
-        }
+        const CSAMPLE* pBuffers[26] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22, pBuffer23, pBuffer24, pBuffer25};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 26, iBufferSize);
     } else if (totalActive == 27) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_27active");
         CSAMPLE_GAIN oldGain[27];
@@ -12215,38 +12540,64 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache26.m_gain = newGain[26];
         CSAMPLE* pBuffer26 = pChannel26->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
+        ChannelMixer::applyRampingGain(pBuffer23, oldGain[23], newGain[23], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features);
+        ChannelMixer::applyRampingGain(pBuffer24, oldGain[24], newGain[24], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features);
+        ChannelMixer::applyRampingGain(pBuffer25, oldGain[25], newGain[25], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features);
+        ChannelMixer::applyRampingGain(pBuffer26, oldGain[26], newGain[26], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i];
-        }
+        const CSAMPLE* pBuffers[27] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22, pBuffer23, pBuffer24, pBuffer25, pBuffer26};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 27, iBufferSize);
     } else if (totalActive == 28) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_28active");
         CSAMPLE_GAIN oldGain[28];
@@ -12587,39 +12938,66 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache27.m_gain = newGain[27];
         CSAMPLE* pBuffer27 = pChannel27->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
+        ChannelMixer::applyRampingGain(pBuffer23, oldGain[23], newGain[23], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features);
+        ChannelMixer::applyRampingGain(pBuffer24, oldGain[24], newGain[24], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features);
+        ChannelMixer::applyRampingGain(pBuffer25, oldGain[25], newGain[25], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features);
+        ChannelMixer::applyRampingGain(pBuffer26, oldGain[26], newGain[26], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features);
+        ChannelMixer::applyRampingGain(pBuffer27, oldGain[27], newGain[27], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i];
-        }
+        const CSAMPLE* pBuffers[28] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22, pBuffer23, pBuffer24, pBuffer25, pBuffer26, pBuffer27};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 28, iBufferSize);
     } else if (totalActive == 29) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_29active");
         CSAMPLE_GAIN oldGain[29];
@@ -12972,40 +13350,68 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache28.m_gain = newGain[28];
         CSAMPLE* pBuffer28 = pChannel28->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features, oldGain[28], newGain[28]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
+        ChannelMixer::applyRampingGain(pBuffer23, oldGain[23], newGain[23], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features);
+        ChannelMixer::applyRampingGain(pBuffer24, oldGain[24], newGain[24], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features);
+        ChannelMixer::applyRampingGain(pBuffer25, oldGain[25], newGain[25], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features);
+        ChannelMixer::applyRampingGain(pBuffer26, oldGain[26], newGain[26], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features);
+        ChannelMixer::applyRampingGain(pBuffer27, oldGain[27], newGain[27], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features);
+        ChannelMixer::applyRampingGain(pBuffer28, oldGain[28], newGain[28], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i] + pBuffer28[i];
-        }
+        const CSAMPLE* pBuffers[29] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22, pBuffer23, pBuffer24, pBuffer25, pBuffer26, pBuffer27, pBuffer28};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 29, iBufferSize);
     } else if (totalActive == 30) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_30active");
         CSAMPLE_GAIN oldGain[30];
@@ -13370,41 +13776,70 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache29.m_gain = newGain[29];
         CSAMPLE* pBuffer29 = pChannel29->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features, oldGain[28], newGain[28]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel29->m_handle, outputHandle, pBuffer29, iBufferSize, iSampleRate, pChannel29->m_features, oldGain[29], newGain[29]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
+        ChannelMixer::applyRampingGain(pBuffer23, oldGain[23], newGain[23], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features);
+        ChannelMixer::applyRampingGain(pBuffer24, oldGain[24], newGain[24], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features);
+        ChannelMixer::applyRampingGain(pBuffer25, oldGain[25], newGain[25], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features);
+        ChannelMixer::applyRampingGain(pBuffer26, oldGain[26], newGain[26], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features);
+        ChannelMixer::applyRampingGain(pBuffer27, oldGain[27], newGain[27], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features);
+        ChannelMixer::applyRampingGain(pBuffer28, oldGain[28], newGain[28], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features);
+        ChannelMixer::applyRampingGain(pBuffer29, oldGain[29], newGain[29], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel29->m_handle, outputHandle, pBuffer29, iBufferSize, iSampleRate, pChannel29->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i] + pBuffer28[i] + pBuffer29[i];
-        }
+        const CSAMPLE* pBuffers[30] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22, pBuffer23, pBuffer24, pBuffer25, pBuffer26, pBuffer27, pBuffer28, pBuffer29};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 30, iBufferSize);
     } else if (totalActive == 31) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_31active");
         CSAMPLE_GAIN oldGain[31];
@@ -13781,42 +14216,72 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache30.m_gain = newGain[30];
         CSAMPLE* pBuffer30 = pChannel30->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features, oldGain[28], newGain[28]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel29->m_handle, outputHandle, pBuffer29, iBufferSize, iSampleRate, pChannel29->m_features, oldGain[29], newGain[29]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel30->m_handle, outputHandle, pBuffer30, iBufferSize, iSampleRate, pChannel30->m_features, oldGain[30], newGain[30]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
+        ChannelMixer::applyRampingGain(pBuffer23, oldGain[23], newGain[23], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features);
+        ChannelMixer::applyRampingGain(pBuffer24, oldGain[24], newGain[24], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features);
+        ChannelMixer::applyRampingGain(pBuffer25, oldGain[25], newGain[25], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features);
+        ChannelMixer::applyRampingGain(pBuffer26, oldGain[26], newGain[26], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features);
+        ChannelMixer::applyRampingGain(pBuffer27, oldGain[27], newGain[27], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features);
+        ChannelMixer::applyRampingGain(pBuffer28, oldGain[28], newGain[28], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features);
+        ChannelMixer::applyRampingGain(pBuffer29, oldGain[29], newGain[29], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel29->m_handle, outputHandle, pBuffer29, iBufferSize, iSampleRate, pChannel29->m_features);
+        ChannelMixer::applyRampingGain(pBuffer30, oldGain[30], newGain[30], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel30->m_handle, outputHandle, pBuffer30, iBufferSize, iSampleRate, pChannel30->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i] + pBuffer28[i] + pBuffer29[i] + pBuffer30[i];
-        }
+        const CSAMPLE* pBuffers[31] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22, pBuffer23, pBuffer24, pBuffer25, pBuffer26, pBuffer27, pBuffer28, pBuffer29, pBuffer30};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 31, iBufferSize);
     } else if (totalActive == 32) {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_32active");
         CSAMPLE_GAIN oldGain[32];
@@ -14205,43 +14670,74 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         }
         gainCache31.m_gain = newGain[31];
         CSAMPLE* pBuffer31 = pChannel31->m_pBuffer;
-        // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features, oldGain[28], newGain[28]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel29->m_handle, outputHandle, pBuffer29, iBufferSize, iSampleRate, pChannel29->m_features, oldGain[29], newGain[29]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel30->m_handle, outputHandle, pBuffer30, iBufferSize, iSampleRate, pChannel30->m_features, oldGain[30], newGain[30]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel31->m_handle, outputHandle, pBuffer31, iBufferSize, iSampleRate, pChannel31->m_features, oldGain[31], newGain[31]);
+        // Apply gain and process effects for each channel in place
+        ChannelMixer::applyRampingGain(pBuffer0, oldGain[0], newGain[0], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features);
+        ChannelMixer::applyRampingGain(pBuffer1, oldGain[1], newGain[1], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features);
+        ChannelMixer::applyRampingGain(pBuffer2, oldGain[2], newGain[2], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features);
+        ChannelMixer::applyRampingGain(pBuffer3, oldGain[3], newGain[3], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features);
+        ChannelMixer::applyRampingGain(pBuffer4, oldGain[4], newGain[4], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features);
+        ChannelMixer::applyRampingGain(pBuffer5, oldGain[5], newGain[5], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features);
+        ChannelMixer::applyRampingGain(pBuffer6, oldGain[6], newGain[6], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features);
+        ChannelMixer::applyRampingGain(pBuffer7, oldGain[7], newGain[7], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features);
+        ChannelMixer::applyRampingGain(pBuffer8, oldGain[8], newGain[8], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features);
+        ChannelMixer::applyRampingGain(pBuffer9, oldGain[9], newGain[9], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features);
+        ChannelMixer::applyRampingGain(pBuffer10, oldGain[10], newGain[10], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features);
+        ChannelMixer::applyRampingGain(pBuffer11, oldGain[11], newGain[11], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features);
+        ChannelMixer::applyRampingGain(pBuffer12, oldGain[12], newGain[12], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features);
+        ChannelMixer::applyRampingGain(pBuffer13, oldGain[13], newGain[13], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features);
+        ChannelMixer::applyRampingGain(pBuffer14, oldGain[14], newGain[14], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features);
+        ChannelMixer::applyRampingGain(pBuffer15, oldGain[15], newGain[15], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features);
+        ChannelMixer::applyRampingGain(pBuffer16, oldGain[16], newGain[16], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features);
+        ChannelMixer::applyRampingGain(pBuffer17, oldGain[17], newGain[17], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features);
+        ChannelMixer::applyRampingGain(pBuffer18, oldGain[18], newGain[18], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features);
+        ChannelMixer::applyRampingGain(pBuffer19, oldGain[19], newGain[19], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features);
+        ChannelMixer::applyRampingGain(pBuffer20, oldGain[20], newGain[20], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features);
+        ChannelMixer::applyRampingGain(pBuffer21, oldGain[21], newGain[21], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features);
+        ChannelMixer::applyRampingGain(pBuffer22, oldGain[22], newGain[22], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features);
+        ChannelMixer::applyRampingGain(pBuffer23, oldGain[23], newGain[23], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features);
+        ChannelMixer::applyRampingGain(pBuffer24, oldGain[24], newGain[24], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features);
+        ChannelMixer::applyRampingGain(pBuffer25, oldGain[25], newGain[25], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features);
+        ChannelMixer::applyRampingGain(pBuffer26, oldGain[26], newGain[26], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features);
+        ChannelMixer::applyRampingGain(pBuffer27, oldGain[27], newGain[27], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features);
+        ChannelMixer::applyRampingGain(pBuffer28, oldGain[28], newGain[28], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features);
+        ChannelMixer::applyRampingGain(pBuffer29, oldGain[29], newGain[29], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel29->m_handle, outputHandle, pBuffer29, iBufferSize, iSampleRate, pChannel29->m_features);
+        ChannelMixer::applyRampingGain(pBuffer30, oldGain[30], newGain[30], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel30->m_handle, outputHandle, pBuffer30, iBufferSize, iSampleRate, pChannel30->m_features);
+        ChannelMixer::applyRampingGain(pBuffer31, oldGain[31], newGain[31], iBufferSize);
+        pEngineEffectsManager->processPostFaderInPlace(pChannel31->m_handle, outputHandle, pBuffer31, iBufferSize, iSampleRate, pChannel31->m_features);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
-        for (unsigned int i = 0; i < iBufferSize; ++i) {
-            pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i] + pBuffer28[i] + pBuffer29[i] + pBuffer30[i] + pBuffer31[i];
-        }
+        const CSAMPLE* pBuffers[32] = {pBuffer0, pBuffer1, pBuffer2, pBuffer3, pBuffer4, pBuffer5, pBuffer6, pBuffer7, pBuffer8, pBuffer9, pBuffer10, pBuffer11, pBuffer12, pBuffer13, pBuffer14, pBuffer15, pBuffer16, pBuffer17, pBuffer18, pBuffer19, pBuffer20, pBuffer21, pBuffer22, pBuffer23, pBuffer24, pBuffer25, pBuffer26, pBuffer27, pBuffer28, pBuffer29, pBuffer30, pBuffer31};
+        ChannelMixer::mixChannelBuffers(pOutput, pBuffers, 32, iBufferSize);
     } else {
         //ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels_Over32active");
         SampleUtil::clear(pOutput, iBufferSize);
@@ -14259,7 +14755,8 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
             }
             gainCache.m_gain = newGain;
             CSAMPLE* pBuffer = pChannelInfo->m_pBuffer;
-            pEngineEffectsManager->processPostFaderInPlace(pChannelInfo->m_handle, outputHandle, pBuffer, iBufferSize, iSampleRate, pChannelInfo->m_features, oldGain, newGain);
+            ChannelMixer::applyRampingGain(pBuffer, oldGain, newGain, iBufferSize);
+            pEngineEffectsManager->processPostFaderInPlace(pChannelInfo->m_handle, outputHandle, pBuffer, iBufferSize, iSampleRate, pChannelInfo->m_features);
             SampleUtil::add(pOutput, pBuffer, iBufferSize);
         }
     }
@@ -0,0 +1,1516 @@
+#include "engine/channelmixerkernels.h"
+
+#ifdef MIXXX_CHANNELMIXER_X86
+#include <immintrin.h>
+#if defined(__GNUC__)
+// Allows using the intrinsics without compiling the whole file for the target.
+#define MIXXX_TARGET_SSE2 __attribute__((target("sse2")))
+#define MIXXX_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MIXXX_TARGET_SSE2
+#define MIXXX_TARGET_AVX2
+#endif
+#endif
+
+#ifdef MIXXX_CHANNELMIXER_NEON
+#include <arm_neon.h>
+#endif
+
+////////////////////////////////////////////////////////
+// THIS FILE IS AUTO-GENERATED. DO NOT EDIT DIRECTLY! //
+// SEE scripts/generate_sample_functions.py           //
+////////////////////////////////////////////////////////
+
+static void copyMix1Scalar(CSAMPLE* M_RESTRICT pDest,
+                           const CSAMPLE* const* ppSrc,
+                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i];
+    }
+}
+
+static void copyMix2Scalar(CSAMPLE* M_RESTRICT pDest,
+                           const CSAMPLE* const* ppSrc,
+                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i];
+    }
+}
+
+static void copyMix3Scalar(CSAMPLE* M_RESTRICT pDest,
+                           const CSAMPLE* const* ppSrc,
+                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i];
+    }
+}
+
+static void copyMix4Scalar(CSAMPLE* M_RESTRICT pDest,
+                           const CSAMPLE* const* ppSrc,
+                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i];
+    }
+}
+
+static void copyMix5Scalar(CSAMPLE* M_RESTRICT pDest,
+                           const CSAMPLE* const* ppSrc,
+                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i];
+    }
+}
+
+static void copyMix6Scalar(CSAMPLE* M_RESTRICT pDest,
+                           const CSAMPLE* const* ppSrc,
+                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i];
+    }
+}
+
+static void copyMix7Scalar(CSAMPLE* M_RESTRICT pDest,
+                           const CSAMPLE* const* ppSrc,
+                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i];
+    }
+}
+
+static void copyMix8Scalar(CSAMPLE* M_RESTRICT pDest,
+                           const CSAMPLE* const* ppSrc,
+                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    const CSAMPLE* M_RESTRICT pSrc7 = ppSrc[7];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i] + pSrc7[i];
+    }
+}
+
+static void addMix1Scalar(CSAMPLE* M_RESTRICT pDest,
+                          const CSAMPLE* const* ppSrc,
+                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i];
+    }
+}
+
+static void addMix2Scalar(CSAMPLE* M_RESTRICT pDest,
+                          const CSAMPLE* const* ppSrc,
+                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i];
+    }
+}
+
+static void addMix3Scalar(CSAMPLE* M_RESTRICT pDest,
+                          const CSAMPLE* const* ppSrc,
+                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i];
+    }
+}
+
+static void addMix4Scalar(CSAMPLE* M_RESTRICT pDest,
+                          const CSAMPLE* const* ppSrc,
+                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i];
+    }
+}
+
+static void addMix5Scalar(CSAMPLE* M_RESTRICT pDest,
+                          const CSAMPLE* const* ppSrc,
+                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i];
+    }
+}
+
+static void addMix6Scalar(CSAMPLE* M_RESTRICT pDest,
+                          const CSAMPLE* const* ppSrc,
+                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i];
+    }
+}
+
+static void addMix7Scalar(CSAMPLE* M_RESTRICT pDest,
+                          const CSAMPLE* const* ppSrc,
+                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i];
+    }
+}
+
+static void addMix8Scalar(CSAMPLE* M_RESTRICT pDest,
+                          const CSAMPLE* const* ppSrc,
+                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    const CSAMPLE* M_RESTRICT pSrc7 = ppSrc[7];
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i] + pSrc7[i];
+    }
+}
+
+static void applyRampingGainScalar(CSAMPLE* pBuffer,
+                                   CSAMPLE_GAIN gainIn,
+                                   CSAMPLE_GAIN gainOut,
+                                   int iNumSamples) {
+    const int iNumFrames = iNumSamples / 2;
+    const CSAMPLE_GAIN gainDelta = (gainOut - gainIn) / CSAMPLE_GAIN(iNumFrames);
+    const CSAMPLE_GAIN startGain = gainIn + gainDelta;
+    // note: LOOP VECTORIZED.
+    for (int frame = 0; frame < iNumFrames; ++frame) {
+        const CSAMPLE_GAIN gain = startGain + gainDelta * frame;
+        pBuffer[frame * 2] *= gain;
+        pBuffer[frame * 2 + 1] *= gain;
+    }
+}
+
+static void applyGainScalar(CSAMPLE* pBuffer,
+                            CSAMPLE_GAIN gain,
+                            int iNumSamples) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+// static
+const ChannelMixerKernels ChannelMixerKernels::kScalar = {
+    "Scalar",
+    {nullptr,
+     copyMix1Scalar,
+     copyMix2Scalar,
+     copyMix3Scalar,
+     copyMix4Scalar,
+     copyMix5Scalar,
+     copyMix6Scalar,
+     copyMix7Scalar,
+     copyMix8Scalar},
+    {nullptr,
+     addMix1Scalar,
+     addMix2Scalar,
+     addMix3Scalar,
+     addMix4Scalar,
+     addMix5Scalar,
+     addMix6Scalar,
+     addMix7Scalar,
+     addMix8Scalar},
+    applyRampingGainScalar,
+    applyGainScalar,
+};
+
+#ifdef MIXXX_CHANNELMIXER_X86
+static MIXXX_TARGET_SSE2 void copyMix1SSE2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pSrc0 + i);
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void copyMix2SSE2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pSrc0 + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void copyMix3SSE2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pSrc0 + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void copyMix4SSE2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pSrc0 + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void copyMix5SSE2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pSrc0 + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc4 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void copyMix6SSE2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pSrc0 + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc4 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc5 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void copyMix7SSE2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pSrc0 + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc4 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc5 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc6 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void copyMix8SSE2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    const CSAMPLE* M_RESTRICT pSrc7 = ppSrc[7];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pSrc0 + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc4 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc5 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc6 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc7 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i] + pSrc7[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void addMix1SSE2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pDest + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc0 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void addMix2SSE2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pDest + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc0 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void addMix3SSE2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pDest + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc0 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void addMix4SSE2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pDest + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc0 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void addMix5SSE2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pDest + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc0 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc4 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void addMix6SSE2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pDest + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc0 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc4 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc5 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void addMix7SSE2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pDest + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc0 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc4 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc5 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc6 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void addMix8SSE2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    const CSAMPLE* M_RESTRICT pSrc7 = ppSrc[7];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        __m128 sum = _mm_loadu_ps(pDest + i);
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc0 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc1 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc2 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc3 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc4 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc5 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc6 + i));
+        sum = _mm_add_ps(sum, _mm_loadu_ps(pSrc7 + i));
+        _mm_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i] + pSrc7[i];
+    }
+}
+
+static MIXXX_TARGET_SSE2 void applyRampingGainSSE2(CSAMPLE* pBuffer,
+                                                   CSAMPLE_GAIN gainIn,
+                                                   CSAMPLE_GAIN gainOut,
+                                                   int iNumSamples) {
+    const int iNumFrames = iNumSamples / 2;
+    const CSAMPLE_GAIN gainDelta = (gainOut - gainIn) / CSAMPLE_GAIN(iNumFrames);
+    const CSAMPLE_GAIN startGain = gainIn + gainDelta;
+    const __m128 vStartGain = _mm_set1_ps(startGain);
+    const __m128 vGainDelta = _mm_set1_ps(gainDelta);
+    const __m128 vFrameStep = _mm_set1_ps(2.0f);
+    // The frame index of each sample in the vector, both samples of a stereo frame share the same gain.
+    __m128 vFrameIndex = _mm_set_ps(1.0f, 1.0f, 0.0f, 0.0f);
+    int frame = 0;
+    for (; frame + 2 <= iNumFrames; frame += 2) {
+        const __m128 vGain = _mm_add_ps(vStartGain, _mm_mul_ps(vGainDelta, vFrameIndex));
+        _mm_storeu_ps(pBuffer + frame * 2, _mm_mul_ps(_mm_loadu_ps(pBuffer + frame * 2), vGain));
+        vFrameIndex = _mm_add_ps(vFrameIndex, vFrameStep);
+    }
+    for (; frame < iNumFrames; ++frame) {
+        const CSAMPLE_GAIN gain = startGain + gainDelta * frame;
+        pBuffer[frame * 2] *= gain;
+        pBuffer[frame * 2 + 1] *= gain;
+    }
+}
+
+static MIXXX_TARGET_SSE2 void applyGainSSE2(CSAMPLE* pBuffer,
+                                            CSAMPLE_GAIN gain,
+                                            int iNumSamples) {
+    const __m128 vGain = _mm_set1_ps(gain);
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        _mm_storeu_ps(pBuffer + i, _mm_mul_ps(_mm_loadu_ps(pBuffer + i), vGain));
+    }
+    for (; i < iNumSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+// static
+const ChannelMixerKernels ChannelMixerKernels::kSSE2 = {
+    "SSE2",
+    {nullptr,
+     copyMix1SSE2,
+     copyMix2SSE2,
+     copyMix3SSE2,
+     copyMix4SSE2,
+     copyMix5SSE2,
+     copyMix6SSE2,
+     copyMix7SSE2,
+     copyMix8SSE2},
+    {nullptr,
+     addMix1SSE2,
+     addMix2SSE2,
+     addMix3SSE2,
+     addMix4SSE2,
+     addMix5SSE2,
+     addMix6SSE2,
+     addMix7SSE2,
+     addMix8SSE2},
+    applyRampingGainSSE2,
+    applyGainSSE2,
+};
+#endif // MIXXX_CHANNELMIXER_X86
+
+#ifdef MIXXX_CHANNELMIXER_X86
+static MIXXX_TARGET_AVX2 void copyMix1AVX2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pSrc0 + i);
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void copyMix2AVX2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pSrc0 + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void copyMix3AVX2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pSrc0 + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void copyMix4AVX2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pSrc0 + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void copyMix5AVX2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pSrc0 + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc4 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void copyMix6AVX2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pSrc0 + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc4 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc5 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void copyMix7AVX2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pSrc0 + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc4 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc5 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc6 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void copyMix8AVX2(CSAMPLE* M_RESTRICT pDest,
+                                           const CSAMPLE* const* ppSrc,
+                                           int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    const CSAMPLE* M_RESTRICT pSrc7 = ppSrc[7];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pSrc0 + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc4 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc5 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc6 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc7 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i] + pSrc7[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void addMix1AVX2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pDest + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc0 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void addMix2AVX2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pDest + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc0 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void addMix3AVX2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pDest + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc0 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void addMix4AVX2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pDest + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc0 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void addMix5AVX2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pDest + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc0 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc4 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void addMix6AVX2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pDest + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc0 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc4 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc5 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void addMix7AVX2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pDest + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc0 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc4 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc5 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc6 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void addMix8AVX2(CSAMPLE* M_RESTRICT pDest,
+                                          const CSAMPLE* const* ppSrc,
+                                          int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    const CSAMPLE* M_RESTRICT pSrc7 = ppSrc[7];
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        __m256 sum = _mm256_loadu_ps(pDest + i);
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc0 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc1 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc2 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc3 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc4 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc5 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc6 + i));
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(pSrc7 + i));
+        _mm256_storeu_ps(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i] + pSrc7[i];
+    }
+}
+
+static MIXXX_TARGET_AVX2 void applyRampingGainAVX2(CSAMPLE* pBuffer,
+                                                   CSAMPLE_GAIN gainIn,
+                                                   CSAMPLE_GAIN gainOut,
+                                                   int iNumSamples) {
+    const int iNumFrames = iNumSamples / 2;
+    const CSAMPLE_GAIN gainDelta = (gainOut - gainIn) / CSAMPLE_GAIN(iNumFrames);
+    const CSAMPLE_GAIN startGain = gainIn + gainDelta;
+    const __m256 vStartGain = _mm256_set1_ps(startGain);
+    const __m256 vGainDelta = _mm256_set1_ps(gainDelta);
+    const __m256 vFrameStep = _mm256_set1_ps(4.0f);
+    // The frame index of each sample in the vector, both samples of a stereo frame share the same gain.
+    __m256 vFrameIndex = _mm256_set_ps(3.0f, 3.0f, 2.0f, 2.0f, 1.0f, 1.0f, 0.0f, 0.0f);
+    int frame = 0;
+    for (; frame + 4 <= iNumFrames; frame += 4) {
+        const __m256 vGain = _mm256_add_ps(vStartGain, _mm256_mul_ps(vGainDelta, vFrameIndex));
+        _mm256_storeu_ps(pBuffer + frame * 2, _mm256_mul_ps(_mm256_loadu_ps(pBuffer + frame * 2), vGain));
+        vFrameIndex = _mm256_add_ps(vFrameIndex, vFrameStep);
+    }
+    for (; frame < iNumFrames; ++frame) {
+        const CSAMPLE_GAIN gain = startGain + gainDelta * frame;
+        pBuffer[frame * 2] *= gain;
+        pBuffer[frame * 2 + 1] *= gain;
+    }
+}
+
+static MIXXX_TARGET_AVX2 void applyGainAVX2(CSAMPLE* pBuffer,
+                                            CSAMPLE_GAIN gain,
+                                            int iNumSamples) {
+    const __m256 vGain = _mm256_set1_ps(gain);
+    int i = 0;
+    for (; i + 8 <= iNumSamples; i += 8) {
+        _mm256_storeu_ps(pBuffer + i, _mm256_mul_ps(_mm256_loadu_ps(pBuffer + i), vGain));
+    }
+    for (; i < iNumSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+// static
+const ChannelMixerKernels ChannelMixerKernels::kAVX2 = {
+    "AVX2",
+    {nullptr,
+     copyMix1AVX2,
+     copyMix2AVX2,
+     copyMix3AVX2,
+     copyMix4AVX2,
+     copyMix5AVX2,
+     copyMix6AVX2,
+     copyMix7AVX2,
+     copyMix8AVX2},
+    {nullptr,
+     addMix1AVX2,
+     addMix2AVX2,
+     addMix3AVX2,
+     addMix4AVX2,
+     addMix5AVX2,
+     addMix6AVX2,
+     addMix7AVX2,
+     addMix8AVX2},
+    applyRampingGainAVX2,
+    applyGainAVX2,
+};
+#endif // MIXXX_CHANNELMIXER_X86
+
+#ifdef MIXXX_CHANNELMIXER_NEON
+static const float kNeonFrameOffsets[4] = {0.0f, 0.0f, 1.0f, 1.0f};
+
+static void copyMix1NEON(CSAMPLE* M_RESTRICT pDest,
+                         const CSAMPLE* const* ppSrc,
+                         int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pSrc0 + i);
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i];
+    }
+}
+
+static void copyMix2NEON(CSAMPLE* M_RESTRICT pDest,
+                         const CSAMPLE* const* ppSrc,
+                         int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pSrc0 + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i];
+    }
+}
+
+static void copyMix3NEON(CSAMPLE* M_RESTRICT pDest,
+                         const CSAMPLE* const* ppSrc,
+                         int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pSrc0 + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i];
+    }
+}
+
+static void copyMix4NEON(CSAMPLE* M_RESTRICT pDest,
+                         const CSAMPLE* const* ppSrc,
+                         int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pSrc0 + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i];
+    }
+}
+
+static void copyMix5NEON(CSAMPLE* M_RESTRICT pDest,
+                         const CSAMPLE* const* ppSrc,
+                         int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pSrc0 + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc4 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i];
+    }
+}
+
+static void copyMix6NEON(CSAMPLE* M_RESTRICT pDest,
+                         const CSAMPLE* const* ppSrc,
+                         int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pSrc0 + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc4 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc5 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i];
+    }
+}
+
+static void copyMix7NEON(CSAMPLE* M_RESTRICT pDest,
+                         const CSAMPLE* const* ppSrc,
+                         int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pSrc0 + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc4 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc5 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc6 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i];
+    }
+}
+
+static void copyMix8NEON(CSAMPLE* M_RESTRICT pDest,
+                         const CSAMPLE* const* ppSrc,
+                         int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    const CSAMPLE* M_RESTRICT pSrc7 = ppSrc[7];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pSrc0 + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc4 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc5 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc6 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc7 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i] + pSrc7[i];
+    }
+}
+
+static void addMix1NEON(CSAMPLE* M_RESTRICT pDest,
+                        const CSAMPLE* const* ppSrc,
+                        int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pDest + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc0 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i];
+    }
+}
+
+static void addMix2NEON(CSAMPLE* M_RESTRICT pDest,
+                        const CSAMPLE* const* ppSrc,
+                        int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pDest + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc0 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i];
+    }
+}
+
+static void addMix3NEON(CSAMPLE* M_RESTRICT pDest,
+                        const CSAMPLE* const* ppSrc,
+                        int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pDest + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc0 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i];
+    }
+}
+
+static void addMix4NEON(CSAMPLE* M_RESTRICT pDest,
+                        const CSAMPLE* const* ppSrc,
+                        int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pDest + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc0 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i];
+    }
+}
+
+static void addMix5NEON(CSAMPLE* M_RESTRICT pDest,
+                        const CSAMPLE* const* ppSrc,
+                        int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pDest + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc0 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc4 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i];
+    }
+}
+
+static void addMix6NEON(CSAMPLE* M_RESTRICT pDest,
+                        const CSAMPLE* const* ppSrc,
+                        int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pDest + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc0 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc4 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc5 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i];
+    }
+}
+
+static void addMix7NEON(CSAMPLE* M_RESTRICT pDest,
+                        const CSAMPLE* const* ppSrc,
+                        int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pDest + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc0 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc4 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc5 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc6 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i];
+    }
+}
+
+static void addMix8NEON(CSAMPLE* M_RESTRICT pDest,
+                        const CSAMPLE* const* ppSrc,
+                        int iNumSamples) {
+    const CSAMPLE* M_RESTRICT pSrc0 = ppSrc[0];
+    const CSAMPLE* M_RESTRICT pSrc1 = ppSrc[1];
+    const CSAMPLE* M_RESTRICT pSrc2 = ppSrc[2];
+    const CSAMPLE* M_RESTRICT pSrc3 = ppSrc[3];
+    const CSAMPLE* M_RESTRICT pSrc4 = ppSrc[4];
+    const CSAMPLE* M_RESTRICT pSrc5 = ppSrc[5];
+    const CSAMPLE* M_RESTRICT pSrc6 = ppSrc[6];
+    const CSAMPLE* M_RESTRICT pSrc7 = ppSrc[7];
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        float32x4_t sum = vld1q_f32(pDest + i);
+        sum = vaddq_f32(sum, vld1q_f32(pSrc0 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc1 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc2 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc3 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc4 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc5 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc6 + i));
+        sum = vaddq_f32(sum, vld1q_f32(pSrc7 + i));
+        vst1q_f32(pDest + i, sum);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pDest[i] + pSrc0[i] + pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i] + pSrc5[i] + pSrc6[i] + pSrc7[i];
+    }
+}
+
+static void applyRampingGainNEON(CSAMPLE* pBuffer,
+                                 CSAMPLE_GAIN gainIn,
+                                 CSAMPLE_GAIN gainOut,
+                                 int iNumSamples) {
+    const int iNumFrames = iNumSamples / 2;
+    const CSAMPLE_GAIN gainDelta = (gainOut - gainIn) / CSAMPLE_GAIN(iNumFrames);
+    const CSAMPLE_GAIN startGain = gainIn + gainDelta;
+    const float32x4_t vStartGain = vdupq_n_f32(startGain);
+    const float32x4_t vGainDelta = vdupq_n_f32(gainDelta);
+    const float32x4_t vFrameStep = vdupq_n_f32(2.0f);
+    // The frame index of each sample in the vector, both samples of a stereo frame share the same gain.
+    float32x4_t vFrameIndex = vld1q_f32(kNeonFrameOffsets);
+    int frame = 0;
+    for (; frame + 2 <= iNumFrames; frame += 2) {
+        const float32x4_t vGain = vaddq_f32(vStartGain, vmulq_f32(vGainDelta, vFrameIndex));
+        vst1q_f32(pBuffer + frame * 2, vmulq_f32(vld1q_f32(pBuffer + frame * 2), vGain));
+        vFrameIndex = vaddq_f32(vFrameIndex, vFrameStep);
+    }
+    for (; frame < iNumFrames; ++frame) {
+        const CSAMPLE_GAIN gain = startGain + gainDelta * frame;
+        pBuffer[frame * 2] *= gain;
+        pBuffer[frame * 2 + 1] *= gain;
+    }
+}
+
+static void applyGainNEON(CSAMPLE* pBuffer,
+                          CSAMPLE_GAIN gain,
+                          int iNumSamples) {
+    const float32x4_t vGain = vdupq_n_f32(gain);
+    int i = 0;
+    for (; i + 4 <= iNumSamples; i += 4) {
+        vst1q_f32(pBuffer + i, vmulq_f32(vld1q_f32(pBuffer + i), vGain));
+    }
+    for (; i < iNumSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+// static
+const ChannelMixerKernels ChannelMixerKernels::kNEON = {
+    "NEON",
+    {nullptr,
+     copyMix1NEON,
+     copyMix2NEON,
+     copyMix3NEON,
+     copyMix4NEON,
+     copyMix5NEON,
+     copyMix6NEON,
+     copyMix7NEON,
+     copyMix8NEON},
+    {nullptr,
+     addMix1NEON,
+     addMix2NEON,
+     addMix3NEON,
+     addMix4NEON,
+     addMix5NEON,
+     addMix6NEON,
+     addMix7NEON,
+     addMix8NEON},
+    applyRampingGainNEON,
+    applyGainNEON,
+};
+#endif // MIXXX_CHANNELMIXER_NEON
@@ -0,0 +1,55 @@
+#ifndef CHANNELMIXERKERNELS_H
+#define CHANNELMIXERKERNELS_H
+
+#include "util/platform.h"
+#include "util/types.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MIXXX_CHANNELMIXER_X86
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MIXXX_CHANNELMIXER_NEON
+#endif
+
+// Instruction set specific implementations of the inner loops of
+// ChannelMixer. The kernels are generated by
+// scripts/generate_sample_functions.py into channelmixer_kernels_autogen.cpp.
+// ChannelMixer picks the table matching the CPU at EngineMaster startup.
+struct ChannelMixerKernels {
+    // The maximum number of source buffers that are mixed in a single pass.
+    // More buffers are mixed by accumulating several passes.
+    static constexpr int kMaxUnrolledChannels = 8;
+
+    // pDest[i] = ppSrc[0][i] + ... + ppSrc[n - 1][i]
+    typedef void (*CopyMixFunction)(CSAMPLE* M_RESTRICT pDest,
+            const CSAMPLE* const* ppSrc, int iNumSamples);
+    // pDest[i] = pDest[i] + ppSrc[0][i] + ... + ppSrc[n - 1][i]
+    typedef void (*AddMixFunction)(CSAMPLE* M_RESTRICT pDest,
+            const CSAMPLE* const* ppSrc, int iNumSamples);
+    // Multiplies each stereo frame of pBuffer with a gain that ramps
+    // linearly from gainIn to gainOut.
+    typedef void (*RampingGainFunction)(CSAMPLE* pBuffer,
+            CSAMPLE_GAIN gainIn, CSAMPLE_GAIN gainOut, int iNumSamples);
+    // Multiplies each sample of pBuffer with gain.
+    typedef void (*GainFunction)(CSAMPLE* pBuffer,
+            CSAMPLE_GAIN gain, int iNumSamples);
+
+    const char* name;
+    // Indexed by the number of source buffers, index 0 is unused.
+    CopyMixFunction copyMix[kMaxUnrolledChannels + 1];
+    AddMixFunction addMix[kMaxUnrolledChannels + 1];
+    RampingGainFunction applyRampingGain;
+    GainFunction applyGain;
+
+    static const ChannelMixerKernels kScalar;
+#ifdef MIXXX_CHANNELMIXER_X86
+    static const ChannelMixerKernels kSSE2;
+    static const ChannelMixerKernels kAVX2;
+#endif
+#ifdef MIXXX_CHANNELMIXER_NEON
+    static const ChannelMixerKernels kNEON;
+#endif
+};
+
+#endif /* CHANNELMIXERKERNELS_H */
@@ -811,6 +811,9 @@ void CueControl::hotcuePositionChanged(HotcueControl* pControl, double newPositi
 
 void CueControl::hintReader(HintVector* pHintList) {
     Hint cue_hint;
+    // Cue points are jump targets that must be available immediately,
+    // no matter how far away from the playhead they are.
+    cue_hint.pinned = true;
     double cuePoint = m_pCuePoint->get();
     if (cuePoint >= 0) {
         cue_hint.frame = SampleUtil::floorPlayPosToFrame(m_pCuePoint->get());
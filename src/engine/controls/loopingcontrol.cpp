@@ -433,6 +433,9 @@ double LoopingControl::nextTrigger(bool reverse,
 void LoopingControl::hintReader(HintVector* pHintList) {
     LoopSamples loopSamples = m_loopSamples.getValue();
     Hint loop_hint;
+    // Keep the loop boundaries cached even when playing far away from them,
+    // so (re-)entering the loop never hits a cache miss.
+    loop_hint.pinned = true;
     // If the loop is enabled, then this is high priority because we will loop
     // sometime potentially very soon! The current audio itself is priority 1,
     // but we will issue ourselves at priority 2.
@@ -4,6 +4,7 @@
 #include "engine/effects/engineeffectchain.h"
 #include "engine/effects/engineeffect.h"
 
+#include "util/callbacktrace.h"
 #include "util/defs.h"
 #include "util/sample.h"
 
@@ -20,102 +21,119 @@ EngineEffectsManager::~EngineEffectsManager() {
 }
 
 void EngineEffectsManager::onCallbackStart() {
-    EffectsRequest* request = NULL;
-    while (m_pResponsePipe->readMessage(&request)) {
-        EffectsResponse response(*request);
-        bool processed = false;
-        switch (request->type) {
-            case EffectsRequest::ADD_EFFECT_RACK:
-            case EffectsRequest::REMOVE_EFFECT_RACK:
-                if (processEffectsRequest(*request, m_pResponsePipe.data())) {
-                    processed = true;
-                }
+    CallbackTrace::StageScope traceEffects(CallbackTrace::Stage::Effects);
+    EffectsRequest** ppRequest;
+    while ((ppRequest = m_pResponsePipe->peekMessage())) {
+        // All requests of a batch are applied within the same callback. If
+        // the batch has not been written completely yet, it is applied
+        // during one of the next callbacks.
+        const int batchSize = (*ppRequest)->batch_size;
+        DEBUG_ASSERT(batchSize > 0);
+        if (m_pResponsePipe->messageCount() < batchSize) {
+            break;
+        }
+        for (int i = 0; i < batchSize; ++i) {
+            EffectsRequest* request = nullptr;
+            m_pResponsePipe->readMessage(&request);
+            processRequest(request);
+        }
+    }
+}
+
+void EngineEffectsManager::processRequest(EffectsRequest* request) {
+    EffectsResponse response(*request);
+    bool processed = false;
+    switch (request->type) {
+        case EffectsRequest::ADD_EFFECT_RACK:
+        case EffectsRequest::REMOVE_EFFECT_RACK:
+            if (processEffectsRequest(*request, m_pResponsePipe.data())) {
+                processed = true;
+            }
+            break;
+        case EffectsRequest::ADD_CHAIN_TO_RACK:
+        case EffectsRequest::REMOVE_CHAIN_FROM_RACK:
+            VERIFY_OR_DEBUG_ASSERT(request->pTargetRack) {
+                response.success = false;
+                response.status = EffectsResponse::NO_SUCH_RACK;
                 break;
-            case EffectsRequest::ADD_CHAIN_TO_RACK:
-            case EffectsRequest::REMOVE_CHAIN_FROM_RACK:
-                VERIFY_OR_DEBUG_ASSERT(request->pTargetRack) {
-                    response.success = false;
-                    response.status = EffectsResponse::NO_SUCH_RACK;
-                    break;
-                }
+            }
 
-                processed = request->pTargetRack->processEffectsRequest(
-                    *request, m_pResponsePipe.data());
+            processed = request->pTargetRack->processEffectsRequest(
+                *request, m_pResponsePipe.data());
 
-                if (processed) {
-                    // When an effect-chain becomes active (part of a rack), keep
-                    // it in our master list so that we can respond to
-                    // requests about it.
-                    if (request->type == EffectsRequest::ADD_CHAIN_TO_RACK) {
-                        m_chains.append(request->AddChainToRack.pChain);
-                    } else if (request->type == EffectsRequest::REMOVE_CHAIN_FROM_RACK) {
-                        m_chains.removeAll(request->RemoveChainFromRack.pChain);
-                    }
-                } else {
-                    if (!processed) {
-                        // If we got here, the message was not handled for
-                        // an unknown reason.
-                        response.success = false;
-                        response.status = EffectsResponse::INVALID_REQUEST;
-                    }
-                }
-                break;
-            case EffectsRequest::ADD_EFFECT_TO_CHAIN:
-            case EffectsRequest::REMOVE_EFFECT_FROM_CHAIN:
-            case EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS:
-            case EffectsRequest::ENABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL:
-            case EffectsRequest::DISABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL:
-                VERIFY_OR_DEBUG_ASSERT(m_chains.contains(request->pTargetChain)) {
-                    response.success = false;
-                    response.status = EffectsResponse::NO_SUCH_CHAIN;
-                    break;
+            if (processed) {
+                // When an effect-chain becomes active (part of a rack), keep
+                // it in our master list so that we can respond to
+                // requests about it.
+                if (request->type == EffectsRequest::ADD_CHAIN_TO_RACK) {
+                    m_chains.append(request->AddChainToRack.pChain);
+                } else if (request->type == EffectsRequest::REMOVE_CHAIN_FROM_RACK) {
+                    m_chains.removeAll(request->RemoveChainFromRack.pChain);
                 }
-
-                processed = request->pTargetChain->processEffectsRequest(
-                    *request, m_pResponsePipe.data());
-                if (processed) {
-                    // When an effect becomes active (part of a chain), keep
-                    // it in our master list so that we can respond to
-                    // requests about it.
-                    if (request->type == EffectsRequest::ADD_EFFECT_TO_CHAIN) {
-                        m_effects.append(request->AddEffectToChain.pEffect);
-                    } else if (request->type == EffectsRequest::REMOVE_EFFECT_FROM_CHAIN) {
-                        m_effects.removeAll(request->RemoveEffectFromChain.pEffect);
-                    }
-                } else {
+            } else {
+                if (!processed) {
                     // If we got here, the message was not handled for
                     // an unknown reason.
                     response.success = false;
                     response.status = EffectsResponse::INVALID_REQUEST;
                 }
+            }
+            break;
+        case EffectsRequest::ADD_EFFECT_TO_CHAIN:
+        case EffectsRequest::REMOVE_EFFECT_FROM_CHAIN:
+        case EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS:
+        case EffectsRequest::ENABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL:
+        case EffectsRequest::DISABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL:
+            VERIFY_OR_DEBUG_ASSERT(m_chains.contains(request->pTargetChain)) {
+                response.success = false;
+                response.status = EffectsResponse::NO_SUCH_CHAIN;
                 break;
-            case EffectsRequest::SET_EFFECT_PARAMETERS:
-            case EffectsRequest::SET_PARAMETER_PARAMETERS:
-                VERIFY_OR_DEBUG_ASSERT(m_effects.contains(request->pTargetEffect)) {
-                    response.success = false;
-                    response.status = EffectsResponse::NO_SUCH_EFFECT;
-                    break;
-                }
-
-                processed = request->pTargetEffect
-                        ->processEffectsRequest(*request, m_pResponsePipe.data());
+            }
 
-                if (!processed) {
-                    // If we got here, the message was not handled for an
-                    // unknown reason.
-                    response.success = false;
-                    response.status = EffectsResponse::INVALID_REQUEST;
+            processed = request->pTargetChain->processEffectsRequest(
+                *request, m_pResponsePipe.data());
+            if (processed) {
+                // When an effect becomes active (part of a chain), keep
+                // it in our master list so that we can respond to
+                // requests about it.
+                if (request->type == EffectsRequest::ADD_EFFECT_TO_CHAIN) {
+                    m_effects.append(request->AddEffectToChain.pEffect);
+                } else if (request->type == EffectsRequest::REMOVE_EFFECT_FROM_CHAIN) {
+                    m_effects.removeAll(request->RemoveEffectFromChain.pEffect);
                 }
-                break;
-            default:
+            } else {
+                // If we got here, the message was not handled for
+                // an unknown reason.
+                response.success = false;
+                response.status = EffectsResponse::INVALID_REQUEST;
+            }
+            break;
+        case EffectsRequest::SET_EFFECT_PARAMETERS:
+        case EffectsRequest::SET_PARAMETER_PARAMETERS:
+            VERIFY_OR_DEBUG_ASSERT(m_effects.contains(request->pTargetEffect)) {
                 response.success = false;
-                response.status = EffectsResponse::UNHANDLED_MESSAGE_TYPE;
+                response.status = EffectsResponse::NO_SUCH_EFFECT;
                 break;
-        }
+            }
 
-        if (!processed) {
-            m_pResponsePipe->writeMessage(response);
-        }
+            processed = request->pTargetEffect
+                    ->processEffectsRequest(*request, m_pResponsePipe.data());
+
+            if (!processed) {
+                // If we got here, the message was not handled for an
+                // unknown reason.
+                response.success = false;
+                response.status = EffectsResponse::INVALID_REQUEST;
+            }
+            break;
+        default:
+            response.success = false;
+            response.status = EffectsResponse::UNHANDLED_MESSAGE_TYPE;
+            break;
+    }
+
+    if (!processed) {
+        m_pResponsePipe->writeMessage(response);
     }
 }
 
@@ -178,6 +196,7 @@ void EngineEffectsManager::processInner(
     const GroupFeatureState& groupFeatures,
     const CSAMPLE_GAIN oldGain,
     const CSAMPLE_GAIN newGain) {
+    CallbackTrace::StageScope traceEffects(CallbackTrace::Stage::Effects);
 
     const QList<EngineEffectRack*>& racks = m_racksByStage.value(stage);
     if (pIn == pOut) {
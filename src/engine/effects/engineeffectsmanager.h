@@ -64,6 +64,8 @@ class EngineEffectsManager : public EffectsRequestHandler {
         return QString("EngineEffectsManager");
     }
 
+    void processRequest(EffectsRequest* request);
+
     bool addEffectRack(EngineEffectRack* pRack, SignalProcessingStage stage);
     bool removeEffectRack(EngineEffectRack* pRack, SignalProcessingStage stage);
 
@@ -44,6 +44,7 @@ struct EffectsRequest {
     EffectsRequest()
             : type(NUM_REQUEST_TYPES),
               request_id(-1),
+              batch_size(1),
               minimum(0.0),
               maximum(0.0),
               default_value(0.0),
@@ -82,6 +83,10 @@ struct EffectsRequest {
 
     MessageType type;
     qint64 request_id;
+    // The number of requests, starting with this one, that must be applied
+    // within the same engine callback. Set by EffectsManager on the first
+    // request of a batch, 1 for all other requests.
+    int batch_size;
 
     // Target of the message.
     union {
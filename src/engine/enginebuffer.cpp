@@ -21,6 +21,7 @@
 #include "engine/controls/ratecontrol.h"
 #include "engine/bufferscalers/enginebufferscalelinear.h"
 #include "engine/bufferscalers/enginebufferscalerubberband.h"
+#include "engine/bufferscalers/enginebufferscalerubberbandlookahead.h"
 #include "engine/bufferscalers/enginebufferscalest.h"
 #include "engine/channels/enginechannel.h"
 #include "engine/enginemaster.h"
@@ -28,6 +29,7 @@
 #include "engine/readaheadmanager.h"
 #include "engine/sync/enginesync.h"
 #include "engine/sync/synccontrol.h"
+#include "mixer/playermanager.h"
 #include "track/beatfactory.h"
 #include "track/keyutils.h"
 #include "track/track.h"
@@ -87,6 +89,7 @@ EngineBuffer::EngineBuffer(const QString& group,
           m_iSeekPhaseQueued(0),
           m_iEnableSyncQueued(SYNC_REQUEST_NONE),
           m_iSyncModeQueued(SYNC_INVALID),
+          m_bProcessingConcurrently(false),
           m_iTrackLoading(0),
           m_bPlayAfterLoading(false),
           m_iSampleRate(0),
@@ -171,6 +174,8 @@ EngineBuffer::EngineBuffer(const QString& group,
 
     m_pKeylock = new ControlPushButton(ConfigKey(m_group, "keylock"), true);
     m_pKeylock->setButtonMode(ControlPushButton::TOGGLE);
+    connect(m_pKeylock, &ControlObject::valueChanged,
+            this, &EngineBuffer::slotKeylockChanged);
 
     m_pEject = new ControlPushButton(ConfigKey(m_group, "eject"));
     connect(m_pEject, &ControlObject::valueChanged,
@@ -239,11 +244,11 @@ EngineBuffer::EngineBuffer(const QString& group,
     m_pScaleLinear = new EngineBufferScaleLinear(m_pReadAheadManager);
     m_pScaleST = new EngineBufferScaleST(m_pReadAheadManager);
     m_pScaleRB = new EngineBufferScaleRubberBand(m_pReadAheadManager);
-    if (m_pKeylockEngine->get() == SOUNDTOUCH) {
-        m_pScaleKeylock = m_pScaleST;
-    } else {
-        m_pScaleKeylock = m_pScaleRB;
-    }
+    // Created when it is needed for the first time, see getKeylockScaler()
+    m_pScaleRBLookAhead.store(nullptr);
+    m_pWorkerScheduler = nullptr;
+    m_pScaleKeylock.store(getKeylockScaler(
+            static_cast<KeylockEngine>(static_cast<int>(m_pKeylockEngine->get()))));
     m_pScaleVinyl = m_pScaleLinear;
     m_pScale = m_pScaleVinyl;
     m_pScale->clear();
@@ -294,6 +299,7 @@ EngineBuffer::~EngineBuffer() {
     delete m_pScaleLinear;
     delete m_pScaleST;
     delete m_pScaleRB;
+    delete m_pScaleRBLookAhead.load();
 
     delete m_pKeylock;
     delete m_pEject;
@@ -322,7 +328,7 @@ void EngineBuffer::enableIndependentPitchTempoScaling(bool bEnable,
 
     // m_pScaleKeylock and m_pScaleVinyl could change out from under us,
     // so cache it.
-    EngineBufferScale* keylock_scale = m_pScaleKeylock;
+    EngineBufferScale* keylock_scale = m_pScaleKeylock.load(std::memory_order_acquire);
     EngineBufferScale* vinyl_scale = m_pScaleVinyl;
 
     if (bEnable && m_pScale != keylock_scale) {
@@ -419,6 +425,13 @@ void EngineBuffer::requestClonePosition(EngineChannel* pChannel) {
     atomicStoreRelaxed(m_pChannelToCloneFrom, pChannel);
 }
 
+bool EngineBuffer::canProcessConcurrently() const {
+    return !m_pSyncControl->isSynchronized() &&
+            atomicLoadRelaxed(m_iEnableSyncQueued) == SYNC_REQUEST_NONE &&
+            atomicLoadRelaxed(m_iSyncModeQueued) == SYNC_INVALID &&
+            !atomicLoadRelaxed(m_pChannelToCloneFrom);
+}
+
 void EngineBuffer::readToCrossfadeBuffer(const int iBufferSize) {
     if (!m_bCrossfadeReady) {
         // Read buffer, as if there where no parameter change
@@ -697,11 +710,48 @@ void EngineBuffer::slotKeylockEngineChanged(double dIndex) {
     // static_cast<KeylockEngine>(dIndex); direct cast produces a "not used" warning with gcc
     int iEngine = static_cast<int>(dIndex);
     KeylockEngine engine = static_cast<KeylockEngine>(iEngine);
+    m_pScaleKeylock.store(getKeylockScaler(engine), std::memory_order_release);
+}
+
+void EngineBuffer::slotKeylockChanged(double dValue) {
+    if (m_bScalerOverride || dValue == 0.0) {
+        return;
+    }
+    // The look-ahead scaler may not have been created yet
+    slotKeylockEngineChanged(m_pKeylockEngine->get());
+}
+
+EngineBufferScale* EngineBuffer::getKeylockScaler(KeylockEngine engine) {
     if (engine == SOUNDTOUCH) {
-        m_pScaleKeylock = m_pScaleST;
-    } else {
-        m_pScaleKeylock = m_pScaleRB;
+        return m_pScaleST;
+    } else if (engine != RUBBERBAND_LOOKAHEAD ||
+            !PlayerManager::isDeckGroup(m_group)) {
+        // Samplers and preview decks are rarely stretched and don't need
+        // a worker thread of their own.
+        return m_pScaleRB;
+    }
+    EngineBufferScaleRubberBandLookAhead* pScaleRBLookAhead =
+            m_pScaleRBLookAhead.load(std::memory_order_acquire);
+    if (!pScaleRBLookAhead) {
+        if (!m_pKeylock->toBool()) {
+            // Created once keylock is engaged, see slotKeylockChanged()
+            return m_pScaleRB;
+        }
+        // The look-ahead scaler runs a worker thread and an expensive
+        // time-stretcher, which are not needed unless it is selected.
+        // It is set up completely before the engine may access it.
+        auto pScale = new EngineBufferScaleRubberBandLookAhead(m_pReadAheadManager);
+        const int sampleRate = static_cast<int>(m_pSampleRate->get());
+        if (sampleRate > 0) {
+            pScale->setSampleRate(sampleRate);
+        }
+        if (m_pWorkerScheduler) {
+            pScale->setScheduler(m_pWorkerScheduler);
+        }
+        m_pScaleRBLookAhead.store(pScale, std::memory_order_release);
+        pScaleRBLookAhead = pScale;
     }
+    return pScaleRBLookAhead;
 }
 
 void EngineBuffer::processTrackLocked(
@@ -731,7 +781,11 @@ void EngineBuffer::processTrackLocked(
 
     // Update the slipped position and seek if it was disabled.
     processSlip(iBufferSize);
-    processSyncRequests();
+    // Sync requests change the sync state of other decks and must not be
+    // applied from a channel worker thread.
+    if (!m_bProcessingConcurrently) {
+        processSyncRequests();
+    }
 
     // Note: This may effects the m_filepos_play, play, scaler and crossfade buffer
     processSeek(paused);
@@ -1029,6 +1083,11 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
         m_pScaleLinear->setSampleRate(sample_rate);
         m_pScaleST->setSampleRate(sample_rate);
         m_pScaleRB->setSampleRate(sample_rate);
+        EngineBufferScaleRubberBandLookAhead* pScaleRBLookAhead =
+                m_pScaleRBLookAhead.load(std::memory_order_acquire);
+        if (pScaleRBLookAhead) {
+            pScaleRBLookAhead->setSampleRate(sample_rate);
+        }
         m_iSampleRate = sample_rate;
     }
 
@@ -1128,9 +1187,13 @@ void EngineBuffer::processSyncRequests() {
 
 void EngineBuffer::processSeek(bool paused) {
     // Check if we are cloning another channel before doing any seeking.
-    EngineChannel* pChannel = m_pChannelToCloneFrom.fetchAndStoreRelaxed(NULL);
-    if (pChannel) {
-        seekCloneBuffer(pChannel->getEngineBuffer());
+    // Cloning reads the state of the other deck, which may be processed at
+    // the same time on a channel worker thread.
+    if (!m_bProcessingConcurrently) {
+        EngineChannel* pChannel = m_pChannelToCloneFrom.fetchAndStoreRelaxed(NULL);
+        if (pChannel) {
+            seekCloneBuffer(pChannel->getEngineBuffer());
+        }
     }
 
     // We need to read position just after reading seekType, to ensure that we
@@ -1301,6 +1364,12 @@ void EngineBuffer::addControl(EngineControl* pControl) {
 
 void EngineBuffer::bindWorkers(EngineWorkerScheduler* pWorkerScheduler) {
     m_pReader->setScheduler(pWorkerScheduler);
+    m_pWorkerScheduler = pWorkerScheduler;
+    EngineBufferScaleRubberBandLookAhead* pScaleRBLookAhead =
+            m_pScaleRBLookAhead.load(std::memory_order_acquire);
+    if (pScaleRBLookAhead) {
+        pScaleRBLookAhead->setScheduler(pWorkerScheduler);
+    }
 }
 
 bool EngineBuffer::isTrackLoaded() {
@@ -1346,7 +1415,7 @@ double EngineBuffer::getTrackSamples() {
 void EngineBuffer::setScalerForTest(EngineBufferScale* pScaleVinyl,
                                     EngineBufferScale* pScaleKeylock) {
     m_pScaleVinyl = pScaleVinyl;
-    m_pScaleKeylock = pScaleKeylock;
+    m_pScaleKeylock.store(pScaleKeylock, std::memory_order_release);
     m_pScale = m_pScaleVinyl;
     m_pScale->clear();
     m_bScalerChanged = true;
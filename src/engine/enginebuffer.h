@@ -22,6 +22,8 @@
 #include <QAtomicInt>
 #include <gtest/gtest_prod.h>
 
+#include <atomic>
+
 #include "engine/cachingreader/cachingreader.h"
 #include "preferences/usersettings.h"
 #include "control/controlvalue.h"
@@ -59,6 +61,7 @@ class EngineBufferScale;
 class EngineBufferScaleLinear;
 class EngineBufferScaleST;
 class EngineBufferScaleRubberBand;
+class EngineBufferScaleRubberBandLookAhead;
 class EngineSync;
 class EngineWorkerScheduler;
 class VisualPlayPosition;
@@ -108,6 +111,7 @@ class EngineBuffer : public EngineObject {
     enum KeylockEngine {
         SOUNDTOUCH,
         RUBBERBAND,
+        RUBBERBAND_LOOKAHEAD,
         KEYLOCK_ENGINE_COUNT,
     };
 
@@ -134,6 +138,16 @@ class EngineBuffer : public EngineObject {
     void requestSyncMode(SyncMode mode);
     void requestClonePosition(EngineChannel* pChannel);
 
+    // Returns true if processing this deck does not touch the state of any
+    // other deck: it is not synchronized and has neither a pending sync nor
+    // a pending clone request.
+    bool canProcessConcurrently() const;
+    // While set, process() leaves sync and clone requests queued until the
+    // deck is processed on the engine thread again.
+    void setProcessingConcurrently(bool concurrently) {
+        m_bProcessingConcurrently = concurrently;
+    }
+
     // The process methods all run in the audio callback.
     void process(CSAMPLE* pOut, const int iBufferSize);
     void processSlip(int iBufferSize);
@@ -170,6 +184,8 @@ class EngineBuffer : public EngineObject {
             return tr("Soundtouch (faster)");
         case RUBBERBAND:
             return tr("Rubberband (better)");
+        case RUBBERBAND_LOOKAHEAD:
+            return tr("Rubberband look-ahead (best, multi-threaded)");
         default:
             return tr("Unknown (bad value)");
         }
@@ -191,6 +207,7 @@ class EngineBuffer : public EngineObject {
     void slotControlSeekAbs(double);
     void slotControlSeekExact(double);
     void slotKeylockEngineChanged(double);
+    void slotKeylockChanged(double);
 
     void slotEjectTrack(double);
 
@@ -240,6 +257,10 @@ class EngineBuffer : public EngineObject {
     void processSyncRequests();
     void processSeek(bool paused);
 
+    // Returns the scaler of the keylock engine and creates it if necessary.
+    // Must not be called from the engine thread.
+    EngineBufferScale* getKeylockScaler(KeylockEngine engine);
+
     bool updateIndicatorsAndModifyPlay(bool newPlay);
     void verifyPlay();
     void notifyTrackLoaded(TrackPointer pNewTrack, TrackPointer pOldTrack);
@@ -374,14 +395,19 @@ class EngineBuffer : public EngineObject {
     FRIEND_TEST(EngineBufferTest, RatePermTest);
     EngineBufferScale* m_pScaleVinyl;
     // The keylock engine is configurable, so it could flip flop between
-    // ScaleST and ScaleRB during a single callback.
-    EngineBufferScale* volatile m_pScaleKeylock;
+    // ScaleST and ScaleRB during a single callback. A newly created scaler
+    // is published with release semantics.
+    std::atomic<EngineBufferScale*> m_pScaleKeylock;
 
     // Object used for vinyl-style interpolation scaling of the audio
     EngineBufferScaleLinear* m_pScaleLinear;
     // Objects used for pitch-indep time stretch (key lock) scaling of the audio
     EngineBufferScaleST* m_pScaleST;
     EngineBufferScaleRubberBand* m_pScaleRB;
+    // Renders Rubberband on a worker thread ahead of the playhead. Only
+    // created for decks once it is selected and keylock is engaged.
+    std::atomic<EngineBufferScaleRubberBandLookAhead*> m_pScaleRBLookAhead;
+    EngineWorkerScheduler* m_pWorkerScheduler;
 
     // Indicates whether the scaler has changed since the last process()
     bool m_bScalerChanged;
@@ -394,6 +420,9 @@ class EngineBuffer : public EngineObject {
     QAtomicInt m_iSyncModeQueued;
     ControlValueAtomic<double> m_queuedSeekPosition;
     QAtomicPointer<EngineChannel> m_pChannelToCloneFrom;
+    // Set by EngineMaster while this deck is processed on a channel worker
+    // thread.
+    bool m_bProcessingConcurrently;
 
     // Is true if the previous buffer was silent due to pausing
     QAtomicInt m_iTrackLoading;
@@ -0,0 +1,112 @@
+#include "engine/enginechannelworkerpool.h"
+
+#ifdef __LINUX__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <QtDebug>
+
+#include "util/assert.h"
+#include "util/math.h"
+
+EngineChannelWorkerPool::WorkerThread::WorkerThread(
+        EngineChannelWorkerPool* pPool, int cpu)
+        : m_pPool(pPool),
+          m_cpu(cpu) {
+}
+
+void EngineChannelWorkerPool::WorkerThread::run() {
+    setObjectName(QString("EngineChannelWorker %1").arg(m_cpu));
+
+#ifdef __LINUX__
+    // Pin the worker to a single core so its caches stay warm between
+    // callbacks and it does not migrate behind the engine thread.
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(m_cpu, &cpuSet);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet)) {
+        qWarning() << "EngineChannelWorkerPool: Failed to pin worker to CPU" << m_cpu;
+    }
+    struct sched_param spm = { 0 };
+    spm.sched_priority = 1;
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &spm)) {
+        qWarning() << "EngineChannelWorkerPool: Failed bumping priority";
+    }
+#endif
+
+    while (true) {
+        m_semaRun.acquire();
+        if (m_pPool->m_quit.load(std::memory_order_acquire)) {
+            break;
+        }
+        m_pPool->runPendingJobs();
+    }
+}
+
+EngineChannelWorkerPool::EngineChannelWorkerPool(int numThreads)
+        : m_pTask(nullptr),
+          m_numJobs(0),
+          m_jobsRemaining(0),
+          m_jobsFinished(0),
+          m_quit(false) {
+    const int numCpus = math_max(1, QThread::idealThreadCount());
+    m_workers.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        // CPU 0 is left to the engine thread and the rest of the system.
+        const int cpu = (i + 1) % numCpus;
+        m_workers.push_back(std::make_unique<WorkerThread>(this, cpu));
+        m_workers.back()->start(QThread::TimeCriticalPriority);
+    }
+}
+
+EngineChannelWorkerPool::~EngineChannelWorkerPool() {
+    m_quit.store(true, std::memory_order_release);
+    for (const auto& pWorker : m_workers) {
+        pWorker->wake();
+    }
+    for (const auto& pWorker : m_workers) {
+        pWorker->wait();
+    }
+}
+
+void EngineChannelWorkerPool::run(Task* pTask, int numJobs) {
+    VERIFY_OR_DEBUG_ASSERT(pTask) {
+        return;
+    }
+    if (numJobs <= 0) {
+        return;
+    }
+
+    m_pTask = pTask;
+    m_numJobs = numJobs;
+    m_jobsFinished.store(0, std::memory_order_relaxed);
+    m_jobsRemaining.store(numJobs, std::memory_order_release);
+
+    // The calling thread processes one of the jobs itself, so only wake as
+    // many workers as there are jobs left over.
+    const int numWorkersToWake = math_min(numJobs - 1, numThreads());
+    for (int i = 0; i < numWorkersToWake; ++i) {
+        m_workers[i]->wake();
+    }
+
+    runPendingJobs();
+
+    // Wait for jobs that have been claimed by workers. The workers run at
+    // real-time priority and each job is bounded by a single channel's
+    // processing, so this spin is short.
+    while (m_jobsFinished.load(std::memory_order_acquire) < numJobs) {
+        QThread::yieldCurrentThread();
+    }
+}
+
+void EngineChannelWorkerPool::runPendingJobs() {
+    while (true) {
+        const int remaining = m_jobsRemaining.fetch_sub(1, std::memory_order_acq_rel);
+        if (remaining <= 0) {
+            return;
+        }
+        m_pTask->runJob(m_numJobs - remaining);
+        m_jobsFinished.fetch_add(1, std::memory_order_release);
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QSemaphore>
+#include <QThread>
+
+// EngineChannelWorkerPool runs independent pieces of engine work (e.g. the
+// process() call of each active EngineChannel) concurrently from within the
+// audio callback. All threads are created up front and pinned to a CPU core,
+// so running a batch of jobs neither allocates memory nor creates threads.
+//
+// The calling (callback) thread takes part in processing the jobs and run()
+// only returns after every job of the batch has finished. Worker threads
+// sleep on a semaphore between callbacks.
+class EngineChannelWorkerPool {
+  public:
+    // A batch of jobs. runJob() is called exactly once for every job index in
+    // [0, numJobs) and may be called from any thread of the pool, including
+    // the thread that has called run().
+    class Task {
+      public:
+        virtual ~Task() = default;
+        virtual void runJob(int jobIndex) = 0;
+    };
+
+    // Creates numThreads worker threads in addition to the calling thread.
+    explicit EngineChannelWorkerPool(int numThreads);
+    ~EngineChannelWorkerPool();
+
+    int numThreads() const {
+        return static_cast<int>(m_workers.size());
+    }
+
+    // Runs all jobs of pTask and returns when all of them have completed.
+    // Must only be called from a single thread at a time (the engine thread).
+    void run(Task* pTask, int numJobs);
+
+  private:
+    class WorkerThread : public QThread {
+      public:
+        WorkerThread(EngineChannelWorkerPool* pPool, int cpu);
+
+        void wake() {
+            m_semaRun.release();
+        }
+
+      protected:
+        void run() override;
+
+      private:
+        EngineChannelWorkerPool* const m_pPool;
+        const int m_cpu;
+        QSemaphore m_semaRun;
+    };
+
+    // Claims and runs jobs of the current batch until none are left.
+    void runPendingJobs();
+
+    std::vector<std::unique_ptr<WorkerThread>> m_workers;
+
+    // The current batch. Both are published by the release store to
+    // m_jobsRemaining in run() and only read after a successful claim.
+    Task* m_pTask;
+    int m_numJobs;
+
+    // The number of unclaimed jobs. A job is claimed by decrementing this
+    // counter. Workers that wake up late see a value <= 0 and go back to
+    // sleep without touching the batch.
+    std::atomic<int> m_jobsRemaining;
+    std::atomic<int> m_jobsFinished;
+    std::atomic<bool> m_quit;
+};
@@ -24,8 +24,13 @@
 #include "engine/sidechain/enginesidechain.h"
 #include "engine/sync/enginesync.h"
 #include "mixer/playermanager.h"
+#include "util/callbacktrace.h"
+#include "util/cmdlineargs.h"
 #include "util/defs.h"
+#include "util/math.h"
+#include "util/performancetimer.h"
 #include "util/sample.h"
+#include "util/stat.h"
 #include "util/timer.h"
 #include "util/trace.h"
 
@@ -36,6 +41,8 @@ EngineMaster::EngineMaster(UserSettingsPointer pConfig,
                            bool bEnableSidechain)
         : m_pChannelHandleFactory(pChannelHandleFactory),
           m_pEngineEffectsManager(pEffectsManager ? pEffectsManager->getEngineEffectsManager() : NULL),
+          m_channelProcessingTask(this),
+          m_bReportChannelProcessTime(CmdlineArgs::Instance().getDeveloper()),
           m_masterGainOld(0.0),
           m_boothGainOld(0.0),
           m_headphoneMasterGainOld(0.0),
@@ -63,9 +70,24 @@ EngineMaster::EngineMaster(UserSettingsPointer pConfig,
     m_bBusOutputConnected[EngineChannel::CENTER] = false;
     m_bBusOutputConnected[EngineChannel::RIGHT] = false;
     m_bExternalRecordBroadcastInputConnected = false;
+    // Pick the mixing kernels matching the CPU before the first callback.
+    ChannelMixer::selectKernels();
+
     m_pWorkerScheduler = new EngineWorkerScheduler(this);
     m_pWorkerScheduler->start(QThread::HighPriority);
 
+    // Optional pool of real-time threads that process independent channels
+    // concurrently. 0 (the default) keeps all processing on the engine thread.
+    const int channelWorkerThreads = math_clamp(
+            pConfig->getValue(ConfigKey(group, "channel_worker_threads"), 0),
+            0, math_max(0, QThread::idealThreadCount() - 1));
+    if (channelWorkerThreads > 0) {
+        qDebug() << "EngineMaster: Processing channels with"
+                 << channelWorkerThreads << "worker threads";
+        m_pChannelWorkerPool = std::make_unique<EngineChannelWorkerPool>(
+                channelWorkerThreads);
+    }
+
     // Master sample rate
     m_pMasterSampleRate = new ControlObject(ConfigKey(group, "samplerate"), true, true);
     m_pMasterSampleRate->set(44100.);
@@ -239,6 +261,7 @@ EngineMaster::~EngineMaster() {
     }
 
     delete m_pWorkerScheduler;
+    m_pChannelWorkerPool.reset();
 
     for (int i = 0; i < m_channels.size(); ++i) {
         ChannelInfo* pChannelInfo = m_channels[i];
@@ -347,17 +370,38 @@ void EngineMaster::processChannels(int iBufferSize) {
     }
 
     // Now that the list is built and ordered, do the processing.
-    for (int i = activeChannelsStartIndex;
-             i < m_activeChannels.size(); ++i) {
-        ChannelInfo* pChannelInfo = m_activeChannels[i];
-        EngineChannel* pChannel = pChannelInfo->m_pChannel;
-        pChannel->process(pChannelInfo->m_pBuffer, iBufferSize);
-
-        // Collect metadata for effects
-        if (m_pEngineEffectsManager) {
-            GroupFeatureState features;
-            pChannel->collectFeatures(&features);
-            pChannelInfo->m_features = features;
+    const int numActiveChannels = m_activeChannels.size() - activeChannelsStartIndex;
+    if (m_pChannelWorkerPool && numActiveChannels > 1) {
+        // The sync master has to be processed before all other channels
+        // because they follow its beat distance. Synchronized decks and decks
+        // with pending sync or clone requests access the state of other decks
+        // and are processed on the engine thread as well. Only the remaining,
+        // independent channels are processed concurrently.
+        m_concurrentChannels.clear();
+        for (int i = activeChannelsStartIndex;
+                 i < m_activeChannels.size(); ++i) {
+            ChannelInfo* pChannelInfo = m_activeChannels[i];
+            EngineBuffer* pBuffer = pChannelInfo->m_pChannel->getEngineBuffer();
+            if (i == 0 || (pBuffer && !pBuffer->canProcessConcurrently())) {
+                processChannel(pChannelInfo, iBufferSize);
+            } else {
+                m_concurrentChannels.append(pChannelInfo);
+            }
+        }
+        if (m_concurrentChannels.size() > 1) {
+            setProcessingConcurrently(true);
+            m_channelProcessingTask.setChannels(
+                    m_concurrentChannels.constData(), iBufferSize);
+            m_pChannelWorkerPool->run(&m_channelProcessingTask,
+                    m_concurrentChannels.size());
+            setProcessingConcurrently(false);
+        } else if (!m_concurrentChannels.isEmpty()) {
+            processChannel(m_concurrentChannels[0], iBufferSize);
+        }
+    } else {
+        for (int i = activeChannelsStartIndex;
+                 i < m_activeChannels.size(); ++i) {
+            processChannel(m_activeChannels[i], iBufferSize);
         }
     }
 
@@ -371,6 +415,38 @@ void EngineMaster::processChannels(int iBufferSize) {
     }
 }
 
+void EngineMaster::setProcessingConcurrently(bool concurrently) {
+    for (ChannelInfo* pChannelInfo : m_concurrentChannels) {
+        EngineBuffer* pBuffer = pChannelInfo->m_pChannel->getEngineBuffer();
+        if (pBuffer) {
+            pBuffer->setProcessingConcurrently(concurrently);
+        }
+    }
+}
+
+void EngineMaster::processChannel(ChannelInfo* pChannelInfo, int iBufferSize) {
+    PerformanceTimer timer;
+    if (m_bReportChannelProcessTime) {
+        timer.start();
+    }
+
+    EngineChannel* pChannel = pChannelInfo->m_pChannel;
+    pChannel->process(pChannelInfo->m_pBuffer, iBufferSize);
+
+    // Collect metadata for effects
+    if (m_pEngineEffectsManager) {
+        GroupFeatureState features;
+        pChannel->collectFeatures(&features);
+        pChannelInfo->m_features = features;
+    }
+
+    if (m_bReportChannelProcessTime) {
+        Stat::track(pChannelInfo->m_processTimeStatTagId,
+                Stat::DURATION_NANOSEC, kDefaultComputeFlags,
+                timer.elapsed().toIntegerNanos());
+    }
+}
+
 void EngineMaster::process(const int iBufferSize) {
     static bool haveSetName = false;
     if (!haveSetName) {
@@ -378,6 +454,7 @@ void EngineMaster::process(const int iBufferSize) {
         haveSetName = true;
     }
     //Trace t("EngineMaster::process");
+    CallbackTrace::StageScope traceMixer(CallbackTrace::Stage::Mixer);
 
     bool masterEnabled = m_pMasterEnabled->get();
     bool boothEnabled = m_pBoothEnabled->get();
@@ -394,11 +471,20 @@ void EngineMaster::process(const int iBufferSize) {
     }
 
     // Update internal master sync rate.
-    m_pMasterSync->onCallbackStart(m_iSampleRate, m_iBufferSize);
+    {
+        CallbackTrace::StageScope traceSync(CallbackTrace::Stage::Sync);
+        m_pMasterSync->onCallbackStart(m_iSampleRate, m_iBufferSize);
+    }
     // Prepare each channel for output
-    processChannels(m_iBufferSize);
+    {
+        CallbackTrace::StageScope traceDecks(CallbackTrace::Stage::Decks);
+        processChannels(m_iBufferSize);
+    }
     // Do internal master sync post-processing
-    m_pMasterSync->onCallbackEnd(m_iSampleRate, m_iBufferSize);
+    {
+        CallbackTrace::StageScope traceSync(CallbackTrace::Stage::Sync);
+        m_pMasterSync->onCallbackEnd(m_iSampleRate, m_iBufferSize);
+    }
 
     // Compute headphone mix
     // Head phone left/right mix
@@ -667,6 +753,8 @@ void EngineMaster::process(const int iBufferSize) {
         // so skip sending a buffer to m_pSidechain here.
         if (!m_bExternalRecordBroadcastInputConnected
             && m_pEngineSideChain != nullptr) {
+            CallbackTrace::StageScope traceSidechain(
+                    CallbackTrace::Stage::Sidechain);
             m_pEngineSideChain->writeSamples(m_pSidechainMix, iFrames);
         }
 
@@ -773,6 +861,8 @@ void EngineMaster::addChannel(EngineChannel* pChannel) {
     pChannelInfo->m_pChannel = pChannel;
     const QString& group = pChannel->getGroup();
     pChannelInfo->m_handle = m_pChannelHandleFactory->getOrCreateHandle(group);
+    pChannelInfo->m_processTimeStatTagId =
+            Stat::registerTag("EngineMaster::processChannel %1", group);
     pChannelInfo->m_pVolumeControl = new ControlAudioTaperPot(
             ConfigKey(group, "volume"), -20, 0, 1);
     pChannelInfo->m_pVolumeControl->setDefaultValue(1.0);
@@ -18,6 +18,8 @@
 #ifndef ENGINEMASTER_H
 #define ENGINEMASTER_H
 
+#include <memory>
+
 #include <QObject>
 #include <QVarLengthArray>
 
@@ -27,6 +29,7 @@
 #include "engine/engineobject.h"
 #include "engine/channels/enginechannel.h"
 #include "engine/channelhandle.h"
+#include "engine/enginechannelworkerpool.h"
 #include "soundio/soundmanager.h"
 #include "soundio/soundmanagerutil.h"
 #include "recording/recordingmanager.h"
@@ -137,6 +140,9 @@ class EngineMaster : public QObject, public AudioSource {
         ControlObject* m_pVolumeControl;
         ControlPushButton* m_pMuteControl;
         GroupFeatureState m_features;
+        // Stat key under which the time spent in m_pChannel->process() is
+        // reported in developer mode.
+        int m_processTimeStatTagId;
         int m_index;
     };
 
@@ -270,6 +276,38 @@ class EngineMaster : public QObject, public AudioSource {
     // respective output.
     void processChannels(int iBufferSize);
 
+    // Marks the engine buffers of m_concurrentChannels as being processed
+    // by m_pChannelWorkerPool.
+    void setProcessingConcurrently(bool concurrently);
+
+    // Processes a single active channel and collects its features. This may
+    // be called from a thread of m_pChannelWorkerPool.
+    void processChannel(ChannelInfo* pChannelInfo, int iBufferSize);
+
+    // Hands a contiguous range of m_activeChannels to the worker pool.
+    class ChannelProcessingTask : public EngineChannelWorkerPool::Task {
+      public:
+        explicit ChannelProcessingTask(EngineMaster* pEngineMaster)
+                : m_pEngineMaster(pEngineMaster),
+                  m_ppChannels(nullptr),
+                  m_iBufferSize(0) {
+        }
+
+        void setChannels(ChannelInfo* const* ppChannels, int iBufferSize) {
+            m_ppChannels = ppChannels;
+            m_iBufferSize = iBufferSize;
+        }
+
+        void runJob(int jobIndex) override {
+            m_pEngineMaster->processChannel(m_ppChannels[jobIndex], m_iBufferSize);
+        }
+
+      private:
+        EngineMaster* const m_pEngineMaster;
+        ChannelInfo* const* m_ppChannels;
+        int m_iBufferSize;
+    };
+
     ChannelHandleFactory* m_pChannelHandleFactory;
     void applyMasterEffects();
     void processHeadphones(const double masterMixGainInHeadphones);
@@ -287,6 +325,8 @@ class EngineMaster : public QObject, public AudioSource {
 
     // Pre-allocated buffers for performing channel mixing in the callback.
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_activeChannels;
+    // The subset of m_activeChannels handed to m_pChannelWorkerPool.
+    QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_concurrentChannels;
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_activeBusChannels[3];
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_activeHeadphoneChannels;
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_activeTalkoverChannels;
@@ -305,6 +345,14 @@ class EngineMaster : public QObject, public AudioSource {
     EngineWorkerScheduler* m_pWorkerScheduler;
     EngineSync* m_pMasterSync;
 
+    // Processes independent channels concurrently. Null if the user has not
+    // configured any channel worker threads, in which case all channels are
+    // processed serially on the engine thread.
+    std::unique_ptr<EngineChannelWorkerPool> m_pChannelWorkerPool;
+    ChannelProcessingTask m_channelProcessingTask;
+    // Whether per-channel processing times are reported to StatsManager.
+    const bool m_bReportChannelProcessTime;
+
     ControlObject* m_pMasterGain;
     ControlObject* m_pBoothGain;
     ControlObject* m_pHeadGain;
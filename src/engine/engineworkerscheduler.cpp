@@ -31,25 +31,25 @@ void EngineWorkerScheduler::addWorker(EngineWorker* pWorker) {
 
 void EngineWorkerScheduler::runWorkers() {
     // Wake the scheduler if we have written a worker-ready message to the
-    // scheduler. There is no race condition in accessing this boolean because
-    // both workerReady and runWorkers are called from the callback thread.
-    if (m_bWakeScheduler) {
-        m_bWakeScheduler = false;
+    // scheduler. workerReady may also be called from the channel worker
+    // threads, which have all finished when this is called.
+    if (m_bWakeScheduler.exchange(false)) {
         m_waitCondition.wakeAll();
     }
 }
 
 void EngineWorkerScheduler::run() {
-    static const QString tag("EngineWorkerScheduler");
+    static const int tagId = Stat::registerTag(
+            QStringLiteral("EngineWorkerScheduler"));
     while (!m_bQuit) {
-        Event::start(tag);
+        Event::start(tagId);
         {
             QMutexLocker lock(&m_mutex);
             for(const auto& pWorker: m_workers) {
                 pWorker->wakeIfReady();
             }
         }
-        Event::end(tag);
+        Event::end(tagId);
         {
             QMutexLocker lock(&m_mutex);
             if (!m_bQuit) {
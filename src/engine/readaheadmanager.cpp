@@ -213,6 +213,19 @@ void ReadAheadManager::hintReader(double dRate, HintVector* pHintList) {
     // top priority, we need to read this data immediately
     current_position.priority = 1;
     pHintList->append(current_position);
+
+    // Also keep the chunk on the other side of the play position cached,
+    // so changing the play direction (reverse, censor, scratching) does not
+    // cause a cache miss.
+    Hint opposite_direction;
+    opposite_direction.frameCount = CachingReaderChunk::kFrames;
+    if (in_reverse) {
+        opposite_direction.frame = current_position.frame + frameCountToCache;
+    } else {
+        opposite_direction.frame = current_position.frame - CachingReaderChunk::kFrames;
+    }
+    opposite_direction.priority = 2;
+    pHintList->append(opposite_direction);
 }
 
 // Not thread-save, call from engine thread only
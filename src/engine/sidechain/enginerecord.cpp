@@ -12,6 +12,7 @@
 #include "control/controlobject.h"
 #include "control/controlproxy.h"
 #include "encoder/encoder.h"
+#include "encoder/sharedencoder.h"
 
 #include "mixer/playerinfo.h"
 #include "recording/defs_recording.h"
@@ -56,10 +57,24 @@ void EngineRecord::updateFromPreferences() {
     if (m_pEncoder) {
         m_pEncoder.reset();
     }
+    m_pEncoderSubscription.reset();
     Encoder::Format format = EncoderFactory::getFactory().getSelectedFormat(m_pConfig);
     m_encoding = format.internalName;
-    m_pEncoder = EncoderFactory::getFactory().createRecordingEncoder(
-            format, m_pConfig, this);
+    EncoderRecordingSettingsPointer pSettings =
+            EncoderFactory::getFactory().getEncoderRecordingSettings(format, m_pConfig);
+
+    // If there is no metadata to write into the file, we can use the
+    // encoder of a broadcast connection with the same settings instead of
+    // encoding the same mix twice. The shared encoder is never flushed, so
+    // the recording misses the last partial frame.
+    if (m_baAuthor.isEmpty() && m_baTitle.isEmpty() && m_baAlbum.isEmpty()) {
+        m_pEncoderSubscription = SharedEncoder::join(*pSettings, m_sampleRate, this);
+        if (m_pEncoderSubscription) {
+            return;
+        }
+    }
+
+    m_pEncoder = EncoderFactory::getFactory().createEncoder(pSettings, this);
     m_pEncoder->updateMetaData(m_baAuthor, m_baTitle, m_baAlbum);
 
     QString errorMsg;
@@ -110,12 +125,13 @@ bool EngineRecord::metaDataHasChanged()
 void EngineRecord::process(const CSAMPLE* pBuffer, const int iBufferSize) {
 
     float recordingStatus = m_pRecReady->get();
-    static const QString tag("EngineRecord recording");
+    static const int tagId = Stat::registerTag(
+            QStringLiteral("EngineRecord recording"));
 
     if (recordingStatus == RECORD_OFF) {
         //qDebug("Setting record flag to: OFF");
         if (fileOpen()) {
-            Event::end(tag);
+            Event::end(tagId);
             closeFile();  // Close file and free encoder.
             if (m_bCueIsEnabled) {
                 closeCueFile();
@@ -127,7 +143,7 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const int iBufferSize) {
         // open a new file.
         updateFromPreferences();  // Update file location from preferences.
         if (openFile()) {
-            Event::start(tag);
+            Event::start(tagId);
             qDebug("Setting record flag to: ON");
             m_pRecReady->set(RECORD_ON);
             emit isRecording(true, false);  // will notify the RecordingManager
@@ -179,7 +195,7 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const int iBufferSize) {
             }
         } else {  // Maybe the encoder could not be initialized
             qDebug() << "Could not open" << m_fileName << "for writing.";
-            Event::end(tag);
+            Event::end(tagId);
             qDebug("Setting record flag to: OFF");
             m_pRecReady->slotSet(RECORD_OFF);
             // An error occurred.
@@ -192,7 +208,11 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const int iBufferSize) {
     if (m_pRecReady->get() == RECORD_ON) {
         // Compress audio. Encoder will call method 'write()' below to
         // write a file stream and emit bytesRecorded.
-        m_pEncoder->encodeBuffer(pBuffer, iBufferSize);
+        if (m_pEncoderSubscription) {
+            m_pEncoderSubscription->process(pBuffer, iBufferSize);
+        } else {
+            m_pEncoder->encodeBuffer(pBuffer, iBufferSize);
+        }
 
         //Writing cueLine before updating the time counter since we prefer to be ahead
         //rather than late.
@@ -291,9 +311,11 @@ bool EngineRecord::fileOpen() {
 
 bool EngineRecord::openFile() {
     // We can use a QFile to write compressed audio.
-    if (m_pEncoder) {
+    if (m_pEncoder || m_pEncoderSubscription) {
         m_file.setFileName(m_fileName);
         if (!m_file.open(QIODevice::WriteOnly)) {
+            // Don't keep the shared encoder busy without a file
+            m_pEncoderSubscription.reset();
             return false;
         }
         if (m_file.handle() != -1) {
@@ -304,7 +326,15 @@ bool EngineRecord::openFile() {
     }
 
     // Return whether the file is really open.
-    return fileOpen();
+    if (!fileOpen()) {
+        m_pEncoderSubscription.reset();
+        return false;
+    }
+    if (m_pEncoderSubscription) {
+        // Receives the Ogg stream header from here on
+        m_pEncoderSubscription->setActive(true);
+    }
+    return true;
 }
 
 bool EngineRecord::openCueFile() {
@@ -350,6 +380,7 @@ void EngineRecord::closeFile() {
             m_pEncoder->flush();
             m_pEncoder.reset();
         }
+        m_pEncoderSubscription.reset();
         m_file.close();
     }
 }
@@ -14,6 +14,7 @@
 #include "preferences/usersettings.h"
 #include "encoder/encodercallback.h"
 #include "encoder/encoder.h"
+#include "encoder/sharedencoder.h"
 #include "engine/sidechain/sidechainworker.h"
 #include "track/track.h"
 
@@ -69,6 +70,9 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
 
     UserSettingsPointer m_pConfig;
     EncoderPointer m_pEncoder;
+    // Used instead of m_pEncoder if a broadcast connection encodes the
+    // same format
+    SharedEncoderSubscriptionPointer m_pEncoderSubscription;
     QString m_encoding;
     QString m_fileName;
     QString m_baTitle;
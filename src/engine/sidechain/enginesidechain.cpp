@@ -38,7 +38,9 @@ EngineSideChain::EngineSideChain(UserSettingsPointer pConfig)
         : m_pConfig(pConfig),
           m_bStopThread(false),
           m_sampleFifo(SIDECHAIN_BUFFER_SIZE),
-          m_pWorkBuffer(SampleUtil::alloc(SIDECHAIN_BUFFER_SIZE)) {
+          m_pWorkBuffer(SampleUtil::alloc(SIDECHAIN_BUFFER_SIZE)),
+          m_overrunTagId(Stat::registerTag(
+                  "EngineSideChain::writeSamples buffer overrun")) {
     // We use HighPriority to prevent starvation by lower-priority processes (Qt
     // main thread, analysis, etc.). This used to be LowPriority but that is not
     // a suitable choice since we do semi-realtime tasks
@@ -91,7 +93,7 @@ void EngineSideChain::writeSamples(const CSAMPLE* pBuffer, int iFrames) {
     int samples_written = m_sampleFifo.write(pBuffer, iSamples);
 
     if (samples_written != iSamples) {
-        Counter("EngineSideChain::writeSamples buffer overrun").increment();
+        Counter(m_overrunTagId).increment();
     }
 
     if (m_sampleFifo.writeAvailable() < SIDECHAIN_BUFFER_SIZE / 5) {
@@ -106,16 +108,16 @@ void EngineSideChain::run() {
     // factor this out somehow), -kousu 2/2009
     unsigned static id = 0;
     QThread::currentThread()->setObjectName(QString("EngineSideChain %1").arg(++id));
-    static const QString tag("EngineSideChain");
-    Event::start(tag);
+    static const int tagId = Stat::registerTag(QStringLiteral("EngineSideChain"));
+    Event::start(tagId);
     while (!m_bStopThread) {
         // Sleep until samples are available.
         m_waitLock.lock();
 
-        Event::end(tag);
+        Event::end(tagId);
         m_waitForSamples.wait(&m_waitLock);
         m_waitLock.unlock();
-        Event::start(tag);
+        Event::start(tagId);
 
         int samples_read;
         while ((samples_read = m_sampleFifo.read(m_pWorkBuffer,
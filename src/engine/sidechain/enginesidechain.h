@@ -60,6 +60,7 @@ class EngineSideChain : public QThread, public AudioDestination {
 
     FIFO<CSAMPLE> m_sampleFifo;
     CSAMPLE* m_pWorkBuffer;
+    const int m_overrunTagId;
 
     // Provides thread safety around the wait condition below.
     QMutex m_waitLock;
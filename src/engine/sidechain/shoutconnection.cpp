@@ -22,6 +22,7 @@
 #include "control/controlpushbutton.h"
 #include "encoder/encoder.h"
 #include "encoder/encoderbroadcastsettings.h"
+#include "encoder/sharedencoder.h"
 #ifdef __OPUS__
 #include "encoder/encoderopus.h"
 #endif
@@ -56,7 +57,7 @@ ShoutConnection::ShoutConnection(BroadcastProfilePtr profile,
           m_iShoutFailures(0),
           m_pConfig(pConfig),
           m_pProfile(profile),
-          m_encoder(nullptr),
+          m_pEncoderSubscription(nullptr),
           m_pMasterSamplerate(new ControlProxy("[Master]", "samplerate", this)),
           m_pBroadcastEnabled(new ControlProxy(BROADCAST_PREF_KEY, "enabled", this)),
           m_custom_metadata(false),
@@ -185,10 +186,10 @@ void ShoutConnection::updateFromPreferences() {
 
     setState(NETWORKSTREAMWORKER_STATE_BUSY);
 
-    // Delete m_encoder if it has been initialized (with maybe) different bitrate.
-    // delete m_encoder calls write() check if it will be exit early
+    // Unsubscribe from the encoder, it has been initialized with maybe
+    // different settings.
     DEBUG_ASSERT(m_iShoutStatus != SHOUTERR_CONNECTED);
-    m_encoder.reset();
+    m_pEncoderSubscription.reset();
 
     m_format_is_mp3 = false;
     m_format_is_ov = false;
@@ -436,22 +437,16 @@ void ShoutConnection::updateFromPreferences() {
         return;
     }
 
-    // Initialize m_encoder
+    // Subscribe to the encoder, which is shared with all other connections
+    // and a recording with the same settings
     EncoderSettingsPointer pBroadcastSettings =
             std::make_shared<EncoderBroadcastSettings>(m_pProfile);
-    m_encoder = EncoderFactory::getFactory().createEncoder(
-                    pBroadcastSettings, this);
-
-    QString errorMsg;
-    if(m_encoder->initEncoder(iMasterSamplerate, errorMsg) < 0) {
+    m_pEncoderSubscription = SharedEncoder::subscribe(
+            pBroadcastSettings, iMasterSamplerate, this);
+    if (!m_pEncoderSubscription) {
         // e.g., if lame is not found
-        // init m_encoder itself will display a message box
+        // init of the encoder itself will display a message box
         kLogger.warning() << "**** Encoder init failed";
-        kLogger.warning() << errorMsg;
-
-        // delete m_encoder calls write() make sure it will be exit early
-        DEBUG_ASSERT(m_iShoutStatus != SHOUTERR_CONNECTED);
-        m_encoder.reset();
 
         setState(NETWORKSTREAMWORKER_STATE_ERROR);
         m_lastErrorStr = "Encoder error";
@@ -476,7 +471,7 @@ bool ShoutConnection::processConnect() {
     // Make sure that we call updateFromPreferences always
     updateFromPreferences();
 
-    if (!m_encoder) {
+    if (!m_pEncoderSubscription) {
         // updateFromPreferences failed
         setStatus(BroadcastProfile::STATUS_FAILURE);
         kLogger.warning() << "ShoutOutput::processConnect() returning false";
@@ -573,6 +568,7 @@ bool ShoutConnection::processConnect() {
             	m_pOutputFifo->flushReadData(m_pOutputFifo->readAvailable());
             }
             m_threadWaiting = true;
+            m_pEncoderSubscription->setActive(true);
 
             setStatus(BroadcastProfile::STATUS_CONNECTED);
             emit broadcastConnected();
@@ -594,9 +590,8 @@ bool ShoutConnection::processConnect() {
 
     // no connection, clean up
     shout_close(m_pShout);
-    // delete m_encoder calls write() check if it will be exit early
     DEBUG_ASSERT(m_iShoutStatus != SHOUTERR_CONNECTED);
-    m_encoder.reset();
+    m_pEncoderSubscription.reset();
     if (m_pProfile->getEnabled()) {
         setStatus(BroadcastProfile::STATUS_FAILURE);
     } else {
@@ -619,9 +614,8 @@ bool ShoutConnection::processDisconnect() {
         emit broadcastDisconnected();
         disconnected = true;
     }
-    // delete m_encoder calls write() check if it will be exit early
     DEBUG_ASSERT(m_iShoutStatus != SHOUTERR_CONNECTED);
-    m_encoder.reset();
+    m_pEncoderSubscription.reset();
     return disconnected;
 }
 
@@ -707,11 +701,21 @@ void ShoutConnection::process(const CSAMPLE* pBuffer, const int iBufferSize) {
     if (m_iShoutStatus != SHOUTERR_CONNECTED)
         return;
 
-    // If we are connected, encode the samples.
-    if (iBufferSize > 0 && m_encoder) {
+    // If we are connected, encode the samples. The local pointer keeps the
+    // subscription alive if write() reconnects.
+    SharedEncoderSubscriptionPointer pEncoderSubscription = m_pEncoderSubscription;
+    if (pEncoderSubscription) {
         setFunctionCode(6);
-        m_encoder->encodeBuffer(pBuffer, iBufferSize);
+        pEncoderSubscription->process(pBuffer, iBufferSize);
         // the encoded frames are received by the write() callback.
+        if (pEncoderSubscription == m_pEncoderSubscription &&
+                pEncoderSubscription->takeOverflowCount() > 0) {
+            // We are not able to send the packets of the shared encoder
+            // as fast as they are encoded
+            m_lastErrorStr = tr("Network cache overflow");
+            tryReconnect();
+            return;
+        }
     }
 
     // Check if track metadata has changed and if so, update.
@@ -19,6 +19,7 @@
 #include "control/controlproxy.h"
 #include "encoder/encodercallback.h"
 #include "encoder/encoder.h"
+#include "encoder/sharedencoder.h"
 #include "errordialoghandler.h"
 #include "preferences/usersettings.h"
 #include "track/track.h"
@@ -127,7 +128,7 @@ class ShoutConnection
     long m_iShoutFailures;
     UserSettingsPointer m_pConfig;
     BroadcastProfilePtr m_pProfile;
-    EncoderPointer m_encoder;
+    SharedEncoderSubscriptionPointer m_pEncoderSubscription;
     ControlProxy* m_pMasterSamplerate;
     ControlProxy* m_pBroadcastEnabled;
     // static metadata according to prefereneces
@@ -3,6 +3,12 @@
 
 #include "library/basetrackcache.h"
 
+#include <QFuture>
+#include <QThread>
+#include <QtConcurrentRun>
+
+#include <algorithm>
+
 #include "library/trackcollection.h"
 #include "library/searchqueryparser.h"
 #include "library/queryutil.h"
@@ -10,11 +16,35 @@
 #include "track/globaltrackcache.h"
 #include "util/performancetimer.h"
 #include "util/compatibility.h"
+#include "util/math.h"
 
 namespace {
 
 constexpr bool sDebug = false;
 
+// Searching is split into chunks of at least this many tracks that are
+// processed on different threads
+constexpr int kMinSearchChunkSize = 8192;
+
+// The leading integer of a track number like "3/12", or 0 if there is
+// none. Same as CAST(... AS INTEGER) when sorting in the database.
+double leadingInteger(const QString& text) {
+    int i = 0;
+    while (i < text.size() && text[i].isSpace()) {
+        ++i;
+    }
+    bool negative = false;
+    if (i < text.size() && (text[i] == '-' || text[i] == '+')) {
+        negative = text[i] == '-';
+        ++i;
+    }
+    double value = 0.0;
+    for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i) {
+        value = value * 10 + (text[i].unicode() - '0');
+    }
+    return negative ? -value : value;
+}
+
 }  // namespace
 
 BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
@@ -28,8 +58,11 @@ BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
           m_columnsJoined(columns.join(",")),
           m_columnCache(columns),
           m_pQueryParser(new SearchQueryParser(pTrackCollection)),
+          m_pCrateStorage(&pTrackCollection->crates()),
           m_bIndexBuilt(false),
           m_bIsCaching(isCaching),
+          m_trackColumns(columns.size()),
+          m_keySortRanksNotation(KeyUtils::KeyNotation::Invalid),
           m_database(pTrackCollection->database()) {
     m_searchColumns << "artist"
                     << "album"
@@ -41,12 +74,7 @@ BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
                     << "genre"
                     << "crate";
 
-    // Convert all the search column names to their field indexes because we use
-    // them a bunch.
-    m_searchColumnIndices.resize(m_searchColumns.size());
-    for (int i = 0; i < m_searchColumns.size(); ++i) {
-        m_searchColumnIndices[i] = m_columnCache.fieldIndex(m_searchColumns[i]);
-    }
+    updateSearchColumnIndices();
 }
 
 BaseTrackCache::~BaseTrackCache() {
@@ -97,7 +125,7 @@ void BaseTrackCache::slotTracksRemoved(QSet<TrackId> trackIds) {
         qDebug() << this << "slotTracksRemoved" << trackIds.size();
     }
     for (const auto& trackId : qAsConst(trackIds)) {
-        m_trackInfo.remove(trackId);
+        m_trackColumns.removeRow(trackId);
         m_dirtyTracks.remove(trackId);
     }
 }
@@ -127,7 +155,7 @@ void BaseTrackCache::slotTrackClean(TrackId trackId) {
 }
 
 bool BaseTrackCache::isCached(TrackId trackId) const {
-    return m_trackInfo.contains(trackId);
+    return m_trackColumns.contains(trackId);
 }
 
 void BaseTrackCache::ensureCached(TrackId trackId) {
@@ -140,6 +168,17 @@ void BaseTrackCache::ensureCached(QSet<TrackId> trackIds) {
 
 void BaseTrackCache::setSearchColumns(const QStringList& columns) {
     m_searchColumns = columns;
+    updateSearchColumnIndices();
+}
+
+void BaseTrackCache::updateSearchColumnIndices() {
+    // Convert all the search column names to their field indexes because we use
+    // them a bunch.
+    m_searchColumnIndices.resize(m_searchColumns.size());
+    for (int i = 0; i < m_searchColumns.size(); ++i) {
+        m_searchColumnIndices[i] = m_columnCache.fieldIndex(m_searchColumns[i]);
+    }
+    m_trackColumns.setSearchColumns(m_searchColumnIndices);
 }
 
 const TrackPointer& BaseTrackCache::getRecentTrack(TrackId trackId) const {
@@ -232,14 +271,11 @@ bool BaseTrackCache::updateIndexWithTrackpointer(TrackPointer pTrack) {
 
     TrackId trackId = pTrack->getId();
     if (trackId.isValid()) {
-        // m_trackInfo[id] will insert a QVector<QVariant> into the
-        // m_trackInfo HashTable with the key "id"
-        QVector<QVariant>& record = m_trackInfo[trackId];
-        // preallocate memory for all columns at once
-        record.resize(numColumns);
+        QVector<QVariant> record(numColumns);
         for (int i = 0; i < numColumns; ++i) {
             getTrackValueForColumn(pTrack, i, record[i]);
         }
+        m_trackColumns.updateRow(trackId, record);
         if (m_bIsCaching) {
             replaceRecentTrack(std::move(trackId), std::move(pTrack));
         }
@@ -277,14 +313,11 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
     int numColumns = columnCount();
     int idColumn = query.record().indexOf(m_idColumn);
 
+    // Reused for all rows
+    QVector<QVariant> record(numColumns);
     while (query.next()) {
         TrackId trackId(query.value(idColumn));
 
-        //m_trackInfo[id] will insert a QVector<QVariant> into the
-        //m_trackInfo HashTable with the key "id"
-        QVector<QVariant>& record = m_trackInfo[trackId];
-        record.resize(numColumns);
-
         for (int i = 0; i < numColumns; ++i) {
             if (fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_NATIVELOCATION) == i) {
                 // Database stores all locations with Qt separators: "/"
@@ -296,6 +329,7 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
                 record[i] = query.value(i);
             }
         }
+        m_trackColumns.updateRow(trackId, record);
     }
 
     qDebug() << this << "updateIndexWithQuery took" << timer.elapsed().debugMillisWithUnit();
@@ -317,7 +351,7 @@ void BaseTrackCache::buildIndex() {
     // TODO(rryan) for very large tables, it probably makes more sense to NOT
     // clear the table, and keep track of what IDs we see, then delete the ones
     // we don't see.
-    m_trackInfo.clear();
+    m_trackColumns.clear();
 
     if (!updateIndexWithQuery(queryString)) {
         qDebug() << "buildIndex failed!";
@@ -453,11 +487,10 @@ QVariant BaseTrackCache::data(TrackId trackId, int column) const {
     // TODO(rryan) this code is flawed for columns that contains row-specific
     // metadata. Currently the upper-levels will not delegate row-specific
     // columns to this method, but there should still be a check here I think.
-    if (!result.isValid()) {
-        auto it = m_trackInfo.constFind(trackId);
-        if (it != m_trackInfo.constEnd()) {
-            const QVector<QVariant>& fields = it.value();
-            result = fields.value(column, result);
+    if (!result.isValid() && column >= 0 && column < columnCount()) {
+        const int row = m_trackColumns.row(trackId);
+        if (row >= 0) {
+            result = m_trackColumns.value(row, column);
         }
     }
     return result;
@@ -479,72 +512,42 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         buildIndex();
     }
 
-    QStringList idStrings;
     // TODO(rryan) consider making this the data passed in and a separate
     // QVector for output
     QSet<TrackId> dirtyTracks;
     for (const auto& trackId: trackIds) {
-        idStrings << trackId.toString();
         if (m_dirtyTracks.contains(trackId)) {
             dirtyTracks.insert(trackId);
         }
     }
 
-    QStringList queryFragments;
-    if (!extraFilter.isNull() && extraFilter != "") {
-        queryFragments << QString("(%1)").arg(extraFilter);
-    }
-    if (idStrings.size() > 0) {
-        queryFragments << QString("%1 in (%2)")
-                .arg(m_idColumn, idStrings.join(","));
-    }
-
-    const std::unique_ptr<QueryNode> pQuery =
-            m_pQueryParser->parseQuery(
-                    searchQuery,
-                    m_searchColumns,
-                    queryFragments.join(" AND "));
-
-    QString filter = pQuery->toSql();
-    if (!filter.isEmpty()) {
-        filter.prepend("WHERE ");
-    }
-
-    QString queryString = QString("SELECT %1 FROM %2 %3 %4")
-            .arg(m_idColumn, m_tableName, filter, orderByClause);
-
-    if (sDebug) {
-        qDebug() << this << "select() executing:" << queryString;
-    }
-
-    QSqlQuery query(m_database);
-    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
-    // won't allocate a giant in-memory table that we won't use at all.
-    query.setForwardOnly(true);
-    query.prepare(queryString);
-
-    if (!query.exec()) {
-        LOG_FAILED_QUERY(query);
-    }
-
-    int idColumn = query.record().indexOf(m_idColumn);
-    int rows = query.size();
-
-    if (sDebug) {
-        qDebug() << "Rows returned:" << rows;
-    }
-
     m_trackOrder.resize(0); // keeps allocated memory
     trackToIndex->clear();
-    if (rows > 0) {
-        trackToIndex->reserve(rows);
-        m_trackOrder.reserve(rows);
-    }
 
-    while (query.next()) {
-        TrackId trackId(query.value(idColumn));
-        (*trackToIndex)[trackId] = m_trackOrder.size();
-        m_trackOrder.append(trackId);
+    std::unique_ptr<QueryNode> pQuery;
+    if (filterAndSortInMemory(trackIds,
+                searchQuery,
+                extraFilter,
+                orderByClause,
+                sortColumns,
+                columnOffset)) {
+        trackToIndex->reserve(m_trackOrder.size());
+        for (int i = 0; i < m_trackOrder.size(); ++i) {
+            (*trackToIndex)[m_trackOrder[i]] = i;
+        }
+        if (m_bIsCaching && !dirtyTracks.isEmpty()) {
+            // Only needed for matching dirty tracks
+            pQuery = m_pQueryParser->parseQuery(
+                    searchQuery,
+                    m_searchColumns,
+                    extraFilter);
+        }
+    } else {
+        pQuery = filterAndSortWithQuery(trackIds,
+                searchQuery,
+                extraFilter,
+                orderByClause,
+                trackToIndex);
     }
 
     // At this point, the original set of tracks have been divided into two
@@ -622,6 +625,389 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
     }
 }
 
+bool BaseTrackCache::filterAndSortInMemory(const QSet<TrackId>& trackIds,
+                                           const QString& searchQuery,
+                                           const QString& extraFilter,
+                                           const QString& orderByClause,
+                                           const QList<SortColumn>& sortColumns,
+                                           const int columnOffset) {
+    if (!extraFilter.isEmpty()) {
+        return false;
+    }
+    QStringList searchTerms;
+    if (!m_pQueryParser->parsePlainSearchTerms(searchQuery, &searchTerms)) {
+        return false;
+    }
+    bool searchCrates = false;
+    for (int i = 0; i < m_searchColumns.size(); ++i) {
+        if (m_searchColumns[i] == "crate") {
+            searchCrates = true;
+        } else if (m_searchColumnIndices[i] < 0) {
+            // Not available in memory
+            return false;
+        }
+    }
+
+    // The order is irrelevant without an ORDER BY clause, e.g. if the
+    // table model sorts the results by one of its own columns.
+    QVector<int> rankColumns;
+    QVector<Qt::SortOrder> rankOrders;
+    if (!orderByClause.isEmpty()) {
+        for (const auto& sc: sortColumns) {
+            const int column = sc.m_column - columnOffset;
+            // The 1st column contains the id and column values
+            // of the table model are not available
+            if (column <= 0 || column >= columnCount()) {
+                return false;
+            }
+            rankColumns.append(column);
+            rankOrders.append(sc.m_order);
+        }
+    }
+
+    PerformanceTimer timer;
+    timer.start();
+
+    // Unquoted terms also match the names of all crates that contain
+    // the track. Only the few crates are looked up in the database.
+    QVector<QVector<int>> crateRowsByTerm(searchTerms.size());
+    if (searchCrates) {
+        for (int i = 0; i < searchTerms.size(); ++i) {
+            CrateTrackSelectResult crateTracks(
+                    m_pCrateStorage->selectTracksSortedByCrateNameLike(
+                            searchTerms[i]));
+            QVector<int>& crateRows = crateRowsByTerm[i];
+            while (crateTracks.next()) {
+                const int row = m_trackColumns.row(crateTracks.trackId());
+                if (row >= 0) {
+                    crateRows.append(row);
+                }
+            }
+            std::sort(crateRows.begin(), crateRows.end());
+            crateRows.erase(std::unique(crateRows.begin(), crateRows.end()), crateRows.end());
+        }
+    }
+
+    // The trigram index reduces the number of rows that need to be
+    // searched to those that contain all trigrams of each term, unless
+    // all terms are too short.
+    bool useCandidateRows = false;
+    QVector<int> candidateRows;
+    QVector<int> termRows;
+    QVector<int> mergedRows;
+    for (int i = 0; i < searchTerms.size(); ++i) {
+        if (!m_trackColumns.searchIndex().findCandidates(searchTerms[i], &termRows)) {
+            continue;
+        }
+        if (!crateRowsByTerm[i].isEmpty()) {
+            mergedRows.clear();
+            std::set_union(termRows.constBegin(),
+                    termRows.constEnd(),
+                    crateRowsByTerm[i].constBegin(),
+                    crateRowsByTerm[i].constEnd(),
+                    std::back_inserter(mergedRows));
+            termRows.swap(mergedRows);
+        }
+        if (useCandidateRows) {
+            mergedRows.clear();
+            std::set_intersection(candidateRows.constBegin(),
+                    candidateRows.constEnd(),
+                    termRows.constBegin(),
+                    termRows.constEnd(),
+                    std::back_inserter(mergedRows));
+            candidateRows.swap(mergedRows);
+        } else {
+            candidateRows.swap(termRows);
+            useCandidateRows = true;
+        }
+    }
+    QVector<bool> isCandidateRow;
+    if (useCandidateRows) {
+        isCandidateRow.resize(m_trackColumns.rowCount());
+        for (int row: qAsConst(candidateRows)) {
+            isCandidateRow[row] = true;
+        }
+    }
+
+    QVector<int> rows;
+    rows.reserve(useCandidateRows ? candidateRows.size() : trackIds.size());
+    for (const auto& trackId: trackIds) {
+        const int row = m_trackColumns.row(trackId);
+        if (row < 0) {
+            // Let the database decide if the track exists at all
+            return false;
+        }
+        if (!useCandidateRows || isCandidateRow.at(row)) {
+            rows.append(row);
+        }
+    }
+
+    if (!searchTerms.isEmpty()) {
+        const auto matchesAllTerms = [&](int row) {
+            const QString& searchText = m_trackColumns.searchText(row);
+            for (int i = 0; i < searchTerms.size(); ++i) {
+                if (!searchText.contains(searchTerms.at(i))) {
+                    const QVector<int>& crateRows = crateRowsByTerm.at(i);
+                    if (!std::binary_search(crateRows.constBegin(), crateRows.constEnd(), row)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+
+        // Each chunk is filtered in place and only reads from the
+        // column store that is not modified concurrently.
+        const int chunkCount = math_clamp(
+                rows.size() / kMinSearchChunkSize,
+                1,
+                math_max(1, QThread::idealThreadCount()));
+        const int chunkSize = (rows.size() + chunkCount - 1) / chunkCount;
+        QVector<int> matchingRowCounts(chunkCount);
+        // Detach before accessing the data from multiple threads
+        int* const pRows = rows.data();
+        int* const pMatchingRowCounts = matchingRowCounts.data();
+        const int rowCount = rows.size();
+        const auto filterChunk = [&](int chunk) {
+            int* const pBegin = pRows + math_min(rowCount, chunk * chunkSize);
+            int* const pEnd = pRows + math_min(rowCount, (chunk + 1) * chunkSize);
+            pMatchingRowCounts[chunk] = static_cast<int>(
+                    std::stable_partition(pBegin, pEnd, matchesAllTerms) - pBegin);
+        };
+        QVector<QFuture<void>> futures;
+        for (int chunk = 1; chunk < chunkCount; ++chunk) {
+            futures.append(QtConcurrent::run([&filterChunk, chunk] {
+                filterChunk(chunk);
+            }));
+        }
+        filterChunk(0);
+        for (auto& future: futures) {
+            future.waitForFinished();
+        }
+
+        // Compact the matching rows of all chunks
+        int matchingRowCount = matchingRowCounts[0];
+        for (int chunk = 1; chunk < chunkCount; ++chunk) {
+            const int* const pBegin = pRows + math_min(rowCount, chunk * chunkSize);
+            std::copy(pBegin,
+                    pBegin + matchingRowCounts[chunk],
+                    pRows + matchingRowCount);
+            matchingRowCount += matchingRowCounts[chunk];
+        }
+        rows.resize(matchingRowCount);
+    }
+
+    if (!rankColumns.isEmpty()) {
+        QVector<const QVector<int>*> ranks;
+        for (int column: qAsConst(rankColumns)) {
+            sortRanks(column);
+        }
+        // Collect the pointers after all ranks have been computed
+        for (int column: qAsConst(rankColumns)) {
+            ranks.append(m_trackColumns.sortRanks(column));
+        }
+        std::sort(rows.begin(), rows.end(), [&](int lhs, int rhs) {
+            for (int i = 0; i < ranks.size(); ++i) {
+                const int lhsRank = ranks[i]->at(lhs);
+                const int rhsRank = ranks[i]->at(rhs);
+                if (lhsRank != rhsRank) {
+                    return (rankOrders[i] == Qt::AscendingOrder) ==
+                            (lhsRank < rhsRank);
+                }
+            }
+            // Stable order of equal tracks
+            return lhs < rhs;
+        });
+    }
+
+    m_trackOrder.reserve(rows.size());
+    for (int row: qAsConst(rows)) {
+        m_trackOrder.append(m_trackColumns.trackId(row));
+    }
+
+    if (sDebug) {
+        qDebug() << this
+                 << "filterAndSortInMemory found"
+                 << m_trackOrder.size()
+                 << "of"
+                 << trackIds.size()
+                 << "tracks in"
+                 << timer.elapsed().debugMillisWithUnit();
+    }
+    return true;
+}
+
+std::unique_ptr<QueryNode> BaseTrackCache::filterAndSortWithQuery(
+        const QSet<TrackId>& trackIds,
+        const QString& searchQuery,
+        const QString& extraFilter,
+        const QString& orderByClause,
+        QHash<TrackId, int>* trackToIndex) {
+    QStringList idStrings;
+    for (const auto& trackId: trackIds) {
+        idStrings << trackId.toString();
+    }
+
+    QStringList queryFragments;
+    if (!extraFilter.isNull() && extraFilter != "") {
+        queryFragments << QString("(%1)").arg(extraFilter);
+    }
+    if (idStrings.size() > 0) {
+        queryFragments << QString("%1 in (%2)")
+                .arg(m_idColumn, idStrings.join(","));
+    }
+
+    std::unique_ptr<QueryNode> pQuery =
+            m_pQueryParser->parseQuery(
+                    searchQuery,
+                    m_searchColumns,
+                    queryFragments.join(" AND "));
+
+    QString filter = pQuery->toSql();
+    if (!filter.isEmpty()) {
+        filter.prepend("WHERE ");
+    }
+
+    QString queryString = QString("SELECT %1 FROM %2 %3 %4")
+            .arg(m_idColumn, m_tableName, filter, orderByClause);
+
+    if (sDebug) {
+        qDebug() << this << "select() executing:" << queryString;
+    }
+
+    QSqlQuery query(m_database);
+    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
+    // won't allocate a giant in-memory table that we won't use at all.
+    query.setForwardOnly(true);
+    query.prepare(queryString);
+
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+    }
+
+    int idColumn = query.record().indexOf(m_idColumn);
+    int rows = query.size();
+
+    if (sDebug) {
+        qDebug() << "Rows returned:" << rows;
+    }
+
+    if (rows > 0) {
+        trackToIndex->reserve(rows);
+        m_trackOrder.reserve(rows);
+    }
+
+    while (query.next()) {
+        TrackId trackId(query.value(idColumn));
+        (*trackToIndex)[trackId] = m_trackOrder.size();
+        m_trackOrder.append(trackId);
+    }
+    return pQuery;
+}
+
+const QVector<int>& BaseTrackCache::sortRanks(int column) {
+    const bool isKeyColumn =
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_KEY);
+    const KeyUtils::KeyNotation keyNotation = m_columnCache.keyNotation();
+    const QVector<int>* pRanks = m_trackColumns.sortRanks(column);
+    if (pRanks && !(isKeyColumn && keyNotation != m_keySortRanksNotation)) {
+        return *pRanks;
+    }
+
+    PerformanceTimer timer;
+    timer.start();
+
+    const int rowCount = m_trackColumns.rowCount();
+    QVector<int> sortedRows;
+    sortedRows.reserve(rowCount);
+    for (int row = 0; row < rowCount; ++row) {
+        if (m_trackColumns.trackId(row).isValid()) {
+            sortedRows.append(row);
+        }
+    }
+
+    // Ranks are assigned in ascending order. Rows that compare equal
+    // receive the same rank.
+    QVector<int> ranks(rowCount, -1);
+    const auto assignRanks = [&](const auto& equal) {
+        int rank = 0;
+        for (int i = 0; i < sortedRows.size(); ++i) {
+            if (i > 0 && !equal(sortedRows[i - 1], sortedRows[i])) {
+                ++rank;
+            }
+            ranks[sortedRows[i]] = rank;
+        }
+    };
+
+    if (isNumericSortColumn(column) || isKeyColumn) {
+        QVector<double> values(rowCount);
+        QHash<QString, int> keyOrders;
+        for (int row: qAsConst(sortedRows)) {
+            const QVariant& value = m_trackColumns.value(row, column);
+            if (isKeyColumn) {
+                // Keys are compared by their position in the circle of fifths
+                const QString keyText = value.toString();
+                auto i = keyOrders.constFind(keyText);
+                if (i == keyOrders.constEnd()) {
+                    i = keyOrders.insert(keyText,
+                            KeyUtils::keyToCircleOfFifthsOrder(
+                                    KeyUtils::guessKeyFromText(keyText),
+                                    keyNotation));
+                }
+                values[row] = i.value();
+            } else {
+                values[row] = numericSortValue(column, value);
+            }
+        }
+        std::stable_sort(sortedRows.begin(), sortedRows.end(), [&](int lhs, int rhs) {
+            return values[lhs] < values[rhs];
+        });
+        assignRanks([&](int lhs, int rhs) {
+            // Same tolerance as in compareColumnValues()
+            return fabs(values[lhs] - values[rhs]) < .00001;
+        });
+        if (isKeyColumn) {
+            m_keySortRanksNotation = keyNotation;
+        }
+    } else {
+        // Interned strings are only compared once by their collation keys
+        QStringList distinctStrings;
+        QHash<QString, int> stringIndices;
+        QVector<int> stringIndexByRow(rowCount, -1);
+        for (int row: qAsConst(sortedRows)) {
+            const QString str = m_trackColumns.value(row, column).toString();
+            auto i = stringIndices.constFind(str);
+            if (i == stringIndices.constEnd()) {
+                i = stringIndices.insert(str, distinctStrings.size());
+                distinctStrings.append(str);
+            }
+            stringIndexByRow[row] = i.value();
+        }
+        std::vector<QCollatorSortKey> sortKeys;
+        sortKeys.reserve(distinctStrings.size());
+        for (const auto& str: qAsConst(distinctStrings)) {
+            sortKeys.push_back(m_collator.sortKey(str));
+        }
+        std::stable_sort(sortedRows.begin(), sortedRows.end(), [&](int lhs, int rhs) {
+            return sortKeys[stringIndexByRow[lhs]].compare(
+                           sortKeys[stringIndexByRow[rhs]]) < 0;
+        });
+        assignRanks([&](int lhs, int rhs) {
+            return sortKeys[stringIndexByRow[lhs]].compare(
+                           sortKeys[stringIndexByRow[rhs]]) == 0;
+        });
+    }
+
+    if (sDebug) {
+        qDebug() << this
+                 << "ranking" << sortedRows.size()
+                 << "tracks by column" << column
+                 << "took" << timer.elapsed().debugMillisWithUnit();
+    }
+    m_trackColumns.setSortRanks(column, std::move(ranks));
+    return *m_trackColumns.sortRanks(column);
+}
+
 int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
         const QList<SortColumn>& sortColumns,
         const int columnOffset,
@@ -652,7 +1038,7 @@ int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
 
         // This should not happen, but it's a recoverable error so we should
         // only log it.
-        if (!m_trackInfo.contains(otherTrackId)) {
+        if (!m_trackColumns.contains(otherTrackId)) {
             qDebug() << "WARNING: track" << otherTrackId << "was not in index";
             //updateTrackInIndex(otherTrackId);
         }
@@ -691,20 +1077,10 @@ int BaseTrackCache::compareColumnValues(int sortColumn, Qt::SortOrder sortOrder,
                                         QVariant val1, QVariant val2) const {
     int result = 0;
 
-    if (sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_YEAR) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_DURATION) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BITRATE) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BPM) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_REPLAYGAIN) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_SAMPLERATE) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_CHANNELS) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TIMESPLAYED) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_RATING) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_PLAYLISTTRACKSTABLE_POSITION)
-    ) {
+    if (isNumericSortColumn(sortColumn)) {
         // Sort as floats.
-        double delta = val1.toDouble() - val2.toDouble();
+        double delta = numericSortValue(sortColumn, val1) -
+                numericSortValue(sortColumn, val2);
 
         if (fabs(delta) < .00001)
             result = 0;
@@ -737,3 +1113,25 @@ int BaseTrackCache::compareColumnValues(int sortColumn, Qt::SortOrder sortOrder,
 
     return result;
 }
+
+bool BaseTrackCache::isNumericSortColumn(int column) const {
+    // The year is sorted as text like in the database (see ColumnCache),
+    // because it may contain a full date.
+    return column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_DURATION) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BITRATE) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BPM) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_REPLAYGAIN) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_SAMPLERATE) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_CHANNELS) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TIMESPLAYED) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_RATING) ||
+            column == fieldIndex(ColumnCache::COLUMN_PLAYLISTTRACKSTABLE_POSITION);
+}
+
+double BaseTrackCache::numericSortValue(int column, const QVariant& value) const {
+    if (column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER)) {
+        return leadingInteger(value.toString());
+    }
+    return value.toDouble();
+}
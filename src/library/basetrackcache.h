@@ -12,10 +12,13 @@
 #include <memory>
 
 #include "library/columncache.h"
+#include "library/trackcolumnstore.h"
 #include "track/track.h"
 #include "util/class.h"
 #include "util/string.h"
 
+class CrateStorage;
+class QueryNode;
 class SearchQueryParser;
 class TrackCollection;
 
@@ -35,6 +38,11 @@ class SortColumn {
 // waste of memory because all the table-models were caching the same data
 // (track properties). Furthermore, the base SQL tables of these table-models
 // involve complicated joins, which are very slow.
+//
+// The values are stored column-wise in a TrackColumnStore. Plain search
+// queries without any filters are evaluated in memory with the help of a
+// trigram index on multiple threads, and the results are sorted by
+// precomputed ranks. All other queries are still delegated to the database.
 class BaseTrackCache : public QObject {
     Q_OBJECT
   public:
@@ -83,11 +91,31 @@ class BaseTrackCache : public QObject {
     void slotDbTrackAdded(TrackPointer pTrack);
 
   private:
+    friend class BaseTrackCacheTest;
+
     const TrackPointer& getRecentTrack(TrackId trackId) const;
     void replaceRecentTrack(TrackPointer pTrack) const;
     void replaceRecentTrack(TrackId trackId, TrackPointer pTrack) const;
     void resetRecentTrack() const;
 
+    void updateSearchColumnIndices();
+
+    // Returns false if the query could not be evaluated in memory
+    bool filterAndSortInMemory(const QSet<TrackId>& trackIds,
+                               const QString& searchQuery,
+                               const QString& extraFilter,
+                               const QString& orderByClause,
+                               const QList<SortColumn>& sortColumns,
+                               const int columnOffset);
+    std::unique_ptr<QueryNode> filterAndSortWithQuery(const QSet<TrackId>& trackIds,
+                                                      const QString& searchQuery,
+                                                      const QString& extraFilter,
+                                                      const QString& orderByClause,
+                                                      QHash<TrackId, int>* trackToIndex);
+    const QVector<int>& sortRanks(int column);
+    bool isNumericSortColumn(int column) const;
+    double numericSortValue(int column, const QVariant& value) const;
+
     bool updateIndexWithQuery(const QString& query);
     bool updateIndexWithTrackpointer(TrackPointer pTrack);
     void updateTrackInIndex(TrackId trackId);
@@ -118,6 +146,8 @@ class BaseTrackCache : public QObject {
 
     const std::unique_ptr<SearchQueryParser> m_pQueryParser;
 
+    const CrateStorage* const m_pCrateStorage;
+
     const StringCollator m_collator;
 
     QStringList m_searchColumns;
@@ -141,7 +171,9 @@ class BaseTrackCache : public QObject {
 
     bool m_bIndexBuilt;
     bool m_bIsCaching;
-    QHash<TrackId, QVector<QVariant> > m_trackInfo;
+    TrackColumnStore m_trackColumns;
+    // The key notation that has been used for ranking the key column
+    KeyUtils::KeyNotation m_keySortRanksNotation;
     QSqlDatabase m_database;
     ControlProxy* m_pKeyNotationCP;
 
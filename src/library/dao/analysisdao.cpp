@@ -92,7 +92,12 @@ QList<AnalysisDao::AnalysisInfo> AnalysisDao::loadAnalysesFromQuery(TrackId trac
                      << "length" << compressedData.length();
             continue;
         }
-        info.data = qUncompress(compressedData);
+        if (Waveform::isFlatByteArray(compressedData)) {
+            // Already compressed region by region
+            info.data = compressedData;
+        } else {
+            info.data = qUncompress(compressedData);
+        }
         bytes += info.data.length();
         analyses.append(info);
     }
@@ -114,7 +119,10 @@ bool AnalysisDao::saveAnalysis(AnalysisDao::AnalysisInfo* info) {
     PerformanceTimer time;
     time.start();
 
-    QByteArray compressedData = qCompress(info->data, kCompressionLevel);
+    // Waveforms in the flat format are compressed region by region and
+    // can be loaded without inflating the whole file first
+    QByteArray compressedData = Waveform::isFlatByteArray(info->data) ?
+            info->data : qCompress(info->data, kCompressionLevel);
     int checksum = qChecksum(compressedData.constData(),
                              compressedData.length());
 
@@ -9,6 +9,7 @@
 #include "util/logger.h"
 #include "util/trace.h"
 #include "util/file.h"
+#include "util/math.h"
 #include "util/timer.h"
 #include "util/performancetimer.h"
 #include "library/scanner/scannerutil.h"
@@ -18,8 +19,17 @@
 
 namespace {
 
+// Directories are scanned in parallel, most of the time is spent
+// waiting for the file system.
 // TODO(rryan) make configurable
-const int kScannerThreadPoolSize = 1;
+const int kScannerThreadPoolSize = math_max(1, QThread::idealThreadCount());
+
+// Changes are collected for a while before rescanning in watch mode
+constexpr int kRescanDelayMillis = 5000;
+
+const ConfigKey kConfigKeyWatchDirectories("[Library]", "WatchDirectories");
+
+const QString kJournalFileName = QStringLiteral("libraryscanner.journal");
 
 mixxx::Logger kLogger("LibraryScanner");
 
@@ -47,7 +57,9 @@ LibraryScanner::LibraryScanner(
                   m_analysisDao, m_libraryHashDao,
                   pConfig),
           m_stateSema(1), // only one transaction is possible at a time
-          m_state(IDLE) {
+          m_state(IDLE),
+          m_journal(QDir(pConfig->getSettingsPath()).filePath(kJournalFileName)),
+          m_watchDirectories(pConfig->getValue(kConfigKeyWatchDirectories, false)) {
     // Move LibraryScanner to its own thread so that our signals/slots will
     // queue to our event loop.
     moveToThread(this);
@@ -146,10 +158,32 @@ void LibraryScanner::run() {
         m_analysisDao.initialize(dbConnection);
         m_directoryDao.initialize(dbConnection);
 
+        m_journal.load();
+        if (m_watchDirectories) {
+            m_pDirectoryWatcher = std::make_unique<QFileSystemWatcher>();
+            connect(m_pDirectoryWatcher.get(),
+                    &QFileSystemWatcher::directoryChanged,
+                    this,
+                    &LibraryScanner::slotDirectoryChanged);
+            m_pRescanTimer = std::make_unique<QTimer>();
+            m_pRescanTimer->setSingleShot(true);
+            m_pRescanTimer->setInterval(kRescanDelayMillis);
+            connect(m_pRescanTimer.get(),
+                    &QTimer::timeout,
+                    this,
+                    &LibraryScanner::slotRescanChangedDirectories);
+            // Changes that happened while not running are detected by
+            // comparing the modification times during the next scan.
+            updateWatchedDirectories();
+        }
+
         // Start the event loop.
         kLogger.debug() << "Event loop starting";
         exec();
         kLogger.debug() << "Event loop stopped";
+
+        m_pRescanTimer.reset();
+        m_pDirectoryWatcher.reset();
     }
     kLogger.debug() << "Exiting thread";
 }
@@ -176,9 +210,11 @@ void LibraryScanner::slotStartScan() {
                     Qt::CaseInsensitive);
     QStringList directoryBlacklist = ScannerUtil::getDirectoryBlacklist();
 
+    m_journal.beginScan();
     m_scannerGlobal = ScannerGlobalPointer(
             new ScannerGlobal(trackLocations, directoryHashes, extensionFilter,
-                              coverExtensionFilter, directoryBlacklist));
+                              coverExtensionFilter, directoryBlacklist,
+                              &m_journal));
 
     m_scannerGlobal->startTimer();
 
@@ -383,8 +419,12 @@ void LibraryScanner::slotFinishUnhashedScan() {
 
     if (!m_scannerGlobal->shouldCancel() && bScanFinishedCleanly) {
         kLogger.debug() << "Scan finished cleanly";
+        m_journal.finishScan(true);
+        m_journal.save();
+        updateWatchedDirectories();
     } else {
         kLogger.debug() << "Scan cancelled";
+        m_journal.finishScan(false);
     }
 
     // TODO(XXX) doesn't take into account verifyRemainingTracks.
@@ -406,6 +446,61 @@ void LibraryScanner::slotFinishUnhashedScan() {
     emit scanFinished();
 }
 
+void LibraryScanner::updateWatchedDirectories() {
+    if (!m_pDirectoryWatcher) {
+        return;
+    }
+    const QStringList directories = m_journal.directories();
+    QSet<QString> obsoleteDirectories;
+    for (const auto& directory : m_pDirectoryWatcher->directories()) {
+        obsoleteDirectories.insert(directory);
+    }
+    QStringList newDirectories;
+    for (const auto& directory : directories) {
+        if (!obsoleteDirectories.remove(directory)) {
+            newDirectories.append(directory);
+        }
+    }
+    if (!obsoleteDirectories.isEmpty()) {
+        QStringList removedDirectories;
+        for (const auto& directory : obsoleteDirectories) {
+            removedDirectories.append(directory);
+        }
+        m_pDirectoryWatcher->removePaths(removedDirectories);
+    }
+    if (!newDirectories.isEmpty()) {
+        // Fails for some directories if the number of watches is limited,
+        // e.g. by /proc/sys/fs/inotify/max_user_watches on Linux
+        const QStringList failedDirectories =
+                m_pDirectoryWatcher->addPaths(newDirectories);
+        if (!failedDirectories.isEmpty()) {
+            kLogger.warning()
+                    << "Failed to watch"
+                    << failedDirectories.size()
+                    << "of"
+                    << directories.size()
+                    << "directories";
+        }
+    }
+}
+
+void LibraryScanner::slotDirectoryChanged(const QString& directoryPath) {
+    kLogger.debug() << "slotDirectoryChanged" << directoryPath;
+    m_journal.invalidateDirectory(directoryPath);
+    DEBUG_ASSERT(m_pRescanTimer);
+    m_pRescanTimer->start();
+}
+
+void LibraryScanner::slotRescanChangedDirectories() {
+    if (m_state != IDLE) {
+        // Try again after the current scan has finished
+        m_pRescanTimer->start();
+        return;
+    }
+    kLogger.info() << "Rescanning changed directories";
+    scan();
+}
+
 void LibraryScanner::scan() {
     if (changeScannerState(STARTING)) {
         emit startScan();
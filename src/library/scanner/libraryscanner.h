@@ -7,6 +7,8 @@
 #include <QStringList>
 #include <QSemaphore>
 #include <QScopedPointer>
+#include <QFileSystemWatcher>
+#include <QTimer>
 
 #include "library/dao/cuedao.h"
 #include "library/dao/libraryhashdao.h"
@@ -15,8 +17,10 @@
 #include "library/dao/trackdao.h"
 #include "library/dao/analysisdao.h"
 #include "library/scanner/scannerglobal.h"
+#include "library/scanner/scannerjournal.h"
 #include "track/track.h"
 #include "util/db/dbconnectionpool.h"
+#include "util/memory.h"
 
 #include <gtest/gtest.h>
 
@@ -65,6 +69,10 @@ class LibraryScanner : public QThread {
     void slotFinishHashedScan();
     void slotFinishUnhashedScan();
 
+    // Invoked by the file system watcher in watch mode
+    void slotDirectoryChanged(const QString& directoryPath);
+    void slotRescanChangedDirectories();
+
     // ScannerTask signal handlers.
     void slotDirectoryHashedAndScanned(const QString& directoryPath,
                                    bool newDirectory, mixxx::cache_key_t hash);
@@ -96,6 +104,8 @@ class LibraryScanner : public QThread {
 
     void cleanUpScan();
 
+    void updateWatchedDirectories();
+
     mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
 
     // The pool of threads used for worker tasks.
@@ -121,6 +131,15 @@ class LibraryScanner : public QThread {
 
     QStringList m_libraryRootDirs;
     QScopedPointer<LibraryScannerDlg> m_pProgressDlg;
+
+    // Modification times of all directories from the last scan
+    ScannerJournal m_journal;
+
+    // Only created in watch mode. Both objects live in the scanner
+    // thread and are created and destroyed in run().
+    const bool m_watchDirectories;
+    std::unique_ptr<QFileSystemWatcher> m_pDirectoryWatcher;
+    std::unique_ptr<QTimer> m_pRescanTimer;
 };
 
 #endif // MIXXX_LIBRARYSCANNER_H
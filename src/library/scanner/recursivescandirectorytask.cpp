@@ -27,6 +27,33 @@ void RecursiveScanDirectoryTask::run() {
     //qDebug() << "Burn CPU";
     //for (int i = 0;i < 1000000000; i++) asm("nop");
 
+    const QString dirPath = m_dir.path();
+
+    // Try to retrieve a hash from the last time that directory was scanned.
+    const mixxx::cache_key_t prevHash = m_scannerGlobal->directoryHashInDatabase(dirPath);
+    const bool prevHashExists = mixxx::isValidCacheKey(prevHash);
+
+    // Only a single stat() is needed for directories that have not been
+    // modified since the last scan. Their sub-directories are already
+    // known and still need to be visited.
+    ScannerJournal* const pJournal = m_scannerGlobal->journal();
+    const QFileInfo dirInfo(dirPath);
+    if (!dirInfo.exists()) {
+        // Sub-directories from the journal might have been deleted
+        setSuccess(true);
+        return;
+    }
+    const QDateTime lastModified = dirInfo.lastModified();
+    if (prevHashExists && pJournal &&
+            pJournal->keepUnchangedDirectory(dirPath, lastModified)) {
+        emit directoryUnchanged(dirPath);
+        for (const QString& subdirPath : pJournal->previousSubdirectories(dirPath)) {
+            scanSubdirectory(QDir(subdirPath));
+        }
+        setSuccess(true);
+        return;
+    }
+
     // Note, we save on filesystem operations (and random work) by initializing
     // a QDirIterator with a QDir instead of a QString -- but it inherits its
     // Filter from the QDir so we have to set it first. If the QDir has not done
@@ -77,13 +104,10 @@ void RecursiveScanDirectoryTask::run() {
     // Calculate a hash of the directory's file list.
     const mixxx::cache_key_t newHash = mixxx::cacheKeyFromMessageDigest(hasher.result());
 
-    QString dirPath = m_dir.path();
-
-    // Try to retrieve a hash from the last time that directory was scanned.
-    const mixxx::cache_key_t prevHash = m_scannerGlobal->directoryHashInDatabase(dirPath);
-    const bool prevHashExists = mixxx::isValidCacheKey(prevHash);
-
     if (prevHashExists || m_scanUnhashed) {
+        if (pJournal) {
+            pJournal->updateDirectory(dirPath, lastModified);
+        }
         // Compare the hashes, and if they don't match, rescan the files in that
         // directory!
         if (prevHash != newHash) {
@@ -106,14 +130,18 @@ void RecursiveScanDirectoryTask::run() {
 
     // Process all of the sub-directories.
     foreach (const QDir& nextDir, dirsToScan) {
-        // Atomically test and mark the directory as scanned to avoid
-        // that the same directory is scanned multiple times by different
-        // tasks.
-        if (!m_scannerGlobal->testAndMarkDirectoryScanned(nextDir)) {
-            m_pScanner->queueTask(
-                    new RecursiveScanDirectoryTask(m_pScanner, m_scannerGlobal,
-                                                   nextDir, m_pToken, m_scanUnhashed));
-        }
+        scanSubdirectory(nextDir);
     }
     setSuccess(true);
 }
+
+void RecursiveScanDirectoryTask::scanSubdirectory(const QDir& dir) {
+    // Atomically test and mark the directory as scanned to avoid
+    // that the same directory is scanned multiple times by different
+    // tasks.
+    if (!m_scannerGlobal->testAndMarkDirectoryScanned(dir)) {
+        m_pScanner->queueTask(
+                new RecursiveScanDirectoryTask(m_pScanner, m_scannerGlobal,
+                                               dir, m_pToken, m_scanUnhashed));
+    }
+}
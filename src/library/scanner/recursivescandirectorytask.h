@@ -9,8 +9,10 @@
 // Recursively scan a music library. Doesn't import tracks for any directories
 // that have already been scanned and have not changed. Changes are tracked by
 // performing a hash of the directory's file list, and those hashes are stored
-// in the database. Successful if the scan completed without being
-// cancelled. False if the scan was cancelled part-way through.
+// in the database. The file list of directories that have not been modified
+// according to the ScannerJournal is not read at all. Successful if the scan
+// completed without being cancelled. False if the scan was cancelled
+// part-way through.
 class RecursiveScanDirectoryTask : public ScannerTask {
     Q_OBJECT
   public:
@@ -25,6 +27,8 @@ class RecursiveScanDirectoryTask : public ScannerTask {
     virtual void run();
 
   private:
+    void scanSubdirectory(const QDir& dir);
+
     QDir m_dir;
     SecurityTokenPointer m_pToken;
     bool m_scanUnhashed;
@@ -9,6 +9,7 @@
 #include <QMutexLocker>
 #include <QSharedPointer>
 
+#include "library/scanner/scannerjournal.h"
 #include "util/cache.h"
 #include "util/task.h"
 #include "util/performancetimer.h"
@@ -41,8 +42,10 @@ class ScannerGlobal {
                   const QHash<QString, mixxx::cache_key_t>& directoryHashes,
                   const QRegExp& supportedExtensionsMatcher,
                   const QRegExp& supportedCoverExtensionsMatcher,
-                  const QStringList& directoriesBlacklist)
-            : m_trackLocations(trackLocations),
+                  const QStringList& directoriesBlacklist,
+                  ScannerJournal* pJournal)
+            : m_pJournal(pJournal),
+              m_trackLocations(trackLocations),
               m_directoryHashes(directoryHashes),
               m_supportedExtensionsMatcher(supportedExtensionsMatcher),
               m_supportedCoverExtensionsMatcher(supportedCoverExtensionsMatcher),
@@ -57,6 +60,11 @@ class ScannerGlobal {
         return m_watcher;
     }
 
+    // Thread-safe
+    ScannerJournal* journal() const {
+        return m_pJournal;
+    }
+
     // Returns whether the track already exists in the database.
     inline bool trackExistsInDatabase(const QString& trackLocation) const {
         return m_trackLocations.contains(trackLocation);
@@ -177,6 +185,8 @@ class ScannerGlobal {
   private:
     TaskWatcher m_watcher;
 
+    ScannerJournal* const m_pJournal;
+
     QSet<QString> m_trackLocations;
     QHash<QString, mixxx::cache_key_t> m_directoryHashes;
 
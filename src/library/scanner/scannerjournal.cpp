@@ -0,0 +1,175 @@
+#include "library/scanner/scannerjournal.h"
+
+#include <limits>
+
+#include <QFile>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QTextStream>
+
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("ScannerJournal");
+
+const QString kHeader = QStringLiteral("#MixxxScannerJournal 1");
+
+const QChar kSeparator = QLatin1Char('\t');
+
+// Invalidated directories are kept to find their sub-directories
+constexpr qint64 kInvalidatedLastModified = std::numeric_limits<qint64>::min();
+
+QString parentPath(const QString& dirPath) {
+    // The paths of sub-directories are constructed by the scanner from
+    // the path of the parent directory, i.e. they are not normalized
+    const int index = dirPath.lastIndexOf(QLatin1Char('/'));
+    if (index <= 0) {
+        return QString();
+    }
+    return dirPath.left(index);
+}
+
+} // anonymous namespace
+
+ScannerJournal::ScannerJournal(const QString& filePath)
+        : m_filePath(filePath) {
+}
+
+bool ScannerJournal::load() {
+    QFile file(m_filePath);
+    if (!file.exists()) {
+        return true;
+    }
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        kLogger.warning()
+                << "Failed to open"
+                << m_filePath
+                << file.errorString();
+        return false;
+    }
+    QTextStream in(&file);
+    in.setCodec("UTF-8");
+    if (in.readLine() != kHeader) {
+        kLogger.warning()
+                << "Ignoring journal with unknown format"
+                << m_filePath;
+        return false;
+    }
+    Entries entries;
+    while (!in.atEnd()) {
+        const QString line = in.readLine();
+        const int separatorIndex = line.indexOf(kSeparator);
+        bool ok = false;
+        const qint64 lastModified = line.left(separatorIndex).toLongLong(&ok);
+        if (separatorIndex <= 0 || !ok) {
+            kLogger.warning()
+                    << "Ignoring invalid entry"
+                    << line;
+            continue;
+        }
+        entries.insert(line.mid(separatorIndex + 1), lastModified);
+    }
+    QMutexLocker locked(&m_mutex);
+    m_previousEntries = std::move(entries);
+    kLogger.debug()
+            << "Loaded"
+            << m_previousEntries.size()
+            << "directories from"
+            << m_filePath;
+    return true;
+}
+
+bool ScannerJournal::save() const {
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        kLogger.warning()
+                << "Failed to create"
+                << m_filePath
+                << file.errorString();
+        return false;
+    }
+    {
+        QTextStream out(&file);
+        out.setCodec("UTF-8");
+        out << kHeader << '\n';
+        QMutexLocker locked(&m_mutex);
+        for (auto i = m_previousEntries.constBegin();
+                i != m_previousEntries.constEnd();
+                ++i) {
+            out << i.value() << kSeparator << i.key() << '\n';
+        }
+    }
+    return file.commit();
+}
+
+void ScannerJournal::beginScan() {
+    QMutexLocker locked(&m_mutex);
+    m_currentEntries.clear();
+    m_previousSubdirectories.clear();
+    for (auto i = m_previousEntries.constBegin();
+            i != m_previousEntries.constEnd();
+            ++i) {
+        const QString parent = parentPath(i.key());
+        if (!parent.isEmpty()) {
+            m_previousSubdirectories[parent].append(i.key());
+        }
+    }
+}
+
+void ScannerJournal::finishScan(bool completed) {
+    QMutexLocker locked(&m_mutex);
+    if (completed) {
+        m_previousEntries = std::move(m_currentEntries);
+    }
+    m_currentEntries.clear();
+    m_previousSubdirectories.clear();
+}
+
+bool ScannerJournal::keepUnchangedDirectory(
+        const QString& dirPath,
+        const QDateTime& lastModified) {
+    if (!lastModified.isValid()) {
+        return false;
+    }
+    const qint64 lastModifiedMillis = lastModified.toMSecsSinceEpoch();
+    QMutexLocker locked(&m_mutex);
+    const auto i = m_previousEntries.constFind(dirPath);
+    if (i == m_previousEntries.constEnd() || i.value() != lastModifiedMillis) {
+        return false;
+    }
+    m_currentEntries.insert(dirPath, lastModifiedMillis);
+    return true;
+}
+
+void ScannerJournal::updateDirectory(
+        const QString& dirPath,
+        const QDateTime& lastModified) {
+    if (!lastModified.isValid()) {
+        return;
+    }
+    QMutexLocker locked(&m_mutex);
+    m_currentEntries.insert(dirPath, lastModified.toMSecsSinceEpoch());
+}
+
+void ScannerJournal::invalidateDirectory(const QString& dirPath) {
+    QMutexLocker locked(&m_mutex);
+    const auto i = m_previousEntries.find(dirPath);
+    if (i != m_previousEntries.end()) {
+        i.value() = kInvalidatedLastModified;
+    }
+    const auto j = m_currentEntries.find(dirPath);
+    if (j != m_currentEntries.end()) {
+        j.value() = kInvalidatedLastModified;
+    }
+}
+
+QStringList ScannerJournal::previousSubdirectories(const QString& dirPath) const {
+    QMutexLocker locked(&m_mutex);
+    return m_previousSubdirectories.value(dirPath);
+}
+
+QStringList ScannerJournal::directories() const {
+    QMutexLocker locked(&m_mutex);
+    return m_previousEntries.keys();
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+
+// Remembers the modification time of every directory that has been scanned
+// and persists it in a file between sessions. Adding, removing or renaming
+// a file changes the modification time of the containing directory, so if
+// it did not change since the last scan the scanner can skip reading the
+// list of entries and only needs to stat() the directory itself. This
+// reduces a rescan of an unchanged library to one stat() per directory
+// which makes a big difference on network shares.
+//
+// Modifying the contents of existing files doesn't affect the modification
+// time of directories. This is consistent with the hash of the file names
+// that is used for detecting changed directories.
+//
+// Directories can be invalidated explicitly, e.g. after receiving a change
+// notification from the file system. Invalidated directories are always
+// scanned again.
+//
+// All functions are thread-safe.
+class ScannerJournal {
+  public:
+    explicit ScannerJournal(const QString& filePath);
+
+    bool load();
+    bool save() const;
+
+    // Starts collecting the entries for a new scan. The entries of the
+    // previous scan are used for lookups until finishScan() is invoked.
+    void beginScan();
+
+    // Replaces the previous entries with those of the current scan
+    // if the scan has been completed, i.e. entries of directories that
+    // have not been visited are discarded. The entries of an incomplete
+    // scan are discarded, because the changes might not have been stored
+    // in the database.
+    void finishScan(bool completed);
+
+    // Returns true if the directory has been scanned before and neither its
+    // modification time changed nor has it been invalidated since. The
+    // directory is then kept for the next scan.
+    bool keepUnchangedDirectory(
+            const QString& dirPath,
+            const QDateTime& lastModified);
+
+    // Records the modification time of a directory before listing its
+    // entries.
+    void updateDirectory(
+            const QString& dirPath,
+            const QDateTime& lastModified);
+
+    void invalidateDirectory(const QString& dirPath);
+
+    // The directly nested sub-directories that have been found during
+    // the previous scan.
+    QStringList previousSubdirectories(const QString& dirPath) const;
+
+    // All directories that are known after the last completed scan
+    QStringList directories() const;
+
+  private:
+    typedef QHash<QString, qint64> Entries;
+
+    const QString m_filePath;
+
+    mutable QMutex m_mutex;
+    Entries m_previousEntries;
+    Entries m_currentEntries;
+    QHash<QString, QStringList> m_previousSubdirectories;
+};
@@ -1,6 +1,7 @@
 #include "library/searchqueryparser.h"
 
 #include "util/compatibility.h"
+#include "util/db/dbconnection.h"
 
 #include "track/keyutils.h"
 
@@ -264,3 +265,41 @@ std::unique_ptr<QueryNode> SearchQueryParser::parseQuery(const QString& query,
 
     return pQuery;
 }
+
+bool SearchQueryParser::parsePlainSearchTerms(
+        const QString& query,
+        QStringList* pTerms) const {
+    DEBUG_ASSERT(pTerms);
+    pTerms->clear();
+    QStringList tokens = query.split(" ");
+    while (tokens.size() > 0) {
+        QString token = tokens.takeFirst().trimmed();
+        if (token.length() == 0) {
+            continue;
+        }
+        if (token.startsWith(kNegatePrefix) ||
+                m_fuzzyMatcher.indexIn(token) != -1 ||
+                m_textFilterMatcher.indexIn(token) != -1 ||
+                m_numericFilterMatcher.indexIn(token) != -1 ||
+                m_specialFilterMatcher.indexIn(token) != -1) {
+            return false;
+        }
+        QString argument = getTextArgument(token, &tokens);
+        // The SQL LIKE patterns of TextFilterNode treat '%' and '_' as
+        // wildcards and a trailing space must be followed by another
+        // character.
+        if (argument == kMissingFieldSearchTerm ||
+                argument.contains(QChar('%')) ||
+                argument.contains(QChar('_')) ||
+                argument.endsWith(QChar(' '))) {
+            return false;
+        }
+        if (argument.isEmpty()) {
+            // Matches everything
+            continue;
+        }
+        mixxx::DbConnection::makeStringLatinLow(&argument);
+        pTerms->append(argument);
+    }
+    return true;
+}
@@ -21,6 +21,14 @@ class SearchQueryParser {
             const QStringList& searchColumns,
             const QString& extraFilter) const;
 
+    // Splits a query that only consists of plain search terms without any
+    // filters, negations, or SQL wildcards into its terms, folded to lower
+    // case Latin characters. Each term matches the search columns or the
+    // names of crates like a TextFilterNode/CrateFilterNode would. Returns
+    // false if the query can only be evaluated by parseQuery().
+    bool parsePlainSearchTerms(
+            const QString& query,
+            QStringList* pTerms) const;
 
   private:
     void parseTokens(QStringList tokens,
@@ -0,0 +1,148 @@
+#include "library/trackcolumnstore.h"
+
+#include "util/assert.h"
+#include "util/compatibility.h"
+#include "util/db/dbconnection.h"
+
+namespace {
+
+// Separates the values of different columns in the search text. Search
+// terms never contain a line break and won't match across columns.
+const QChar kSearchTextSeparator = QLatin1Char('\n');
+
+} // anonymous namespace
+
+TrackColumnStore::TrackColumnStore(int columnCount)
+        : m_columns(columnCount) {
+}
+
+void TrackColumnStore::clear() {
+    for (auto& column : m_columns) {
+        column.clear();
+    }
+    m_trackIds.clear();
+    m_rowsByTrackId.clear();
+    m_unusedRows.clear();
+    m_internedStrings.clear();
+    m_searchText.clear();
+    m_searchIndex.clear();
+    m_sortRanks.clear();
+}
+
+QVariant TrackColumnStore::intern(const QVariant& value) {
+    if (value.type() != QVariant::String) {
+        return value;
+    }
+    const QString str = value.toString();
+    if (str.isEmpty()) {
+        return value;
+    }
+    auto i = m_internedStrings.constFind(str);
+    if (i == m_internedStrings.constEnd()) {
+        i = m_internedStrings.insert(str);
+    }
+    return QVariant(*i);
+}
+
+int TrackColumnStore::updateRow(TrackId trackId, const QVector<QVariant>& values) {
+    DEBUG_ASSERT(trackId.isValid());
+    DEBUG_ASSERT(values.size() == columnCount());
+    int row = m_rowsByTrackId.value(trackId, -1);
+    if (row < 0) {
+        if (m_unusedRows.isEmpty()) {
+            row = m_trackIds.size();
+            m_trackIds.append(trackId);
+            m_searchText.append(QString());
+            for (auto& column : m_columns) {
+                column.append(QVariant());
+            }
+        } else {
+            row = m_unusedRows.takeLast();
+            m_trackIds[row] = trackId;
+        }
+        m_rowsByTrackId.insert(trackId, row);
+        // A new row invalidates the ranks of all other rows
+        m_sortRanks.clear();
+    }
+    for (int i = 0; i < m_columns.size(); ++i) {
+        QVariant& storedValue = m_columns[i][row];
+        if (storedValue == values[i] && storedValue.type() == values[i].type()) {
+            continue;
+        }
+        storedValue = intern(values[i]);
+        m_sortRanks.remove(i);
+    }
+    updateSearchText(row);
+    return row;
+}
+
+bool TrackColumnStore::removeRow(TrackId trackId) {
+    const int row = m_rowsByTrackId.value(trackId, -1);
+    if (row < 0) {
+        return false;
+    }
+    m_rowsByTrackId.remove(trackId);
+    m_trackIds[row] = TrackId();
+    for (auto& column : m_columns) {
+        column[row] = QVariant();
+    }
+    m_searchIndex.remove(row, m_searchText[row]);
+    m_searchText[row] = QString();
+    m_unusedRows.append(row);
+    // The ranks of the remaining rows are still in the correct order.
+    // They are not necessarily consecutive anymore, which doesn't matter.
+    return true;
+}
+
+void TrackColumnStore::setSearchColumns(const QVector<int>& searchColumns) {
+    m_searchColumns.clear();
+    for (int column : searchColumns) {
+        if (column >= 0 && column < columnCount()) {
+            m_searchColumns.append(column);
+        }
+    }
+    m_searchIndex.clear();
+    for (int row = 0; row < rowCount(); ++row) {
+        m_searchText[row].clear();
+        if (m_trackIds[row].isValid()) {
+            updateSearchText(row);
+        }
+    }
+}
+
+void TrackColumnStore::updateSearchText(int row) {
+    QString searchText;
+    for (int column : qAsConst(m_searchColumns)) {
+        const QVariant& value = m_columns[column][row];
+        if (value.isNull()) {
+            continue;
+        }
+        if (!searchText.isEmpty()) {
+            searchText.append(kSearchTextSeparator);
+        }
+        searchText.append(value.toString());
+    }
+    mixxx::DbConnection::makeStringLatinLow(&searchText);
+    QString& storedSearchText = m_searchText[row];
+    if (storedSearchText == searchText) {
+        return;
+    }
+    m_searchIndex.remove(row, storedSearchText);
+    m_searchIndex.insert(row, searchText);
+    storedSearchText = searchText;
+}
+
+const QVector<int>* TrackColumnStore::sortRanks(int column) const {
+    const auto i = m_sortRanks.constFind(column);
+    if (i == m_sortRanks.constEnd()) {
+        return nullptr;
+    }
+    return &i.value();
+}
+
+void TrackColumnStore::setSortRanks(int column, QVector<int> ranks) {
+    VERIFY_OR_DEBUG_ASSERT(ranks.size() == rowCount()) {
+        return;
+    }
+    m_sortRanks.insert(column, std::move(ranks));
+}
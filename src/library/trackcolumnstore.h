@@ -0,0 +1,107 @@
+#pragma once
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+#include "library/tracktrigramindex.h"
+#include "track/trackid.h"
+
+// Column-oriented in-memory copy of the rows of a track table.
+//
+// Each column is stored in a separate contiguous array that is indexed by
+// row. Rows of removed tracks are recycled when new tracks are added. Equal
+// strings are interned and share the same implicitly shared buffer, which
+// saves a lot of memory for repetitive columns like artist, album, genre,
+// or file type.
+//
+// Derived data that is needed for searching and sorting is precomputed
+// and stored in flat arrays:
+//  - The contents of all search columns of a row folded to lower case Latin
+//    characters, ready for substring matching. A trigram index of this
+//    text narrows down the rows that need to be searched.
+//  - The rank of each row among all rows when sorted by a column. Ranks
+//    are computed on demand by the owner and remain valid until a value
+//    in the corresponding column changes.
+//
+// Not thread-safe! Concurrent read access from multiple threads is allowed
+// while no modifications are made.
+class TrackColumnStore {
+  public:
+    explicit TrackColumnStore(int columnCount);
+
+    int columnCount() const {
+        return m_columns.size();
+    }
+
+    // The number of allocated rows including unused rows
+    int rowCount() const {
+        return m_trackIds.size();
+    }
+
+    void clear();
+
+    // Returns -1 if the track is not stored
+    int row(TrackId trackId) const {
+        return m_rowsByTrackId.value(trackId, -1);
+    }
+
+    bool contains(TrackId trackId) const {
+        return m_rowsByTrackId.contains(trackId);
+    }
+
+    // Returns an invalid id for unused rows
+    TrackId trackId(int row) const {
+        return m_trackIds[row];
+    }
+
+    const QVariant& value(int row, int column) const {
+        return m_columns[column][row];
+    }
+
+    // Replaces all values of the track. The track is added if it is not
+    // stored yet. Returns the row of the track.
+    int updateRow(TrackId trackId, const QVector<QVariant>& values);
+
+    bool removeRow(TrackId trackId);
+
+    // Columns that are used for building the search text of each row
+    void setSearchColumns(const QVector<int>& searchColumns);
+
+    const QString& searchText(int row) const {
+        return m_searchText[row];
+    }
+
+    const TrackTrigramIndex& searchIndex() const {
+        return m_searchIndex;
+    }
+
+    // Returns nullptr if the ranks for this column have not been stored
+    // yet or have been invalidated since.
+    const QVector<int>* sortRanks(int column) const;
+    void setSortRanks(int column, QVector<int> ranks);
+
+    // The number of distinct interned strings
+    int internedStringCount() const {
+        return m_internedStrings.size();
+    }
+
+  private:
+    QVariant intern(const QVariant& value);
+    void updateSearchText(int row);
+
+    QVector<QVector<QVariant>> m_columns;
+    QVector<TrackId> m_trackIds;
+    QHash<TrackId, int> m_rowsByTrackId;
+    QVector<int> m_unusedRows;
+
+    QSet<QString> m_internedStrings;
+
+    QVector<int> m_searchColumns;
+    QVector<QString> m_searchText;
+    TrackTrigramIndex m_searchIndex;
+
+    QHash<int, QVector<int>> m_sortRanks;
+};
@@ -0,0 +1,101 @@
+#include "library/tracktrigramindex.h"
+
+#include <algorithm>
+
+#include "util/assert.h"
+
+namespace {
+
+inline quint64 trigramAt(const QChar* pChars) {
+    return (static_cast<quint64>(pChars[0].unicode()) << 32) |
+            (static_cast<quint64>(pChars[1].unicode()) << 16) |
+            static_cast<quint64>(pChars[2].unicode());
+}
+
+QVector<quint64> distinctTrigrams(const QString& text) {
+    QVector<quint64> trigrams;
+    const int count = text.size() - TrackTrigramIndex::kTrigramLength + 1;
+    if (count <= 0) {
+        return trigrams;
+    }
+    trigrams.reserve(count);
+    const QChar* const pChars = text.constData();
+    for (int i = 0; i < count; ++i) {
+        trigrams.append(trigramAt(pChars + i));
+    }
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
+
+} // anonymous namespace
+
+void TrackTrigramIndex::insert(int row, const QString& text) {
+    DEBUG_ASSERT(row >= 0);
+    for (quint64 trigram : distinctTrigrams(text)) {
+        QVector<int>& rows = m_rowsByTrigram[trigram];
+        if (rows.isEmpty() || rows.last() < row) {
+            rows.append(row);
+        } else {
+            const auto i = std::lower_bound(rows.begin(), rows.end(), row);
+            if (*i != row) {
+                rows.insert(i, row);
+            }
+        }
+    }
+}
+
+void TrackTrigramIndex::remove(int row, const QString& text) {
+    for (quint64 trigram : distinctTrigrams(text)) {
+        const auto i = m_rowsByTrigram.find(trigram);
+        if (i == m_rowsByTrigram.end()) {
+            continue;
+        }
+        QVector<int>& rows = i.value();
+        const auto j = std::lower_bound(rows.begin(), rows.end(), row);
+        if (j != rows.end() && *j == row) {
+            rows.erase(j);
+        }
+        if (rows.isEmpty()) {
+            m_rowsByTrigram.erase(i);
+        }
+    }
+}
+
+bool TrackTrigramIndex::findCandidates(const QString& term, QVector<int>* pRows) const {
+    DEBUG_ASSERT(pRows);
+    pRows->clear();
+    const QVector<quint64> trigrams = distinctTrigrams(term);
+    if (trigrams.isEmpty()) {
+        return false;
+    }
+    // Start with the most selective trigram to keep the
+    // intermediate results small
+    QVector<const QVector<int>*> rowLists;
+    rowLists.reserve(trigrams.size());
+    for (quint64 trigram : trigrams) {
+        const auto i = m_rowsByTrigram.constFind(trigram);
+        if (i == m_rowsByTrigram.constEnd()) {
+            // No match at all
+            return true;
+        }
+        rowLists.append(&i.value());
+    }
+    std::sort(rowLists.begin(), rowLists.end(),
+            [](const QVector<int>* lhs, const QVector<int>* rhs) {
+                return lhs->size() < rhs->size();
+            });
+    *pRows = *rowLists.first();
+    QVector<int> intersection;
+    for (int i = 1; i < rowLists.size() && !pRows->isEmpty(); ++i) {
+        intersection.clear();
+        std::set_intersection(
+                pRows->constBegin(),
+                pRows->constEnd(),
+                rowLists[i]->constBegin(),
+                rowLists[i]->constEnd(),
+                std::back_inserter(intersection));
+        pRows->swap(intersection);
+    }
+    return true;
+}
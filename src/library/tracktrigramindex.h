@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+// Inverted index from all substrings of length 3 (trigrams) to the rows
+// whose text contains them.
+//
+// A text can only contain a search term if it contains all trigrams of
+// that term. Intersecting the rows of these trigrams yields a small set of
+// candidates that need to be verified instead of searching through the
+// text of all rows. Terms shorter than a trigram cannot be looked up.
+//
+// The rows of each trigram are stored in ascending order. Appending rows
+// in ascending order, e.g. while loading all tracks, is cheap. Updating
+// the text of a single row costs a binary search per trigram.
+class TrackTrigramIndex {
+  public:
+    static constexpr int kTrigramLength = 3;
+
+    void clear() {
+        m_rowsByTrigram.clear();
+    }
+
+    void insert(int row, const QString& text);
+    void remove(int row, const QString& text);
+
+    // Returns false if the term is too short. Otherwise the rows that
+    // contain all trigrams of the term are returned in ascending order.
+    bool findCandidates(const QString& term, QVector<int>* pRows) const;
+
+    int trigramCount() const {
+        return m_rowsByTrigram.size();
+    }
+
+  private:
+    QHash<quint64, QVector<int>> m_rowsByTrigram;
+};
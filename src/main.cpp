@@ -19,17 +19,21 @@
 #include <QDir>
 #include <QtDebug>
 #include <QApplication>
+#include <QCoreApplication>
 #include <QStringList>
 #include <QString>
 #include <QTextCodec>
 
+#include "analyzer/headlessanalysis.h"
 #include "mixxx.h"
 #include "mixxxapplication.h"
+#include "preferences/settingsmanager.h"
 #include "sources/soundsourceproxy.h"
 #include "errordialoghandler.h"
 #include "util/cmdlineargs.h"
 #include "util/console.h"
 #include "util/logging.h"
+#include "util/sandbox.h"
 #include "util/version.h"
 
 #ifdef Q_OS_LINUX
@@ -55,6 +59,26 @@ int runMixxx(MixxxApplication* app, const CmdlineArgs& args) {
     return result;
 }
 
+// Runs without any widgets and audio devices
+int runHeadlessAnalysis(int& argc, char** argv, const CmdlineArgs& args) {
+    QCoreApplication app(argc, argv);
+    MixxxApplication::registerMetaTypes();
+
+    SoundSourceProxy::registerSoundSourceProviders();
+
+    SettingsManager settingsManager(nullptr, args.getSettingsPath());
+    UserSettingsPointer pConfig = settingsManager.settings();
+    Sandbox::initialize(QDir(pConfig->getSettingsPath()).filePath("sandbox.cfg"));
+    int result;
+    {
+        HeadlessAnalysis analysis(pConfig, args.getMusicFiles());
+        result = analysis.run();
+    }
+    settingsManager.save();
+    Sandbox::shutdown();
+    return result;
+}
+
 } // anonymous namespace
 
 int main(int argc, char * argv[]) {
@@ -103,6 +127,12 @@ int main(int argc, char * argv[]) {
                                args.getLogFlushLevel(),
                                args.getDebugAssertBreak());
 
+    if (args.getAnalyze()) {
+        int result = runHeadlessAnalysis(argc, argv, args);
+        mixxx::Logging::shutdown();
+        return result;
+    }
+
     MixxxApplication app(argc, argv);
 
     SoundSourceProxy::registerSoundSourceProviders();
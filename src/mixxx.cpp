@@ -59,6 +59,7 @@
 #include "waveform/visualsmanager.h"
 #include "waveform/sharedglcontext.h"
 #include "database/mixxxdb.h"
+#include "util/callbacktrace.h"
 #include "util/debug.h"
 #include "util/statsmanager.h"
 #include "util/timer.h"
@@ -692,6 +693,12 @@ void MixxxMainWindow::finalize() {
     qDebug() << t.elapsed(false).debugMillisWithUnit() << "deleting SoundManager";
     delete m_pSoundManager;
 
+    // All sound devices are closed now
+    CallbackTrace::instance().logSummary();
+    if (m_cmdLineArgs.getCallbackTraceEnabled()) {
+        CallbackTrace::instance().write(m_cmdLineArgs.getCallbackTracePath());
+    }
+
     // ControllerManager depends on Config
     qDebug() << t.elapsed(false).debugMillisWithUnit() << "deleting ControllerManager";
     delete m_pControllerManager;
@@ -11,9 +11,11 @@ class MixxxApplication : public QApplication {
     MixxxApplication(int& argc, char** argv);
     ~MixxxApplication() override;
 
+    // Also needed when running without a GUI
+    static void registerMetaTypes();
+
   private:
     bool touchIsRightButton();
-    void registerMetaTypes();
 
     int m_fakeMouseSourcePointId;
     QWidget* m_fakeMouseWidget;
@@ -13,6 +13,7 @@
 #include "soundio/sounddevice.h"
 #include "soundio/soundmanager.h"
 #include "soundio/soundmanagerutil.h"
+#include "util/callbacktrace.h"
 #include "util/logger.h"
 #include "util/sample.h"
 
@@ -409,6 +410,7 @@ void SoundDeviceNetwork::callbackProcessClkRef() {
 
     Trace trace("SoundDeviceNetwork::callbackProcessClkRef %1",
                 m_deviceId.name);
+    CallbackTrace::instance().beginCallback(m_audioBufferTime);
 
 
     if (!m_denormals) {
@@ -484,6 +486,7 @@ void SoundDeviceNetwork::updateAudioLatencyUsage() {
     unsigned long sleepUs = 0;
     if (currentTime > m_targetTime) {
         m_pSoundManager->underflowHappened(22);
+        CallbackTrace::instance().markXrun();
         //qDebug() << "underflow" << currentTime << m_targetTime;
         m_targetTime = currentTime;
     } else {
@@ -494,6 +497,7 @@ void SoundDeviceNetwork::updateAudioLatencyUsage() {
 
     // measure time in Audio callback at the very last
     m_timeInAudioCallback += m_clkRefTimer.elapsed();
+    CallbackTrace::instance().endCallback();
 
     // now go to sleep until the next callback
     if (sleepUs > 0) {
@@ -33,6 +33,7 @@
 #include "soundio/sounddevice.h"
 #include "soundio/soundmanager.h"
 #include "soundio/soundmanagerutil.h"
+#include "util/callbacktrace.h"
 #include "util/denormalsarezero.h"
 #include "util/sample.h"
 #include "util/timer.h"
@@ -899,6 +900,9 @@ int SoundDevicePortAudio::callbackProcessClkRef(
 
     Trace trace("SoundDevicePortAudio::callbackProcessClkRef %1",
                 m_deviceId.debugName());
+    CallbackTrace& callbackTrace = CallbackTrace::instance();
+    callbackTrace.beginCallback(
+            mixxx::Duration::fromSeconds(framesPerBuffer / m_dSampleRate));
 
     //qDebug() << "SoundDevicePortAudio::callbackProcess:" << m_deviceId;
     // Turn on TimeCritical priority for the callback thread. If we are running
@@ -954,6 +958,7 @@ int SoundDevicePortAudio::callbackProcessClkRef(
 
     if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
         m_pSoundManager->underflowHappened(6);
+        callbackTrace.markXrun();
     }
 
     m_pSoundManager->processUnderflowHappened();
@@ -996,6 +1001,7 @@ int SoundDevicePortAudio::callbackProcessClkRef(
     m_pSoundManager->writeProcess();
 
     updateAudioLatencyUsage(framesPerBuffer);
+    callbackTrace.endCallback();
 
     return paContinue;
 }
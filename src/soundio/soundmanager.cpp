@@ -33,6 +33,7 @@
 #include "soundio/sounddevicenotfound.h"
 #include "soundio/sounddeviceportaudio.h"
 #include "soundio/soundmanagerutil.h"
+#include "util/callbacktrace.h"
 #include "util/compatibility.h"
 #include "util/cmdlineargs.h"
 #include "util/defs.h"
@@ -68,6 +69,10 @@ SoundManager::SoundManager(UserSettingsPointer pConfig,
           m_pErrorDevice(NULL),
           m_underflowHappened(0),
           m_underflowUpdateCount(0) {
+    // Construct the callback trace and its ring buffer before the first
+    // callback, where it must not allocate.
+    CallbackTrace::instance();
+
     // TODO(xxx) some of these ControlObject are not needed by soundmanager, or are unused here.
     // It is possible to take them out?
     m_pControlObjectSoundStatusCO = new ControlObject(
@@ -0,0 +1,319 @@
+#include "sources/decodedaudiocache.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QFile>
+
+#include "util/logger.h"
+#include "util/math.h"
+#include "util/sample.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("DecodedAudioCache");
+
+const QString kFileSuffix = QStringLiteral(".pcm");
+
+// The engine and the analyzers both process stereo signals
+constexpr SINT kChannelCount = 2;
+
+constexpr char kMagic[8] = {'M', 'X', 'X', 'X', 'P', 'C', 'M', '1'};
+
+// The sample data follows the header immediately. The size of the header
+// is a multiple of 16 bytes to keep the sample data aligned.
+struct EntryHeader {
+    char magic[8];
+    quint32 channelCount;
+    quint32 sampleRate;
+    qint64 frameCount;
+    qint64 reserved;
+};
+static_assert(sizeof(EntryHeader) == 32, "Unexpected size of EntryHeader");
+
+constexpr qint64 kEntryHeaderSize = sizeof(EntryHeader);
+
+EntryHeader makeEntryHeader(AudioSignal::SampleRate sampleRate, SINT frameCount) {
+    EntryHeader header;
+    std::copy(std::begin(kMagic), std::end(kMagic), std::begin(header.magic));
+    header.channelCount = kChannelCount;
+    header.sampleRate = static_cast<quint32>(static_cast<SINT>(sampleRate));
+    header.frameCount = frameCount;
+    header.reserved = 0;
+    return header;
+}
+
+// Reads decoded samples directly from the memory-mapped cache entry.
+class AudioSourceDecodedAudioCache final : public AudioSource {
+  public:
+    AudioSourceDecodedAudioCache(
+            const QUrl& url,
+            const QString& entryFilePath)
+            : AudioSource(url),
+              m_file(entryFilePath),
+              m_pMappedData(nullptr),
+              m_pSamples(nullptr) {
+    }
+    ~AudioSourceDecodedAudioCache() override {
+        close();
+    }
+
+    void close() override {
+        if (m_pMappedData) {
+            m_file.unmap(m_pMappedData);
+            m_pMappedData = nullptr;
+            m_pSamples = nullptr;
+        }
+        m_file.close();
+    }
+
+  protected:
+    OpenResult tryOpen(
+            OpenMode /*mode*/,
+            const OpenParams& /*params*/) override {
+        if (!m_file.open(QIODevice::ReadOnly)) {
+            return OpenResult::Failed;
+        }
+        EntryHeader header;
+        if (m_file.read(reinterpret_cast<char*>(&header), kEntryHeaderSize) !=
+                kEntryHeaderSize) {
+            return OpenResult::Failed;
+        }
+        if (!std::equal(std::begin(kMagic), std::end(kMagic), std::begin(header.magic)) ||
+                header.channelCount != kChannelCount ||
+                header.frameCount <= 0) {
+            kLogger.warning()
+                    << "Invalid cache entry"
+                    << m_file.fileName();
+            return OpenResult::Failed;
+        }
+        const qint64 expectedFileSize = kEntryHeaderSize +
+                header.frameCount * kChannelCount * static_cast<qint64>(sizeof(CSAMPLE));
+        if (m_file.size() != expectedFileSize) {
+            kLogger.warning()
+                    << "Truncated cache entry"
+                    << m_file.fileName()
+                    << m_file.size()
+                    << "<>"
+                    << expectedFileSize;
+            return OpenResult::Failed;
+        }
+        if (!setChannelCount(kChannelCount) ||
+                !setSampleRate(static_cast<SINT>(header.sampleRate))) {
+            return OpenResult::Failed;
+        }
+        m_pMappedData = m_file.map(0, expectedFileSize);
+        if (!m_pMappedData) {
+            kLogger.warning()
+                    << "Failed to map cache entry"
+                    << m_file.fileName()
+                    << m_file.errorString();
+            return OpenResult::Failed;
+        }
+        m_pSamples = reinterpret_cast<const CSAMPLE*>(m_pMappedData + kEntryHeaderSize);
+        initFrameIndexRangeOnce(IndexRange::forward(0, header.frameCount));
+        return OpenResult::Succeeded;
+    }
+
+    ReadableSampleFrames readSampleFramesClamped(
+            WritableSampleFrames writableSampleFrames) override {
+        const auto frameIndexRange = writableSampleFrames.frameIndexRange();
+        const SINT sampleCount = frames2samples(frameIndexRange.length());
+        SampleUtil::copy(
+                writableSampleFrames.writableData(),
+                m_pSamples + frames2samples(frameIndexRange.start()),
+                sampleCount);
+        return ReadableSampleFrames(
+                frameIndexRange,
+                SampleBuffer::ReadableSlice(
+                        writableSampleFrames.writableData(),
+                        sampleCount));
+    }
+
+  private:
+    QFile m_file;
+    uchar* m_pMappedData;
+    const CSAMPLE* m_pSamples;
+};
+
+} // anonymous namespace
+
+const QString DecodedAudioCache::kConfigGroup = QStringLiteral("[Library]");
+const QString DecodedAudioCache::kEnabledConfigKey = QStringLiteral("DecodedAudioCacheEnabled");
+const QString DecodedAudioCache::kDirectoryConfigKey = QStringLiteral("DecodedAudioCacheDirectory");
+const QString DecodedAudioCache::kMaxSizeMBConfigKey = QStringLiteral("DecodedAudioCacheMaxSizeMB");
+
+//static
+bool DecodedAudioCache::isEnabled(const UserSettingsPointer& pConfig) {
+    return pConfig &&
+            pConfig->getValue(ConfigKey(kConfigGroup, kEnabledConfigKey), false);
+}
+
+DecodedAudioCache::DecodedAudioCache(const UserSettingsPointer& pConfig)
+        : m_enabled(isEnabled(pConfig)),
+          m_maxSizeBytes(0) {
+    if (!m_enabled) {
+        return;
+    }
+    m_directory = QDir(pConfig->getValue(
+            ConfigKey(kConfigGroup, kDirectoryConfigKey),
+            QDir(pConfig->getSettingsPath()).filePath("decodedaudio")));
+    const int maxSizeMB = pConfig->getValue(
+            ConfigKey(kConfigGroup, kMaxSizeMBConfigKey),
+            kDefaultMaxSizeMB);
+    m_maxSizeBytes = static_cast<qint64>(math_max(0, maxSizeMB)) * 1024 * 1024;
+}
+
+QString DecodedAudioCache::entryFilePath(const TrackFile& trackFile) const {
+    QCryptographicHash hasher(QCryptographicHash::Sha1);
+    hasher.addData(trackFile.location().toUtf8());
+    hasher.addData(QByteArray::number(trackFile.fileSize()));
+    hasher.addData(QByteArray::number(
+            trackFile.fileLastModified().toMSecsSinceEpoch()));
+    return m_directory.filePath(
+            QString::fromLatin1(hasher.result().toHex()) + kFileSuffix);
+}
+
+bool DecodedAudioCache::contains(const TrackFile& trackFile) const {
+    return m_enabled && QFile::exists(entryFilePath(trackFile));
+}
+
+AudioSourcePointer DecodedAudioCache::openAudioSource(
+        const TrackFile& trackFile) const {
+    if (!m_enabled) {
+        return nullptr;
+    }
+    const QString filePath = entryFilePath(trackFile);
+    if (!QFile::exists(filePath)) {
+        return nullptr;
+    }
+    auto pAudioSource = std::make_shared<AudioSourceDecodedAudioCache>(
+            QUrl::fromLocalFile(trackFile.location()),
+            filePath);
+    if (pAudioSource->open(AudioSource::OpenMode::Strict) !=
+            AudioSource::OpenResult::Succeeded) {
+        // Remove the corrupt entry, it will be created again during the
+        // next analysis.
+        pAudioSource.reset();
+        QFile::remove(filePath);
+        return nullptr;
+    }
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+    // The modification time of entries is used as the last access time
+    // for evicting the least recently used entries.
+    QFile file(filePath);
+    if (file.open(QIODevice::ReadWrite)) {
+        file.setFileTime(
+                QDateTime::currentDateTimeUtc(),
+                QFileDevice::FileModificationTime);
+    }
+#endif
+    return pAudioSource;
+}
+
+DecodedAudioCache::Writer::Writer(
+        const QString& fileName,
+        AudioSignal::SampleRate sampleRate)
+        : m_file(fileName),
+          m_sampleRate(sampleRate),
+          m_frameCount(0) {
+}
+
+bool DecodedAudioCache::Writer::open() {
+    if (!m_file.open(QIODevice::WriteOnly)) {
+        kLogger.warning()
+                << "Failed to create cache entry"
+                << m_file.fileName()
+                << m_file.errorString();
+        return false;
+    }
+    // Reserve space for the header that is written on commit()
+    const EntryHeader header = makeEntryHeader(m_sampleRate, 0);
+    return m_file.write(reinterpret_cast<const char*>(&header), kEntryHeaderSize) ==
+            kEntryHeaderSize;
+}
+
+bool DecodedAudioCache::Writer::writeSamples(
+        const CSAMPLE* pSamples,
+        SINT sampleCount) {
+    DEBUG_ASSERT(sampleCount % kChannelCount == 0);
+    const qint64 byteCount = sampleCount * static_cast<qint64>(sizeof(CSAMPLE));
+    if (m_file.write(reinterpret_cast<const char*>(pSamples), byteCount) != byteCount) {
+        kLogger.warning()
+                << "Failed to write cache entry"
+                << m_file.fileName()
+                << m_file.errorString();
+        return false;
+    }
+    m_frameCount += sampleCount / kChannelCount;
+    return true;
+}
+
+bool DecodedAudioCache::Writer::commit() {
+    if (m_frameCount <= 0) {
+        m_file.cancelWriting();
+        return false;
+    }
+    const EntryHeader header = makeEntryHeader(m_sampleRate, m_frameCount);
+    if (!m_file.seek(0) ||
+            m_file.write(reinterpret_cast<const char*>(&header), kEntryHeaderSize) !=
+                    kEntryHeaderSize) {
+        m_file.cancelWriting();
+        return false;
+    }
+    return m_file.commit();
+}
+
+std::unique_ptr<DecodedAudioCache::Writer> DecodedAudioCache::createWriter(
+        const TrackFile& trackFile,
+        AudioSignal::SampleRate sampleRate) const {
+    if (!m_enabled || !sampleRate.valid()) {
+        return nullptr;
+    }
+    if (!m_directory.exists() && !m_directory.mkpath(".")) {
+        kLogger.warning()
+                << "Failed to create directory"
+                << m_directory.path();
+        return nullptr;
+    }
+    auto pWriter = std::make_unique<Writer>(entryFilePath(trackFile), sampleRate);
+    if (!pWriter->open()) {
+        return nullptr;
+    }
+    return pWriter;
+}
+
+void DecodedAudioCache::evictLeastRecentlyUsed() const {
+    if (!m_enabled) {
+        return;
+    }
+    // Most recently used entries first
+    const QFileInfoList entries = m_directory.entryInfoList(
+            QStringList{QStringLiteral("*") + kFileSuffix},
+            QDir::Files,
+            QDir::Time);
+    qint64 totalSize = 0;
+    for (const auto& entry : entries) {
+        totalSize += entry.size();
+        if (totalSize <= m_maxSizeBytes) {
+            continue;
+        }
+        kLogger.debug()
+                << "Evicting"
+                << entry.fileName();
+        if (QFile::remove(entry.filePath())) {
+            totalSize -= entry.size();
+        } else {
+            // Might still be mapped by a reader on Windows
+            kLogger.warning()
+                    << "Failed to evict"
+                    << entry.filePath();
+        }
+    }
+}
+
+} // namespace mixxx
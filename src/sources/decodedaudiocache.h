@@ -0,0 +1,93 @@
+#pragma once
+
+#include <QDir>
+#include <QSaveFile>
+
+#include "preferences/usersettings.h"
+#include "sources/audiosource.h"
+#include "track/trackfile.h"
+#include "util/memory.h"
+
+namespace mixxx {
+
+// An optional on-disk cache of fully decoded audio data. Each entry stores
+// the decoded stereo signal of a single track file as raw interleaved
+// CSAMPLE values that are memory-mapped for reading. Loading a cached track
+// into a deck then does not need to decode anything and seeking into a
+// compressed file becomes as cheap as seeking into a WAV file.
+//
+// Entries are keyed by the file location, size and modification time of
+// the track file, i.e. modified files are decoded again and the outdated
+// entry is evicted eventually. The cache is filled while analyzing tracks
+// (see AnalyzerDecodedAudioCache) and the total size of all entries is
+// limited by evicting the least recently used entries.
+//
+// The class itself is stateless apart from the settings read in the
+// constructor, the file system serves as the index. Instances may be
+// used concurrently from different threads.
+class DecodedAudioCache final {
+  public:
+    static const QString kConfigGroup;
+    static const QString kEnabledConfigKey;
+    static const QString kDirectoryConfigKey;
+    static const QString kMaxSizeMBConfigKey;
+
+    static constexpr int kDefaultMaxSizeMB = 4096;
+
+    // The cache is disabled if pConfig is null.
+    explicit DecodedAudioCache(const UserSettingsPointer& pConfig);
+
+    static bool isEnabled(const UserSettingsPointer& pConfig);
+
+    bool isEnabled() const {
+        return m_enabled;
+    }
+
+    QDir directory() const {
+        return m_directory;
+    }
+
+    bool contains(const TrackFile& trackFile) const;
+
+    // Returns an opened audio source that reads from the cache entry of
+    // the given track file or nullptr if no valid entry exists.
+    AudioSourcePointer openAudioSource(const TrackFile& trackFile) const;
+
+    // Writes a new cache entry. The entry only becomes visible for readers
+    // after commit() succeeded. Destroying a writer without committing
+    // discards all samples that have been written.
+    class Writer final {
+      public:
+        Writer(const QString& fileName, AudioSignal::SampleRate sampleRate);
+
+        bool open();
+
+        bool writeSamples(const CSAMPLE* pSamples, SINT sampleCount);
+
+        bool commit();
+
+      private:
+        QSaveFile m_file;
+        const AudioSignal::SampleRate m_sampleRate;
+        SINT m_frameCount;
+    };
+
+    // Returns nullptr if the cache is disabled or the entry could not be
+    // created.
+    std::unique_ptr<Writer> createWriter(
+            const TrackFile& trackFile,
+            AudioSignal::SampleRate sampleRate) const;
+
+    // Deletes the least recently used entries until the total size of all
+    // entries fits into the configured limit.
+    void evictLeastRecentlyUsed() const;
+
+  private:
+    QString entryFilePath(const TrackFile& trackFile) const;
+
+    bool m_enabled;
+    QDir m_directory;
+    qint64 m_maxSizeBytes;
+};
+
+} // namespace mixxx
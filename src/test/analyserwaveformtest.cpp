@@ -105,4 +105,30 @@ TEST_F(AnalyzerWaveformTest, wrongTotalSamples) {
         EXPECT_FLOAT_EQ(canaryBigBuf[i], CANARY_FLOAT);
     }
 }
+
+//Make sure the analyzed parts of the waveform summary are announced in
+//order and without gaps while the track is analyzed.
+TEST_F(AnalyzerWaveformTest, summaryAnalyzedRanges) {
+    QList<QPair<int, int>> ranges;
+    QObject::connect(tio.get(), &Track::waveformSummaryAnalyzed,
+            [&ranges](int dataBegin, int dataEnd) {
+                ranges.append(qMakePair(dataBegin, dataEnd));
+            });
+    aw.initialize(tio, tio->getSampleRate(), BIGBUF_SIZE);
+    const int blockSize = 4096;
+    for (int i = 0; i < BIGBUF_SIZE; i += blockSize) {
+        aw.processSamples(&bigbuf[i], blockSize);
+    }
+    ConstWaveformPointer pSummary = tio->getWaveformSummary();
+    ASSERT_FALSE(ranges.isEmpty());
+    EXPECT_EQ(0, ranges.first().first);
+    for (int i = 1; i < ranges.size(); ++i) {
+        EXPECT_EQ(ranges[i - 1].second, ranges[i].first);
+        EXPECT_LT(ranges[i].first, ranges[i].second);
+    }
+    EXPECT_LE(ranges.last().second, pSummary->getCompletion());
+    EXPECT_GT(ranges.last().second, pSummary->getCompletion() - 8 * ChannelCount);
+    aw.storeResults(tio);
+    aw.cleanup();
+}
 } // namespace
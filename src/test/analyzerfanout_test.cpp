@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "analyzer/analyzerfanout.h"
+#include "util/math.h"
+
+namespace {
+
+constexpr SINT kBlockSize = 64;
+
+// Records all samples it receives
+class RecordingAnalyzer : public Analyzer {
+  public:
+    explicit RecordingAnalyzer(std::vector<CSAMPLE>* pRecorded)
+            : m_pRecorded(pRecorded) {
+    }
+
+    bool initialize(TrackPointer /*tio*/, int /*sampleRate*/, int /*totalSamples*/) override {
+        return true;
+    }
+    bool processSamples(const CSAMPLE* pIn, const int iLen) override {
+        m_pRecorded->insert(m_pRecorded->end(), pIn, pIn + iLen);
+        return true;
+    }
+    void storeResults(TrackPointer /*tio*/) override {
+    }
+    void cleanup() override {
+    }
+
+  private:
+    std::vector<CSAMPLE>* const m_pRecorded;
+};
+
+class AnalyzerFanOutTest : public testing::Test {
+  protected:
+    void initAnalyzers(int numAnalyzers) {
+        m_recorded.resize(numAnalyzers);
+        for (auto& recorded : m_recorded) {
+            m_analyzers.emplace_back(std::make_unique<RecordingAnalyzer>(&recorded));
+            ASSERT_TRUE(m_analyzers.back().initialize(TrackPointer(), 44100, 0));
+        }
+    }
+
+    void TearDown() override {
+        for (auto& analyzer : m_analyzers) {
+            analyzer.cancel();
+        }
+    }
+
+    // Publishes numSamples samples with increasing values, decoding
+    // every second block directly into the ring.
+    void publishRamp(AnalyzerFanOut* pFanOut, SINT numSamples) {
+        mixxx::SampleBuffer external(kBlockSize);
+        SINT sample = 0;
+        for (SINT i = 0; sample < numSamples; ++i) {
+            const SINT blockSize = math_min(kBlockSize, numSamples - sample);
+            auto writable = (i % 2 == 0)
+                    ? pFanOut->nextWritableBlock()
+                    : mixxx::SampleBuffer::WritableSlice(external);
+            ASSERT_LE(blockSize, writable.length());
+            for (SINT j = 0; j < blockSize; ++j) {
+                writable[j] = static_cast<CSAMPLE>(sample++);
+            }
+            pFanOut->publishBlock(writable.data(), blockSize);
+        }
+    }
+
+    std::vector<std::vector<CSAMPLE>> m_recorded;
+    std::vector<AnalyzerWithState> m_analyzers;
+};
+
+TEST_F(AnalyzerFanOutTest, AllAnalyzersReceiveAllBlocksInOrder) {
+    initAnalyzers(5);
+    AnalyzerFanOut fanOut(3, kBlockSize);
+    EXPECT_EQ(3, fanOut.numLanes());
+
+    // Many more blocks than buffers in the ring
+    const SINT kNumSamples = 100 * kBlockSize + kBlockSize / 2;
+    fanOut.begin(&m_analyzers);
+    publishRamp(&fanOut, kNumSamples);
+    fanOut.waitUntilProcessed();
+
+    for (const auto& recorded : m_recorded) {
+        ASSERT_EQ(static_cast<size_t>(kNumSamples), recorded.size());
+        for (SINT i = 0; i < kNumSamples; ++i) {
+            EXPECT_EQ(static_cast<CSAMPLE>(i), recorded[i]);
+        }
+    }
+}
+
+TEST_F(AnalyzerFanOutTest, ReuseForSubsequentTracks) {
+    initAnalyzers(2);
+    AnalyzerFanOut fanOut(2, kBlockSize, 2);
+
+    for (int track = 0; track < 3; ++track) {
+        for (auto& recorded : m_recorded) {
+            recorded.clear();
+        }
+        const SINT kNumSamples = (track + 1) * 10 * kBlockSize;
+        fanOut.begin(&m_analyzers);
+        publishRamp(&fanOut, kNumSamples);
+        fanOut.waitUntilProcessed();
+        for (const auto& recorded : m_recorded) {
+            ASSERT_EQ(static_cast<size_t>(kNumSamples), recorded.size());
+            EXPECT_EQ(static_cast<CSAMPLE>(kNumSamples - 1), recorded.back());
+        }
+    }
+}
+
+} // anonymous namespace
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include "library/basetrackcache.h"
+#include "library/dao/trackschema.h"
+#include "library/trackcollection.h"
+#include "test/librarytest.h"
+#include "util/db/dbconnection.h"
+
+// The tracks that are sorted in memory must end up in the same order as
+// when they are sorted by the database.
+class BaseTrackCacheTest : public LibraryTest {
+  protected:
+    BaseTrackCacheTest() {
+        const QStringList columns = {
+                LIBRARYTABLE_ID,
+                LIBRARYTABLE_TITLE,
+                LIBRARYTABLE_YEAR,
+                LIBRARYTABLE_TRACKNUMBER};
+        m_pTrackCache = std::make_unique<BaseTrackCache>(
+                internalCollection(), "library", LIBRARYTABLE_ID, columns, false);
+        m_pTrackCache->setSearchColumns(QStringList{LIBRARYTABLE_TITLE});
+    }
+
+    void addTrack(const QString& title,
+            const QString& year,
+            const QString& trackNumber) {
+        QSqlQuery query(dbConnection());
+        query.prepare(
+                "INSERT INTO library (title, year, tracknumber) "
+                "VALUES (:title, :year, :tracknumber)");
+        query.bindValue(":title", title);
+        query.bindValue(":year", year);
+        query.bindValue(":tracknumber", trackNumber);
+        ASSERT_TRUE(query.exec()) << query.lastError().text();
+        m_trackIds.insert(TrackId(query.lastInsertId()));
+    }
+
+    QVector<TrackId> sortInMemory(ColumnCache::Column column) {
+        const int columnIndex = m_pTrackCache->fieldIndex(column);
+        m_pTrackCache->m_trackOrder.clear();
+        EXPECT_TRUE(m_pTrackCache->filterAndSortInMemory(m_trackIds,
+                QString(),
+                QString(),
+                orderByClause(columnIndex),
+                {SortColumn(columnIndex, Qt::AscendingOrder)},
+                0));
+        return m_pTrackCache->m_trackOrder;
+    }
+
+    QVector<TrackId> sortWithQuery(ColumnCache::Column column) {
+        const int columnIndex = m_pTrackCache->fieldIndex(column);
+        QHash<TrackId, int> trackToIndex;
+        m_pTrackCache->m_trackOrder.clear();
+        m_pTrackCache->filterAndSortWithQuery(m_trackIds,
+                QString(),
+                QString(),
+                orderByClause(columnIndex),
+                &trackToIndex);
+        return m_pTrackCache->m_trackOrder;
+    }
+
+    QString orderByClause(int columnIndex) const {
+        return QString("ORDER BY %1 ASC")
+                .arg(mixxx::DbConnection::collateLexicographically(
+                        m_pTrackCache->columnSortForFieldIndex(columnIndex)));
+    }
+
+    std::unique_ptr<BaseTrackCache> m_pTrackCache;
+    QSet<TrackId> m_trackIds;
+};
+
+TEST_F(BaseTrackCacheTest, SortYearLikeDatabase) {
+    addTrack("a", "87", "1");
+    addTrack("b", "2001-05-03", "2");
+    addTrack("c", "1999", "3");
+    addTrack("d", "2001", "4");
+    m_pTrackCache->buildIndex();
+
+    const QVector<TrackId> expected = sortWithQuery(ColumnCache::COLUMN_LIBRARYTABLE_YEAR);
+    ASSERT_EQ(4, expected.size());
+    EXPECT_EQ(expected, sortInMemory(ColumnCache::COLUMN_LIBRARYTABLE_YEAR));
+}
+
+TEST_F(BaseTrackCacheTest, SortTrackNumberLikeDatabase) {
+    addTrack("a", "2000", "10");
+    addTrack("b", "2000", "3/12");
+    addTrack("c", "2000", "A1");
+    addTrack("d", "2000", "2");
+    addTrack("e", "2000", "01/02");
+    m_pTrackCache->buildIndex();
+
+    const QVector<TrackId> expected = sortWithQuery(ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER);
+    ASSERT_EQ(5, expected.size());
+    EXPECT_EQ(expected, sortInMemory(ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER));
+}
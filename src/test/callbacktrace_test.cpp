@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <thread>
+
+#include "util/callbacktrace.h"
+#include "util/memory.h"
+#include "util/time.h"
+
+namespace {
+
+class CallbackTraceTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        mixxx::Time::setTestMode(true);
+        setTime(0);
+        m_pTrace = std::make_unique<CallbackTrace>();
+    }
+
+    void TearDown() override {
+        mixxx::Time::setTestMode(false);
+    }
+
+    void setTime(qint64 micros) {
+        mixxx::Time::setTestElapsedTime(mixxx::Duration::fromMicros(micros));
+    }
+
+    // Traces a callback with a budget of 1000 us, starting at startMicros,
+    // that spends the given time in decks nested into the mixer.
+    void traceCallback(qint64 startMicros, qint64 decksMicros, bool xrun = false) {
+        setTime(startMicros);
+        m_pTrace->beginCallback(mixxx::Duration::fromMicros(1000));
+        setTime(startMicros + 10);
+        {
+            CallbackTrace::StageScope mixer(
+                    CallbackTrace::Stage::Mixer, m_pTrace.get());
+            setTime(startMicros + 20);
+            {
+                CallbackTrace::StageScope decks(
+                        CallbackTrace::Stage::Decks, m_pTrace.get());
+                setTime(startMicros + 20 + decksMicros);
+            }
+            setTime(startMicros + 30 + decksMicros);
+        }
+        if (xrun) {
+            m_pTrace->markXrun();
+        }
+        setTime(startMicros + 40 + decksMicros);
+        m_pTrace->endCallback();
+    }
+
+    std::unique_ptr<CallbackTrace> m_pTrace;
+};
+
+TEST_F(CallbackTraceTest, StagesAreExclusive) {
+    traceCallback(1000, 500);
+
+    const QVector<CallbackTrace::Span> spans = m_pTrace->spans();
+    ASSERT_EQ(1, spans.size());
+    const CallbackTrace::Span& span = spans.first();
+    EXPECT_EQ(1u, span.sequence);
+    EXPECT_EQ(1000000, span.startNanos);
+    EXPECT_EQ(540000, span.durationNanos);
+    EXPECT_EQ(20000, span.stageNanos[static_cast<int>(CallbackTrace::Stage::Io)]);
+    EXPECT_EQ(20000, span.stageNanos[static_cast<int>(CallbackTrace::Stage::Mixer)]);
+    EXPECT_EQ(500000, span.stageNanos[static_cast<int>(CallbackTrace::Stage::Decks)]);
+    EXPECT_EQ(0, span.stageNanos[static_cast<int>(CallbackTrace::Stage::Effects)]);
+    EXPECT_EQ(CallbackTrace::Stage::Decks, span.dominantStage());
+    EXPECT_FALSE(span.xrun);
+
+    // Scopes outside of a callback are ignored
+    {
+        CallbackTrace::StageScope effects(
+                CallbackTrace::Stage::Effects, m_pTrace.get());
+    }
+    EXPECT_EQ(1u, m_pTrace->callbackCount());
+}
+
+TEST_F(CallbackTraceTest, WorstSpanAndHistogram) {
+    traceCallback(0, 100);
+    traceCallback(2000, 1200, true);
+    traceCallback(4000, 300);
+
+    const CallbackTrace::Span worst = m_pTrace->worstSpan();
+    EXPECT_EQ(2u, worst.sequence);
+    EXPECT_TRUE(worst.xrun);
+    EXPECT_EQ(CallbackTrace::Stage::Decks, worst.dominantStage());
+    EXPECT_EQ(1u, m_pTrace->xrunCount());
+
+    const QVector<quint64> histogram = m_pTrace->loadHistogram();
+    ASSERT_EQ(CallbackTrace::kHistogramBuckets, histogram.size());
+    EXPECT_EQ(1u, histogram[1]); // 14%
+    EXPECT_EQ(1u, histogram[3]); // 34%
+    EXPECT_EQ(1u, histogram[CallbackTrace::kHistogramBuckets - 1]);
+
+    m_pTrace->reset();
+    EXPECT_EQ(0u, m_pTrace->callbackCount());
+    EXPECT_EQ(0u, m_pTrace->worstSpan().sequence);
+    EXPECT_TRUE(m_pTrace->spans().isEmpty());
+}
+
+TEST_F(CallbackTraceTest, RingKeepsLatestSpans) {
+    const int count = CallbackTrace::kRingSize + 10;
+    for (int i = 0; i < count; ++i) {
+        traceCallback(i * 1000, 100);
+    }
+
+    const QVector<CallbackTrace::Span> spans = m_pTrace->spans();
+    ASSERT_EQ(CallbackTrace::kRingSize, spans.size());
+    EXPECT_EQ(11u, spans.first().sequence);
+    EXPECT_EQ(static_cast<quint64>(count), spans.last().sequence);
+}
+
+TEST_F(CallbackTraceTest, Export) {
+    traceCallback(0, 100);
+    traceCallback(2000, 1200, true);
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    const QString csvPath = dir.filePath("trace.csv");
+    ASSERT_TRUE(m_pTrace->write(csvPath));
+    QFile csv(csvPath);
+    ASSERT_TRUE(csv.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QList<QByteArray> lines = csv.readAll().split('\n');
+    ASSERT_EQ(4, lines.size()); // header, 2 spans and the final newline
+    EXPECT_TRUE(lines[0].startsWith("sequence,start_us,duration_us,budget_us"));
+    EXPECT_EQ(QByteArray("2,2000.000,1240.000,1000.000,1.240,1,"
+                         "20.000,20.000,1200.000,0.000,0.000,0.000"),
+            lines[2]);
+
+    const QString jsonPath = dir.filePath("trace.json");
+    ASSERT_TRUE(m_pTrace->write(jsonPath));
+    QFile json(jsonPath);
+    ASSERT_TRUE(json.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QByteArray trace = json.readAll();
+    EXPECT_TRUE(trace.startsWith("{\"displayTimeUnit\""));
+    EXPECT_EQ(2, trace.count("\"ph\":\"X\""));
+    EXPECT_EQ(1, trace.count("\"name\":\"xrun\""));
+    EXPECT_TRUE(trace.contains("\"dominant_stage\":\"decks\""));
+}
+
+TEST_F(CallbackTraceTest, StagesOfOtherThreadsAreIgnored) {
+    setTime(1000);
+    m_pTrace->beginCallback(mixxx::Duration::fromMicros(1000));
+    {
+        CallbackTrace::StageScope decks(
+                CallbackTrace::Stage::Decks, m_pTrace.get());
+        // Like a channel worker thread that processes effects
+        std::thread worker([this] {
+            EXPECT_FALSE(m_pTrace->enterStage(CallbackTrace::Stage::Effects));
+        });
+        worker.join();
+        setTime(1500);
+    }
+    setTime(1600);
+    m_pTrace->endCallback();
+
+    const QVector<CallbackTrace::Span> spans = m_pTrace->spans();
+    ASSERT_EQ(1, spans.size());
+    EXPECT_EQ(500000, spans.first().stageNanos[
+            static_cast<int>(CallbackTrace::Stage::Decks)]);
+    EXPECT_EQ(0, spans.first().stageNanos[
+            static_cast<int>(CallbackTrace::Stage::Effects)]);
+}
+
+} // anonymous namespace
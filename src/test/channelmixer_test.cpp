@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <QtDebug>
+#include <vector>
+
+#include "engine/channelmixer.h"
+#include "util/sample.h"
+
+namespace {
+
+class ChannelMixerTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        m_pSavedKernels = &ChannelMixer::kernels();
+    }
+
+    void TearDown() override {
+        ChannelMixer::setKernels(*m_pSavedKernels);
+    }
+
+    static std::vector<CSAMPLE> makeBuffer(int size, int seed) {
+        std::vector<CSAMPLE> buffer(size);
+        for (int i = 0; i < size; ++i) {
+            buffer[i] = CSAMPLE(((i * 31 + seed * 17) % 97) - 48) / 97.0f;
+        }
+        return buffer;
+    }
+
+    const ChannelMixerKernels* m_pSavedKernels;
+};
+
+TEST_F(ChannelMixerTest, MixChannelBuffersMatchesScalar) {
+    // Odd sizes exercise the scalar tail of the vectorized kernels.
+    const int kBufferSizes[] = {2, 6, 14, 128, 1026};
+    for (int bufferSize : kBufferSizes) {
+        for (int numBuffers = 1; numBuffers <= 20; ++numBuffers) {
+            std::vector<std::vector<CSAMPLE>> buffers;
+            std::vector<const CSAMPLE*> pBuffers;
+            for (int i = 0; i < numBuffers; ++i) {
+                buffers.push_back(makeBuffer(bufferSize, i));
+            }
+            for (const auto& buffer : buffers) {
+                pBuffers.push_back(buffer.data());
+            }
+
+            std::vector<CSAMPLE> expected(bufferSize, CSAMPLE_ZERO);
+            for (const auto& buffer : buffers) {
+                for (int i = 0; i < bufferSize; ++i) {
+                    expected[i] += buffer[i];
+                }
+            }
+
+            for (const ChannelMixerKernels* pKernels : ChannelMixer::supportedKernels()) {
+                ChannelMixer::setKernels(*pKernels);
+                std::vector<CSAMPLE> output(bufferSize, 1.0f);
+                ChannelMixer::mixChannelBuffers(output.data(), pBuffers.data(),
+                        numBuffers, bufferSize);
+                for (int i = 0; i < bufferSize; ++i) {
+                    ASSERT_FLOAT_EQ(expected[i], output[i])
+                            << pKernels->name << " " << numBuffers << " buffers";
+                }
+            }
+        }
+    }
+}
+
+TEST_F(ChannelMixerTest, ApplyRampingGainMatchesSampleUtil) {
+    const int kBufferSizes[] = {2, 6, 14, 128, 1026};
+    const CSAMPLE_GAIN kGains[][2] = {
+        {0.0f, 1.0f}, {1.0f, 0.0f}, {0.3f, 0.3f}, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.2f, 1.5f},
+    };
+    for (int bufferSize : kBufferSizes) {
+        for (const auto& gains : kGains) {
+            std::vector<CSAMPLE> expected = makeBuffer(bufferSize, 3);
+            SampleUtil::applyRampingGain(expected.data(), gains[0], gains[1], bufferSize);
+
+            for (const ChannelMixerKernels* pKernels : ChannelMixer::supportedKernels()) {
+                ChannelMixer::setKernels(*pKernels);
+                std::vector<CSAMPLE> output = makeBuffer(bufferSize, 3);
+                ChannelMixer::applyRampingGain(output.data(), gains[0], gains[1], bufferSize);
+                for (int i = 0; i < bufferSize; ++i) {
+                    ASSERT_FLOAT_EQ(expected[i], output[i]) << pKernels->name;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(ChannelMixerTest, SelectKernelsPicksFastestSupported) {
+    ChannelMixer::selectKernels();
+    EXPECT_EQ(ChannelMixer::supportedKernels().back(), &ChannelMixer::kernels());
+}
+
+} // namespace
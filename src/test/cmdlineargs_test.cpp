@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+
+#include "util/cmdlineargs.h"
+
+namespace {
+
+TEST(CmdlineArgsTest, OptionValuesAreNoMusicFiles) {
+    CmdlineArgs& args = CmdlineArgs::Instance();
+    // The instance is shared with the other tests and restored afterwards
+    const CmdlineArgs savedArgs = args;
+
+    char arg0[] = "/usr/bin/mixxx";
+    char arg1[] = "--locale";
+    char arg2[] = "de";
+    char arg3[] = "--settingsPath";
+    char arg4[] = "/tmp/mixxx-settings";
+    char arg5[] = "--analyze";
+    char* argv[] = {arg0, arg1, arg2, arg3, arg4, arg5};
+    int argc = 6;
+    ASSERT_TRUE(args.Parse(argc, argv));
+
+    EXPECT_TRUE(args.getMusicFiles().isEmpty());
+    EXPECT_TRUE(args.getAnalyze());
+    EXPECT_EQ(QString("de"), args.getLocale());
+    EXPECT_EQ(QString("/tmp/mixxx-settings/"), args.getSettingsPath());
+
+    args = savedArgs;
+}
+
+} // anonymous namespace
@@ -193,6 +193,47 @@ TEST_F(ControllerEngineTest, softTakeover_ignoreNextValue) {
     EXPECT_DOUBLE_EQ(0.0, co->get());
 }
 
+TEST_F(ControllerEngineTest, getControl) {
+    auto co = std::make_unique<ControlPotmeter>(ConfigKey("[Test]", "co"),
+                                                -10.0, 10.0);
+    EXPECT_TRUE(execute("function() { handle = engine.getControl('[Test]', 'co'); }"));
+    EXPECT_TRUE(pScriptEngine->evaluate("handle.group + handle.key").toString() ==
+                "[Test]co");
+
+    EXPECT_TRUE(execute("function() { handle.set(5.0); }"));
+    EXPECT_DOUBLE_EQ(5.0, co->get());
+    EXPECT_TRUE(execute("function() { handle.setParameter(0.0); }"));
+    EXPECT_DOUBLE_EQ(-10.0, co->get());
+
+    co->set(2.0);
+    EXPECT_DOUBLE_EQ(2.0, pScriptEngine->evaluate("handle.get()").toNumber());
+    EXPECT_DOUBLE_EQ(0.6, pScriptEngine->evaluate("handle.getParameter()").toNumber());
+
+    // NaNs are ignored.
+    EXPECT_TRUE(execute("function() { handle.set(NaN); handle.setParameter(NaN); }"));
+    EXPECT_DOUBLE_EQ(2.0, co->get());
+}
+
+TEST_F(ControllerEngineTest, getControl_InvalidControl) {
+    EXPECT_TRUE(execute("function() { handle = engine.getControl('[Nothing]', 'nothing'); }"));
+    EXPECT_TRUE(pScriptEngine->evaluate("handle").isUndefined());
+}
+
+TEST_F(ControllerEngineTest, getControl_softTakeover) {
+    auto co = std::make_unique<ControlPotmeter>(ConfigKey("[Test]", "co"),
+                                                -10.0, 10.0);
+    co->setParameter(0.0);
+    EXPECT_TRUE(execute("function() {"
+                        "  handle = engine.getControl('[Test]', 'co');"
+                        "  engine.softTakeover('[Test]', 'co', true);"
+                        "  handle.setParameter(1.0); }"));
+    // The first set after enabling is always ignored.
+    EXPECT_DOUBLE_EQ(-10.0, co->get());
+
+    EXPECT_TRUE(execute("function() { handle.set(0.0); }"));
+    EXPECT_DOUBLE_EQ(0.0, co->get());
+}
+
 TEST_F(ControllerEngineTest, reset) {
     // Test that NaNs are ignored.
     auto co = std::make_unique<ControlPotmeter>(ConfigKey("[Test]", "co"),
@@ -639,3 +680,25 @@ TEST_F(ControllerEngineTest, colorProxy) {
         EXPECT_EQ(jsColor2.property("id").toInt32(), color->m_iId);
     }
 }
+
+TEST_F(ControllerEngineTest, executeMidiPassesTimestamp) {
+    auto co = std::make_unique<ControlObject>(ConfigKey("[Test]", "co"));
+    QScriptValue function = pScriptEngine->evaluate(
+            "(function(channel, control, value, status, group, timestamp) {"
+            "    engine.setValue(group, 'co', timestamp + value); })");
+    ASSERT_TRUE(function.isFunction());
+    EXPECT_TRUE(cEngine->execute(function, 0, 0x10, 0x7F, 0xB0, "[Test]",
+                                 mixxx::Duration::fromMillis(1234)));
+    EXPECT_DOUBLE_EQ(1234.0 + 0x7F, co->get());
+}
+
+TEST_F(ControllerEngineTest, executeByteArrayPassesTimestamp) {
+    auto co = std::make_unique<ControlObject>(ConfigKey("[Test]", "co"));
+    QScriptValue function = pScriptEngine->evaluate(
+            "(function(data, length, timestamp) {"
+            "    engine.setValue('[Test]', 'co', timestamp + length); })");
+    ASSERT_TRUE(function.isFunction());
+    EXPECT_TRUE(cEngine->execute(function, QByteArray("\x01\x02\x03", 3),
+                                 mixxx::Duration::fromMicros(2500)));
+    EXPECT_DOUBLE_EQ(2.5 + 3, co->get());
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include "controllers/controlleroutputscheduler.h"
+
+namespace {
+
+TEST(ControllerOutputSchedulerTest, CoalesceByAddress) {
+    ControllerOutputScheduler scheduler;
+    EXPECT_TRUE(scheduler.isEmpty());
+    EXPECT_TRUE(scheduler.schedule(1, "a1"));
+    EXPECT_TRUE(scheduler.schedule(2, "b1"));
+    EXPECT_FALSE(scheduler.schedule(1, "a2"));
+    EXPECT_TRUE(scheduler.schedule(3, "c1"));
+    EXPECT_FALSE(scheduler.schedule(1, "a3"));
+    EXPECT_EQ(3, scheduler.size());
+
+    // Sent in the order of the first change, with the latest message
+    const QList<ControllerOutputScheduler::Message> messages = scheduler.takeFrame();
+    ASSERT_EQ(3, messages.size());
+    EXPECT_EQ(ControllerOutputScheduler::Message(1, "a3"), messages[0]);
+    EXPECT_EQ(ControllerOutputScheduler::Message(2, "b1"), messages[1]);
+    EXPECT_EQ(ControllerOutputScheduler::Message(3, "c1"), messages[2]);
+    EXPECT_TRUE(scheduler.isEmpty());
+
+    // A new frame starts from scratch
+    EXPECT_TRUE(scheduler.schedule(1, "a4"));
+    EXPECT_EQ(1, scheduler.takeFrame().size());
+}
+
+TEST(ControllerOutputSchedulerTest, MaxMessagesPerFrame) {
+    ControllerOutputScheduler scheduler;
+    scheduler.setMaxMessagesPerFrame(2);
+    scheduler.schedule(1, "a1");
+    scheduler.schedule(2, "b1");
+    scheduler.schedule(3, "c1");
+
+    QList<ControllerOutputScheduler::Message> messages = scheduler.takeFrame();
+    ASSERT_EQ(2, messages.size());
+    EXPECT_EQ(1u, messages[0].first);
+    EXPECT_EQ(2u, messages[1].first);
+
+    // The deferred message is still coalesced
+    EXPECT_FALSE(scheduler.schedule(3, "c2"));
+    EXPECT_TRUE(scheduler.schedule(1, "a2"));
+    messages = scheduler.takeFrame();
+    ASSERT_EQ(2, messages.size());
+    EXPECT_EQ(ControllerOutputScheduler::Message(3, "c2"), messages[0]);
+    EXPECT_EQ(ControllerOutputScheduler::Message(1, "a2"), messages[1]);
+
+    scheduler.schedule(1, "a3");
+    scheduler.schedule(2, "b2");
+    scheduler.schedule(3, "c3");
+    EXPECT_EQ(3, scheduler.takeAll().size());
+    EXPECT_TRUE(scheduler.isEmpty());
+}
+
+} // anonymous namespace
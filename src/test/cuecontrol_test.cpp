@@ -421,3 +421,23 @@ TEST_F(CueControlTest, OutroCue_SetStartEnd_ClearStartEnd) {
 
     EXPECT_EQ(nullptr, pTrack->findCueByType(mixxx::CueType::Outro));
 }
+
+TEST_F(CueControlTest, HintReader_PinsCuePoints) {
+    TrackPointer pTrack = createTestTrack();
+    pTrack->setCuePoint(CuePosition(100.0));
+    auto pHotcue = pTrack->createAndAddCue();
+    pHotcue->setType(mixxx::CueType::HotCue);
+    pHotcue->setHotCue(0);
+    pHotcue->setStartPosition(4000.0);
+
+    loadTrack(pTrack);
+
+    HintVector hints;
+    m_pChannel1->getEngineBuffer()->m_pCueControl->hintReader(&hints);
+    ASSERT_EQ(2, hints.size());
+    EXPECT_EQ(50, hints[0].frame);
+    EXPECT_EQ(2000, hints[1].frame);
+    for (const auto& hint : hints) {
+        EXPECT_TRUE(hint.pinned);
+    }
+}
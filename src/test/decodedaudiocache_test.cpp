@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <QDateTime>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include "sources/decodedaudiocache.h"
+#include "test/mixxxtest.h"
+#include "util/math.h"
+#include "util/samplebuffer.h"
+
+namespace {
+
+const SINT kSampleRate = 44100;
+
+class DecodedAudioCacheTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_cacheDir.isValid());
+        ASSERT_TRUE(m_trackDir.isValid());
+        config()->set(ConfigKey(mixxx::DecodedAudioCache::kConfigGroup,
+                              mixxx::DecodedAudioCache::kEnabledConfigKey),
+                ConfigValue(1));
+        config()->set(ConfigKey(mixxx::DecodedAudioCache::kConfigGroup,
+                              mixxx::DecodedAudioCache::kDirectoryConfigKey),
+                ConfigValue(m_cacheDir.path()));
+    }
+
+    // The contents of the track files do not matter, entries are keyed by
+    // the location, size and modification time of the file.
+    TrackFile createTrackFile(const QString& fileName) {
+        const QString filePath = QDir(m_trackDir.path()).filePath(fileName);
+        QFile file(filePath);
+        EXPECT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write(fileName.toUtf8());
+        return TrackFile(filePath);
+    }
+
+    // Writes an entry with a ramp of sample values.
+    bool writeEntry(const mixxx::DecodedAudioCache& cache,
+            const TrackFile& trackFile,
+            SINT frameCount) {
+        auto pWriter = cache.createWriter(
+                trackFile, mixxx::AudioSignal::SampleRate(kSampleRate));
+        if (!pWriter) {
+            return false;
+        }
+        mixxx::SampleBuffer samples(frameCount * 2);
+        for (SINT i = 0; i < samples.size(); ++i) {
+            samples[i] = static_cast<CSAMPLE>(i);
+        }
+        // Write in several pieces like the analyzer does
+        const SINT pieceSize = 2 * 1024;
+        for (SINT i = 0; i < samples.size(); i += pieceSize) {
+            if (!pWriter->writeSamples(
+                        samples.data() + i, math_min(pieceSize, samples.size() - i))) {
+                return false;
+            }
+        }
+        return pWriter->commit();
+    }
+
+    QStringList entries() const {
+        return QDir(m_cacheDir.path()).entryList(QDir::Files);
+    }
+
+    QTemporaryDir m_cacheDir;
+    QTemporaryDir m_trackDir;
+};
+
+TEST_F(DecodedAudioCacheTest, DisabledByDefault) {
+    config()->set(ConfigKey(mixxx::DecodedAudioCache::kConfigGroup,
+                          mixxx::DecodedAudioCache::kEnabledConfigKey),
+            ConfigValue(0));
+    const mixxx::DecodedAudioCache cache(config());
+    EXPECT_FALSE(cache.isEnabled());
+    EXPECT_EQ(nullptr,
+            cache.createWriter(createTrackFile("track.mp3"),
+                    mixxx::AudioSignal::SampleRate(kSampleRate)));
+    EXPECT_FALSE(mixxx::DecodedAudioCache(UserSettingsPointer()).isEnabled());
+}
+
+TEST_F(DecodedAudioCacheTest, WriteAndRead) {
+    const mixxx::DecodedAudioCache cache(config());
+    const TrackFile trackFile = createTrackFile("track.mp3");
+    EXPECT_FALSE(cache.contains(trackFile));
+    EXPECT_EQ(nullptr, cache.openAudioSource(trackFile));
+
+    const SINT kFrameCount = 10000;
+    ASSERT_TRUE(writeEntry(cache, trackFile, kFrameCount));
+    EXPECT_TRUE(cache.contains(trackFile));
+
+    auto pAudioSource = cache.openAudioSource(trackFile);
+    ASSERT_NE(nullptr, pAudioSource);
+    EXPECT_EQ(2, pAudioSource->channelCount());
+    EXPECT_EQ(kSampleRate, pAudioSource->sampleRate());
+    EXPECT_EQ(mixxx::IndexRange::forward(0, kFrameCount),
+            pAudioSource->frameIndexRange());
+
+    const auto readRange = mixxx::IndexRange::forward(1234, 4321);
+    mixxx::SampleBuffer buffer(readRange.length() * 2);
+    const auto readable = pAudioSource->readSampleFrames(
+            mixxx::WritableSampleFrames(
+                    readRange,
+                    mixxx::SampleBuffer::WritableSlice(buffer)));
+    ASSERT_EQ(readRange, readable.frameIndexRange());
+    for (SINT i = 0; i < buffer.size(); ++i) {
+        EXPECT_EQ(static_cast<CSAMPLE>(readRange.start() * 2 + i),
+                readable.readableData()[i]);
+    }
+}
+
+TEST_F(DecodedAudioCacheTest, ModifiedTrackFileIsNotCached) {
+    const mixxx::DecodedAudioCache cache(config());
+    const TrackFile trackFile = createTrackFile("track.mp3");
+    ASSERT_TRUE(writeEntry(cache, trackFile, 1000));
+    EXPECT_TRUE(cache.contains(trackFile));
+
+    QFile file(trackFile.location());
+    ASSERT_TRUE(file.open(QIODevice::Append));
+    file.write("modified");
+    file.close();
+    EXPECT_FALSE(cache.contains(TrackFile(trackFile.location())));
+}
+
+TEST_F(DecodedAudioCacheTest, UncommittedEntryIsDiscarded) {
+    const mixxx::DecodedAudioCache cache(config());
+    const TrackFile trackFile = createTrackFile("track.mp3");
+    {
+        auto pWriter = cache.createWriter(
+                trackFile, mixxx::AudioSignal::SampleRate(kSampleRate));
+        ASSERT_NE(nullptr, pWriter);
+        const CSAMPLE samples[4] = {0.1f, 0.2f, 0.3f, 0.4f};
+        EXPECT_TRUE(pWriter->writeSamples(samples, 4));
+    }
+    EXPECT_FALSE(cache.contains(trackFile));
+    EXPECT_TRUE(entries().isEmpty());
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+TEST_F(DecodedAudioCacheTest, EvictLeastRecentlyUsed) {
+    config()->set(ConfigKey(mixxx::DecodedAudioCache::kConfigGroup,
+                          mixxx::DecodedAudioCache::kMaxSizeMBConfigKey),
+            ConfigValue(1));
+    const mixxx::DecodedAudioCache cache(config());
+
+    // Each entry occupies ~400 KB, so only two of them fit into the cache
+    const SINT kFrameCount = 50000;
+    const QDateTime now = QDateTime::currentDateTimeUtc();
+    QList<TrackFile> trackFiles;
+    for (int i = 0; i < 3; ++i) {
+        trackFiles.append(createTrackFile(QString("track%1.mp3").arg(i)));
+        ASSERT_TRUE(writeEntry(cache, trackFiles.last(), kFrameCount));
+    }
+    // Make the access times of the entries distinguishable: track1 has
+    // been used least recently.
+    for (const auto& entry : entries()) {
+        QFile file(QDir(m_cacheDir.path()).filePath(entry));
+        ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+        file.setFileTime(now.addSecs(-3600), QFileDevice::FileModificationTime);
+    }
+    EXPECT_NE(nullptr, cache.openAudioSource(trackFiles[0]));
+    EXPECT_NE(nullptr, cache.openAudioSource(trackFiles[2]));
+
+    cache.evictLeastRecentlyUsed();
+
+    EXPECT_EQ(2, entries().size());
+    EXPECT_TRUE(cache.contains(trackFiles[0]));
+    EXPECT_FALSE(cache.contains(trackFiles[1]));
+    EXPECT_TRUE(cache.contains(trackFiles[2]));
+}
+#endif
+
+} // anonymous namespace
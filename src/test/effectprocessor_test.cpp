@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "effects/effectprocessor.h"
+#include "test/baseeffecttest.h"
+
+namespace {
+
+class ReusableTestState : public EffectState {
+  public:
+    ReusableTestState(const mixxx::EngineParameters& bufferParameters)
+            : EffectState(bufferParameters) {
+        ++s_constructed;
+    }
+    ~ReusableTestState() override {
+        ++s_destructed;
+    }
+
+    bool reset(const mixxx::EngineParameters& bufferParameters) override {
+        Q_UNUSED(bufferParameters);
+        ++s_reset;
+        return true;
+    }
+
+    static int s_constructed;
+    static int s_destructed;
+    static int s_reset;
+};
+
+int ReusableTestState::s_constructed = 0;
+int ReusableTestState::s_destructed = 0;
+int ReusableTestState::s_reset = 0;
+
+class ReusableTestEffect : public EffectProcessorImpl<ReusableTestState> {
+  public:
+    void processChannel(const ChannelHandle& handle,
+            ReusableTestState* pState,
+            const CSAMPLE* pInput, CSAMPLE* pOutput,
+            const mixxx::EngineParameters& bufferParameters,
+            const EffectEnableState enableState,
+            const GroupFeatureState& groupFeatures) override {
+        Q_UNUSED(handle);
+        Q_UNUSED(pState);
+        Q_UNUSED(pInput);
+        Q_UNUSED(pOutput);
+        Q_UNUSED(bufferParameters);
+        Q_UNUSED(enableState);
+        Q_UNUSED(groupFeatures);
+    }
+};
+
+class EffectProcessorTest : public BaseEffectTest {
+  protected:
+    EffectProcessorTest()
+            : m_bufferParameters(mixxx::AudioSignal::SampleRate(44100), 1024),
+              m_master(m_factory.getOrCreateHandle("[Master]"), "[Master]"),
+              m_headphone(m_factory.getOrCreateHandle("[Headphone]"), "[Headphone]"),
+              m_channel1(m_factory.getOrCreateHandle("[Channel1]"), "[Channel1]") {
+        m_pEffectsManager->registerOutputChannel(m_master);
+        m_pEffectsManager->registerOutputChannel(m_headphone);
+        m_pEffectsManager->registerInputChannel(m_channel1);
+        ReusableTestState::s_constructed = 0;
+        ReusableTestState::s_destructed = 0;
+        ReusableTestState::s_reset = 0;
+    }
+
+    const mixxx::EngineParameters m_bufferParameters;
+    ChannelHandleFactory m_factory;
+    ChannelHandleAndGroup m_master;
+    ChannelHandleAndGroup m_headphone;
+    ChannelHandleAndGroup m_channel1;
+};
+
+TEST_F(EffectProcessorTest, ReuseStatesOfDisabledInputChannel) {
+    {
+        ReusableTestEffect effect;
+        effect.setSpareStateCount(1);
+        effect.initialize({m_channel1}, m_pEffectsManager.data(), m_bufferParameters);
+        EXPECT_EQ(2, ReusableTestState::s_constructed);
+
+        // One state is kept, the other one is deleted
+        effect.deleteStatesForInputChannel(&m_channel1.handle());
+        EXPECT_EQ(1, ReusableTestState::s_destructed);
+
+        std::unique_ptr<EffectState> pReused(effect.createState(m_bufferParameters));
+        EXPECT_EQ(2, ReusableTestState::s_constructed);
+        EXPECT_EQ(1, ReusableTestState::s_reset);
+
+        // No spare states are left
+        std::unique_ptr<EffectState> pAllocated(effect.createState(m_bufferParameters));
+        EXPECT_EQ(3, ReusableTestState::s_constructed);
+        EXPECT_EQ(1, ReusableTestState::s_reset);
+    }
+    EXPECT_EQ(ReusableTestState::s_constructed, ReusableTestState::s_destructed);
+}
+
+TEST_F(EffectProcessorTest, DeleteStatesWithoutSpareStateCount) {
+    {
+        ReusableTestEffect effect;
+        effect.initialize({m_channel1}, m_pEffectsManager.data(), m_bufferParameters);
+        effect.deleteStatesForInputChannel(&m_channel1.handle());
+        EXPECT_EQ(2, ReusableTestState::s_destructed);
+
+        std::unique_ptr<EffectState> pState(effect.createState(m_bufferParameters));
+        EXPECT_EQ(3, ReusableTestState::s_constructed);
+        EXPECT_EQ(0, ReusableTestState::s_reset);
+    }
+    EXPECT_EQ(ReusableTestState::s_constructed, ReusableTestState::s_destructed);
+}
+
+} // anonymous namespace
@@ -9,6 +9,10 @@
 #include "effects/effectchainslot.h"
 #include "effects/effectsmanager.h"
 #include "effects/effectmanifest.h"
+#include "engine/effects/engineeffectchain.h"
+#include "engine/effects/engineeffectrack.h"
+#include "engine/effects/engineeffectsmanager.h"
+#include "engine/effects/message.h"
 
 #include "test/baseeffecttest.h"
 
@@ -20,6 +24,31 @@ class EffectsManagerTest : public BaseEffectTest {
     void SetUp() override {
         registerTestBackend();
     }
+
+    // The requests that have been written to the engine and are waiting
+    // for a response
+    QList<EffectsRequest*> activeRequests() const {
+        return m_pEffectsManager->m_activeRequests.values();
+    }
+
+    int pendingResponseCount() const {
+        return m_pEffectsManager->m_pRequestPipe->messageCount();
+    }
+
+    void processEffectsResponses() {
+        m_pEffectsManager->processEffectsResponses();
+    }
+
+    static EffectsRequest* setChainParametersRequest(
+            EngineEffectChain* pChain, double mix) {
+        EffectsRequest* pRequest = new EffectsRequest();
+        pRequest->type = EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS;
+        pRequest->pTargetChain = pChain;
+        pRequest->SetEffectChainParameters.enabled = true;
+        pRequest->SetEffectChainParameters.mix_mode = EffectChainMixMode::DrySlashWet;
+        pRequest->SetEffectChainParameters.mix = mix;
+        return pRequest;
+    }
 };
 
 TEST_F(EffectsManagerTest, CanInstantiateEffectsFromBackend) {
@@ -36,3 +65,75 @@ TEST_F(EffectsManagerTest, CanInstantiateEffectsFromBackend) {
     EffectPointer pEffect = m_pEffectsManager->instantiateEffect(pManifest->id());
     EXPECT_FALSE(pEffect.isNull());
 }
+
+TEST_F(EffectsManagerTest, RequestBatchIsCoalescedAndAppliedAtOnce) {
+    EngineEffectsManager* pEngineEffectsManager =
+            m_pEffectsManager->getEngineEffectsManager();
+    EngineEffectRack* pRack = new EngineEffectRack(0);
+    EngineEffectChain* pChain = new EngineEffectChain("org.mixxx.test.chain",
+            QSet<ChannelHandleAndGroup>(), QSet<ChannelHandleAndGroup>());
+
+    {
+        EffectsRequestBatch batch(m_pEffectsManager.data());
+
+        EffectsRequest* pRequest = new EffectsRequest();
+        pRequest->type = EffectsRequest::ADD_EFFECT_RACK;
+        pRequest->AddEffectRack.pRack = pRack;
+        pRequest->AddEffectRack.signalProcessingStage = SignalProcessingStage::Postfader;
+        m_pEffectsManager->writeRequest(pRequest);
+
+        pRequest = new EffectsRequest();
+        pRequest->type = EffectsRequest::ADD_CHAIN_TO_RACK;
+        pRequest->pTargetRack = pRack;
+        pRequest->AddChainToRack.pChain = pChain;
+        pRequest->AddChainToRack.iIndex = 0;
+        m_pEffectsManager->writeRequest(pRequest);
+
+        // Only the last update of the chain is applied
+        m_pEffectsManager->writeRequest(setChainParametersRequest(pChain, 0.1));
+        m_pEffectsManager->writeRequest(setChainParametersRequest(pChain, 0.2));
+        m_pEffectsManager->writeRequest(setChainParametersRequest(pChain, 0.3));
+
+        // Nothing is written to the engine while the batch is open
+        EXPECT_TRUE(activeRequests().isEmpty());
+    }
+
+    const QList<EffectsRequest*> requests = activeRequests();
+    ASSERT_EQ(3, requests.size());
+    int chainUpdates = 0;
+    for (const EffectsRequest* pRequest : requests) {
+        if (pRequest->type == EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS) {
+            ++chainUpdates;
+            EXPECT_DOUBLE_EQ(0.3, pRequest->SetEffectChainParameters.mix);
+        }
+        if (pRequest->type == EffectsRequest::ADD_EFFECT_RACK) {
+            EXPECT_EQ(3, pRequest->batch_size);
+        } else {
+            EXPECT_EQ(1, pRequest->batch_size);
+        }
+    }
+    EXPECT_EQ(1, chainUpdates);
+
+    // The engine applies the whole batch within one callback
+    pEngineEffectsManager->onCallbackStart();
+    EXPECT_EQ(3, pendingResponseCount());
+    processEffectsResponses();
+    EXPECT_TRUE(activeRequests().isEmpty());
+
+    // Remove the chain and the rack again, they are deleted by the
+    // EffectsManager once the engine has responded
+    EffectsRequest* pRequest = new EffectsRequest();
+    pRequest->type = EffectsRequest::REMOVE_CHAIN_FROM_RACK;
+    pRequest->pTargetRack = pRack;
+    pRequest->RemoveChainFromRack.pChain = pChain;
+    pRequest->RemoveChainFromRack.iIndex = 0;
+    m_pEffectsManager->writeRequest(pRequest);
+    pRequest = new EffectsRequest();
+    pRequest->type = EffectsRequest::REMOVE_EFFECT_RACK;
+    pRequest->RemoveEffectRack.pRack = pRack;
+    pRequest->RemoveEffectRack.signalProcessingStage = SignalProcessingStage::Postfader;
+    m_pEffectsManager->writeRequest(pRequest);
+    pEngineEffectsManager->onCallbackStart();
+    processEffectsResponses();
+    EXPECT_TRUE(activeRequests().isEmpty());
+}
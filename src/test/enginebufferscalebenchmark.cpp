@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+#ifdef __SOUNDTOUCH_BUNDLED__
+#include <cpu_detect.h>
+#endif
+
+#include <memory>
+
+#include <QtDebug>
+
+#include "engine/bufferscalers/enginebufferscalelinear.h"
+#include "engine/bufferscalers/enginebufferscalerubberband.h"
+#include "engine/bufferscalers/enginebufferscalest.h"
+#include "test/readaheadmanagerfake.h"
+#include "util/samplebuffer.h"
+
+// Benchmarks of a single deck's scaler without the rest of the engine. Run
+// with `mixxx-test --benchmark --benchmark_filter=BM_EngineBufferScale`.
+// The two benchmark arguments are the rate in percent and the buffer size
+// in samples. A rate of 100% still passes through the scaler, but some
+// scalers take shortcuts in that case.
+//
+// BM_EngineBufferScale_SoundTouchNoSimd disables the SSE code paths of
+// SoundTouch, which are otherwise selected at runtime on x86 CPUs. It is
+// only available with the bundled SoundTouch, because the system library
+// does not export its CPU detection.
+
+namespace {
+
+template<typename Scaler>
+void runEngineBufferScaleBenchmark(benchmark::State& state, bool keylock) {
+    const double rate = state.range_x() / 100.0;
+    const SINT bufferSize = state.range_y();
+
+    ReadAheadManagerSineFake readAheadManager;
+    Scaler scaler(&readAheadManager);
+    scaler.setSampleRate(44100);
+    double tempoRatio = rate;
+    double pitchRatio = keylock ? 1.0 : rate;
+    scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+
+    mixxx::SampleBuffer output(bufferSize);
+    // Prime the internal buffers of the scaler before measuring
+    for (int i = 0; i < 16; ++i) {
+        scaler.scaleBuffer(output.data(), bufferSize);
+    }
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(scaler.scaleBuffer(output.data(), bufferSize));
+    }
+    // Report stereo frames processed per second of wall time.
+    state.SetItemsProcessed(static_cast<size_t>(state.iterations()) *
+            bufferSize / 2);
+}
+
+void engineBufferScaleBenchmarkArgs(benchmark::internal::Benchmark* pBenchmark) {
+    for (int ratePercent : {80, 100, 108, 150}) {
+        for (int bufferSize = 256; bufferSize <= 4096; bufferSize *= 4) {
+            pBenchmark->ArgPair(ratePercent, bufferSize);
+        }
+    }
+}
+
+void BM_EngineBufferScale_Linear(benchmark::State& state) {
+    runEngineBufferScaleBenchmark<EngineBufferScaleLinear>(state, false);
+}
+BENCHMARK(BM_EngineBufferScale_Linear)->Apply(engineBufferScaleBenchmarkArgs);
+
+void BM_EngineBufferScale_SoundTouch(benchmark::State& state) {
+    runEngineBufferScaleBenchmark<EngineBufferScaleST>(state, true);
+}
+BENCHMARK(BM_EngineBufferScale_SoundTouch)->Apply(engineBufferScaleBenchmarkArgs);
+
+#ifdef __SOUNDTOUCH_BUNDLED__
+void BM_EngineBufferScale_SoundTouchNoSimd(benchmark::State& state) {
+    // Only affects SoundTouch instances that are created afterwards
+    disableExtensions(0xffffffff);
+    runEngineBufferScaleBenchmark<EngineBufferScaleST>(state, true);
+    disableExtensions(0);
+}
+BENCHMARK(BM_EngineBufferScale_SoundTouchNoSimd)->Apply(engineBufferScaleBenchmarkArgs);
+#endif
+
+void BM_EngineBufferScale_RubberBand(benchmark::State& state) {
+    runEngineBufferScaleBenchmark<EngineBufferScaleRubberBand>(state, true);
+}
+BENCHMARK(BM_EngineBufferScale_RubberBand)->Apply(engineBufferScaleBenchmarkArgs);
+
+} // anonymous namespace
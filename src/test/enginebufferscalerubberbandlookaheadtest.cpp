@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <QtDebug>
+
+#include "engine/bufferscalers/enginebufferscalerubberbandlookahead.h"
+#include "test/mixxxtest.h"
+#include "test/readaheadmanagerfake.h"
+#include "util/sample.h"
+#include "util/samplebuffer.h"
+
+class EngineBufferScaleRubberBandLookAheadTest : public MixxxTest {
+  protected:
+    EngineBufferScaleRubberBandLookAheadTest()
+            : m_scaler(&m_readAheadManager),
+              m_output(kBufferFrames * 2) {
+        m_scaler.setSampleRate(44100);
+    }
+
+    void setTempo(double tempo) {
+        double tempoRatio = tempo;
+        double pitchRatio = 1.0;
+        m_scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+    }
+
+    // Renders the look-ahead like the worker does after each callback
+    double scaleBufferAndRender() {
+        const double framesRead = m_scaler.scaleBuffer(m_output.data(), m_output.size());
+        m_scaler.renderLookAhead();
+        return framesRead;
+    }
+
+    bool outputIsSilent() const {
+        for (SINT i = 0; i < m_output.size(); ++i) {
+            if (m_output[i] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static constexpr SINT kBufferFrames = 1024;
+
+    ReadAheadManagerSineFake m_readAheadManager;
+    EngineBufferScaleRubberBandLookAhead m_scaler;
+    mixxx::SampleBuffer m_output;
+};
+
+// Until the worker has rendered the look-ahead, the engine thread plays the
+// same input through the fallback and the position advances as usual.
+TEST_F(EngineBufferScaleRubberBandLookAheadTest, FallbackUntilPrimed) {
+    setTempo(1.5);
+    EXPECT_NEAR(1.5 * kBufferFrames,
+            m_scaler.scaleBuffer(m_output.data(), m_output.size()), 1e-6);
+    EXPECT_TRUE(m_scaler.m_bPriming);
+
+    double framesRead = 0.0;
+    for (int i = 0; i < 16; ++i) {
+        framesRead = scaleBufferAndRender();
+    }
+    EXPECT_FALSE(m_scaler.m_bPriming);
+    EXPECT_NEAR(1.5 * kBufferFrames, framesRead, 1e-6);
+    EXPECT_FALSE(outputIsSilent());
+    // More input has been read than consumed for the look-ahead
+    EXPECT_GT(m_readAheadManager.samplesRead(), 16 * 1.5 * kBufferFrames * 2);
+}
+
+// The look-ahead that has been rendered before a tempo change is played
+// at the previous tempo and the position advances accordingly.
+TEST_F(EngineBufferScaleRubberBandLookAheadTest, TempoChangeAfterLookAhead) {
+    setTempo(1.0);
+    for (int i = 0; i < 16; ++i) {
+        scaleBufferAndRender();
+    }
+    ASSERT_FALSE(m_scaler.m_bPriming);
+
+    setTempo(2.0);
+    EXPECT_NEAR(kBufferFrames, scaleBufferAndRender(), 1e-6);
+    double framesRead = 0.0;
+    for (int i = 0; i < 32; ++i) {
+        framesRead = scaleBufferAndRender();
+    }
+    EXPECT_NEAR(2.0 * kBufferFrames, framesRead, 1e-6);
+}
+
+TEST_F(EngineBufferScaleRubberBandLookAheadTest, ClearDiscardsLookAhead) {
+    setTempo(1.0);
+    for (int i = 0; i < 16; ++i) {
+        scaleBufferAndRender();
+    }
+    ASSERT_FALSE(m_scaler.m_bPriming);
+    const SINT samplesRead = m_readAheadManager.samplesRead();
+
+    // The look-ahead is rendered from new input after seeking, in the
+    // meantime the fallback plays the new input.
+    m_scaler.clear();
+    EXPECT_TRUE(m_scaler.m_bPriming);
+    EXPECT_NEAR(kBufferFrames,
+            m_scaler.scaleBuffer(m_output.data(), m_output.size()), 1e-6);
+    EXPECT_GT(m_readAheadManager.samplesRead(), samplesRead + kBufferFrames * 2);
+
+    for (int i = 0; i < 16; ++i) {
+        scaleBufferAndRender();
+    }
+    EXPECT_FALSE(m_scaler.m_bPriming);
+    EXPECT_FALSE(outputIsSilent());
+}
+
+// Input that has been submitted before clear() is discarded by the worker
+// and must not keep the engine from submitting new input.
+TEST_F(EngineBufferScaleRubberBandLookAheadTest, ClearDiscardsPendingInput) {
+    setTempo(1.0);
+    m_scaler.scaleBuffer(m_output.data(), m_output.size());
+    m_scaler.scaleBuffer(m_output.data(), m_output.size());
+    EXPECT_GT(m_scaler.bufferedFrames(), 0);
+
+    m_scaler.clear();
+    EXPECT_EQ(0, m_scaler.bufferedFrames());
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "engine/enginechannelworkerpool.h"
+
+namespace {
+
+class CountingTask : public EngineChannelWorkerPool::Task {
+  public:
+    explicit CountingTask(int numJobs)
+            : m_runCounts(numJobs) {
+        for (auto& count : m_runCounts) {
+            count = 0;
+        }
+    }
+
+    void runJob(int jobIndex) override {
+        ASSERT_GE(jobIndex, 0);
+        ASSERT_LT(jobIndex, static_cast<int>(m_runCounts.size()));
+        m_runCounts[jobIndex].fetch_add(1);
+    }
+
+    int runCount(int jobIndex) const {
+        return m_runCounts[jobIndex].load();
+    }
+
+  private:
+    std::vector<std::atomic<int>> m_runCounts;
+};
+
+TEST(EngineChannelWorkerPoolTest, RunsEachJobExactlyOnce) {
+    EngineChannelWorkerPool pool(3);
+    EXPECT_EQ(3, pool.numThreads());
+
+    const int kNumJobs = 20;
+    CountingTask task(kNumJobs);
+    pool.run(&task, kNumJobs);
+
+    for (int i = 0; i < kNumJobs; ++i) {
+        EXPECT_EQ(1, task.runCount(i));
+    }
+}
+
+TEST(EngineChannelWorkerPoolTest, RepeatedBatchesOfVaryingSize) {
+    EngineChannelWorkerPool pool(2);
+
+    // Simulate many callbacks with a changing number of active channels.
+    // Workers that wake up late must never run a job of a later batch twice.
+    for (int batch = 0; batch < 1000; ++batch) {
+        const int numJobs = 1 + batch % 7;
+        CountingTask task(numJobs);
+        pool.run(&task, numJobs);
+        for (int i = 0; i < numJobs; ++i) {
+            ASSERT_EQ(1, task.runCount(i));
+        }
+    }
+}
+
+TEST(EngineChannelWorkerPoolTest, NoWorkerThreads) {
+    // Without worker threads all jobs are run on the calling thread.
+    EngineChannelWorkerPool pool(0);
+    const int kNumJobs = 4;
+    CountingTask task(kNumJobs);
+    pool.run(&task, kNumJobs);
+    for (int i = 0; i < kNumJobs; ++i) {
+        EXPECT_EQ(1, task.runCount(i));
+    }
+}
+
+} // namespace
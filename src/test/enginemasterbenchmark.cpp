@@ -0,0 +1,188 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include <QtDebug>
+
+#include "control/controlobject.h"
+#include "effects/builtin/builtinbackend.h"
+#include "effects/effectchain.h"
+#include "effects/effectchainslot.h"
+#include "effects/effectrack.h"
+#include "effects/effectsmanager.h"
+#include "engine/enginebuffer.h"
+#include "engine/enginemaster.h"
+#include "test/signalpathtest.h"
+#include "track/track.h"
+
+// Benchmarks of the complete audio callback (EngineMaster::process) with
+// real decks, scalers and effects. Run with `mixxx-test --benchmark`, e.g.
+// --benchmark_filter=BM_EngineMasterProcess_RubberBand to only run one
+// scaler. The two benchmark arguments are the number of playing decks and
+// the buffer size in samples.
+
+namespace {
+
+enum class Scaler {
+    // Keylock off, decks are scaled by EngineBufferScaleLinear.
+    Linear,
+    // Keylock on with EngineBufferScaleST.
+    SoundTouch,
+    // Keylock on with EngineBufferScaleRubberBand.
+    RubberBand,
+};
+
+const int kMaxDecks = 8;
+
+class EngineMasterBenchmark : public BaseSignalPathTest {
+  public:
+    EngineMasterBenchmark(int numDecks, Scaler scaler, bool withEffects) {
+        // BaseSignalPathTest already provides the first three decks.
+        for (int i = 4; i <= kMaxDecks; ++i) {
+            QString group = QString("[Channel%1]").arg(i);
+            auto pDeck = std::make_unique<Deck>(nullptr, m_pConfig,
+                    m_pEngineMaster, m_pEffectsManager, m_pVisualsManager,
+                    EngineChannel::CENTER, group);
+            pDeck->setupEqControls();
+            addDeck(pDeck->getEngineDeck());
+            m_extraDecks.push_back(std::move(pDeck));
+        }
+
+        if (withEffects) {
+            m_pEffectsManager->addEffectsBackend(
+                    new BuiltInBackend(m_pEffectsManager));
+            loadEchoChain();
+        }
+
+        if (scaler == Scaler::RubberBand) {
+            ControlObject::set(ConfigKey(m_sMasterGroup, "keylock_engine"),
+                    EngineBuffer::RUBBERBAND);
+        } else {
+            ControlObject::set(ConfigKey(m_sMasterGroup, "keylock_engine"),
+                    EngineBuffer::SOUNDTOUCH);
+        }
+
+        const QString kTrackLocationTest =
+                QDir::currentPath() + "/src/test/sine-30.wav";
+        for (int i = 0; i < numDecks && i < kMaxDecks; ++i) {
+            Deck* pDeck = deck(i);
+            loadTrack(pDeck, Track::newTemporary(kTrackLocationTest));
+            const QString group = pDeck->getGroup();
+            ControlObject::set(ConfigKey(group, "keylock"),
+                    scaler == Scaler::Linear ? 0.0 : 1.0);
+            // Play off-tempo, so the scalers actually have to do work.
+            ControlObject::set(ConfigKey(group, "rate"), 0.3 + 0.05 * i);
+            ControlObject::set(ConfigKey(group, "play"), 1.0);
+        }
+    }
+
+    ~EngineMasterBenchmark() override {
+        // The decks have to go before EngineMaster is deleted by the base
+        // class.
+        m_extraDecks.clear();
+    }
+
+    void process(int bufferSize) {
+        m_pEngineMaster->process(bufferSize);
+    }
+
+    // Not a real test, required by the testing::Test base class.
+    void TestBody() override {
+    }
+
+  private:
+    Deck* deck(int index) const {
+        switch (index) {
+        case 0:
+            return m_pMixerDeck1;
+        case 1:
+            return m_pMixerDeck2;
+        case 2:
+            return m_pMixerDeck3;
+        default:
+            return m_extraDecks[index - 3].get();
+        }
+    }
+
+    void loadEchoChain() {
+        StandardEffectRackPointer pRack = m_pEffectsManager->addStandardEffectRack();
+        EffectChainSlotPointer pChainSlot = pRack->getEffectChainSlot(0);
+        EffectChainPointer pChain(new EffectChain(m_pEffectsManager,
+                "org.mixxx.effectchain.benchmark"));
+        pChain->addEffect(m_pEffectsManager->instantiateEffect(
+                "org.mixxx.effects.echo"));
+        pChainSlot->loadEffectChainToSlot(pChain);
+        pChain->setEnabled(true);
+        pChain->setMix(1.0);
+
+        const QString chainGroup =
+                StandardEffectRack::formatEffectChainSlotGroupString(0, 0);
+        for (int i = 0; i < kMaxDecks; ++i) {
+            ControlObject::set(ConfigKey(chainGroup,
+                    QString("group_%1_enable").arg(deck(i)->getGroup())), 1.0);
+        }
+    }
+
+    std::vector<std::unique_ptr<Deck>> m_extraDecks;
+};
+
+void runEngineMasterBenchmark(benchmark::State& state,
+        Scaler scaler, bool withEffects) {
+    const int numDecks = state.range_x();
+    const int bufferSize = state.range_y();
+    EngineMasterBenchmark engine(numDecks, scaler, withEffects);
+
+    // Let the reader threads fill the caches and the scalers prime their
+    // internal buffers before measuring.
+    for (int i = 0; i < 16; ++i) {
+        engine.process(bufferSize);
+    }
+
+    while (state.KeepRunning()) {
+        engine.process(bufferSize);
+    }
+    // Report stereo frames processed per second of wall time.
+    state.SetItemsProcessed(static_cast<size_t>(state.iterations()) *
+            bufferSize / 2);
+}
+
+void engineMasterBenchmarkArgs(benchmark::internal::Benchmark* pBenchmark) {
+    for (int numDecks : {2, 4, 8}) {
+        for (int bufferSize = 64; bufferSize <= 4096; bufferSize *= 2) {
+            pBenchmark->ArgPair(numDecks, bufferSize);
+        }
+    }
+}
+
+void BM_EngineMasterProcess_Linear(benchmark::State& state) {
+    runEngineMasterBenchmark(state, Scaler::Linear, false);
+}
+BENCHMARK(BM_EngineMasterProcess_Linear)->Apply(engineMasterBenchmarkArgs);
+
+void BM_EngineMasterProcess_SoundTouch(benchmark::State& state) {
+    runEngineMasterBenchmark(state, Scaler::SoundTouch, false);
+}
+BENCHMARK(BM_EngineMasterProcess_SoundTouch)->Apply(engineMasterBenchmarkArgs);
+
+void BM_EngineMasterProcess_RubberBand(benchmark::State& state) {
+    runEngineMasterBenchmark(state, Scaler::RubberBand, false);
+}
+BENCHMARK(BM_EngineMasterProcess_RubberBand)->Apply(engineMasterBenchmarkArgs);
+
+void BM_EngineMasterProcess_LinearWithEffects(benchmark::State& state) {
+    runEngineMasterBenchmark(state, Scaler::Linear, true);
+}
+BENCHMARK(BM_EngineMasterProcess_LinearWithEffects)->Apply(engineMasterBenchmarkArgs);
+
+void BM_EngineMasterProcess_SoundTouchWithEffects(benchmark::State& state) {
+    runEngineMasterBenchmark(state, Scaler::SoundTouch, true);
+}
+BENCHMARK(BM_EngineMasterProcess_SoundTouchWithEffects)->Apply(engineMasterBenchmarkArgs);
+
+void BM_EngineMasterProcess_RubberBandWithEffects(benchmark::State& state) {
+    runEngineMasterBenchmark(state, Scaler::RubberBand, true);
+}
+BENCHMARK(BM_EngineMasterProcess_RubberBandWithEffects)->Apply(engineMasterBenchmarkArgs);
+
+} // anonymous namespace
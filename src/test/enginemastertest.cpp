@@ -392,4 +392,55 @@ TEST_F(EngineMasterTest, ThreeChannelPFLOutputWorks) {
     assertHeadphoneBufferMatchesGolden(testName);
 }
 
+class EngineMasterChannelWorkerPoolTest : public BaseSignalPathTest {
+  protected:
+    EngineMasterChannelWorkerPoolTest()
+            : BaseSignalPathTest(2) {
+        const QString kTrackLocationTest = QDir::currentPath() + "/src/test/sine-30.wav";
+        TrackPointer pTrack(Track::newTemporary(kTrackLocationTest));
+
+        loadTrack(m_pMixerDeck1, pTrack);
+        loadTrack(m_pMixerDeck2, pTrack);
+        loadTrack(m_pMixerDeck3, pTrack);
+    }
+};
+
+TEST_F(EngineMasterChannelWorkerPoolTest, SyncedDecksWithIndependentDeck) {
+    ControlObject::set(ConfigKey(m_sGroup1, "file_bpm"), 130.0);
+    ControlObject::set(ConfigKey(m_sGroup2, "file_bpm"), 120.0);
+    ControlObject::set(ConfigKey(m_sGroup3, "file_bpm"), 100.0);
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup2, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup3, "play"), 1.0);
+
+    // All decks are independent and processed concurrently.
+    ProcessBuffer();
+    ProcessBuffer();
+
+    // The decks are playing, so the sync requests are queued and have to be
+    // applied by the engine.
+    ControlObject::set(ConfigKey(m_sGroup1, "sync_enabled"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup2, "sync_enabled"), 1.0);
+    for (int i = 0; i < 10; ++i) {
+        ProcessBuffer();
+    }
+
+    EXPECT_EQ(1.0, ControlObject::get(ConfigKey(m_sGroup1, "sync_enabled")));
+    EXPECT_EQ(1.0, ControlObject::get(ConfigKey(m_sGroup2, "sync_enabled")));
+    EXPECT_EQ(0.0, ControlObject::get(ConfigKey(m_sGroup3, "sync_enabled")));
+    EXPECT_FLOAT_EQ(ControlObject::get(ConfigKey(m_sGroup1, "bpm")),
+            ControlObject::get(ConfigKey(m_sGroup2, "bpm")));
+    EXPECT_FLOAT_EQ(100.0, ControlObject::get(ConfigKey(m_sGroup3, "bpm")));
+
+    // Leaving sync makes deck 2 independent again.
+    ControlObject::set(ConfigKey(m_sGroup2, "sync_enabled"), 0.0);
+    for (int i = 0; i < 10; ++i) {
+        ProcessBuffer();
+    }
+
+    EXPECT_EQ(1.0, ControlObject::get(ConfigKey(m_sGroup1, "sync_enabled")));
+    EXPECT_EQ(0.0, ControlObject::get(ConfigKey(m_sGroup2, "sync_enabled")));
+    EXPECT_GT(ControlObject::get(ConfigKey(m_sGroup3, "playposition")), 0.0);
+}
+
 }  // namespace
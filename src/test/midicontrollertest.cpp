@@ -1,4 +1,5 @@
 #include <QScopedPointer>
+#include <QThread>
 
 #include <gmock/gmock.h>
 
@@ -44,6 +45,31 @@ class MidiControllerTest : public MixxxTest {
         m_pController->receive(status, control, value, mixxx::Time::elapsed());
     }
 
+    void setOutputScheduling(int frameMillis, int maxMessagesPerFrame) {
+        m_pController->setOutputScheduling(frameMillis, maxMessagesPerFrame);
+    }
+
+    void scheduleShortMsg(unsigned char status, unsigned char control,
+                          unsigned char value) {
+        m_pController->scheduleShortMsg(status, control, value);
+    }
+
+    void startEngine() {
+        m_pController->startEngine();
+    }
+
+    void stopEngine() {
+        m_pController->stopEngine();
+    }
+
+    // Lets the output timer of the controller expire and deliver it
+    void waitForOutputFrame() {
+        QThread::msleep(2 * kOutputFrameMillis);
+        application()->processEvents();
+    }
+
+    static constexpr int kOutputFrameMillis = 10;
+
     MidiControllerPreset m_preset;
     QScopedPointer<MockMidiController> m_pController;
 };
@@ -523,3 +549,58 @@ TEST_F(MidiControllerTest, ReceiveMessage_PotMeterCO_14BitPitchBend) {
     receive(MIDI_PITCH_BEND | channel, 0x01, 0x40);
     EXPECT_LT(kMiddleValue, potmeter.get());
 }
+
+TEST_F(MidiControllerTest, ScheduledOutput_CoalescedAndRateLimited) {
+    setOutputScheduling(kOutputFrameMillis, 2);
+
+    EXPECT_CALL(*m_pController, sendShortMsg(testing::_, testing::_, testing::_))
+            .Times(0);
+    scheduleShortMsg(MIDI_NOTE_ON, 0x10, 0x00);
+    scheduleShortMsg(MIDI_NOTE_ON, 0x11, 0x7F);
+    scheduleShortMsg(MIDI_NOTE_ON, 0x12, 0x7F);
+    // Replaces the first message but keeps its position
+    scheduleShortMsg(MIDI_NOTE_ON, 0x10, 0x7F);
+    testing::Mock::VerifyAndClearExpectations(m_pController.data());
+
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(*m_pController, sendShortMsg(MIDI_NOTE_ON, 0x10, 0x7F));
+        EXPECT_CALL(*m_pController, sendShortMsg(MIDI_NOTE_ON, 0x11, 0x7F));
+    }
+    waitForOutputFrame();
+    testing::Mock::VerifyAndClearExpectations(m_pController.data());
+
+    // The third message is deferred to the next frame
+    EXPECT_CALL(*m_pController, sendShortMsg(MIDI_NOTE_ON, 0x12, 0x7F));
+    waitForOutputFrame();
+    testing::Mock::VerifyAndClearExpectations(m_pController.data());
+
+    // The timer is stopped while no messages are pending
+    EXPECT_CALL(*m_pController, sendShortMsg(testing::_, testing::_, testing::_))
+            .Times(0);
+    waitForOutputFrame();
+    testing::Mock::VerifyAndClearExpectations(m_pController.data());
+
+    setOutputScheduling(0, 0);
+}
+
+TEST_F(MidiControllerTest, ScheduledOutput_SentWhenEngineStops) {
+    startEngine();
+    setOutputScheduling(kOutputFrameMillis, 1);
+    scheduleShortMsg(MIDI_NOTE_ON, 0x10, 0x7F);
+    scheduleShortMsg(MIDI_NOTE_ON, 0x11, 0x7F);
+
+    // All pending messages are sent before the device is closed, regardless
+    // of the rate limit
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(*m_pController, sendShortMsg(MIDI_NOTE_ON, 0x10, 0x7F));
+        EXPECT_CALL(*m_pController, sendShortMsg(MIDI_NOTE_ON, 0x11, 0x7F));
+    }
+    stopEngine();
+    testing::Mock::VerifyAndClearExpectations(m_pController.data());
+
+    // Output scheduling is disabled again
+    EXPECT_CALL(*m_pController, sendShortMsg(MIDI_NOTE_ON, 0x12, 0x7F));
+    scheduleShortMsg(MIDI_NOTE_ON, 0x12, 0x7F);
+}
@@ -90,6 +90,10 @@ class PortMidiControllerTest : public MixxxTest {
         m_pController->poll();
     }
 
+    bool isPolling() const {
+        return m_pController->isPolling();
+    }
+
     PmDeviceInfo m_inputDeviceInfo;
     PmDeviceInfo m_outputDeviceInfo;
     MockPortMidiDevice* m_mockInput;
@@ -114,6 +118,14 @@ MATCHER_P(ByteArrayEquals, value,
     return true;
 }
 
+TEST_F(PortMidiControllerTest, PollOnlyOpenInput) {
+    EXPECT_CALL(*m_mockInput, isOpen())
+            .WillOnce(Return(false))
+            .WillOnce(Return(true));
+    EXPECT_FALSE(isPolling());
+    EXPECT_TRUE(isPolling());
+}
+
 TEST_F(PortMidiControllerTest, OpenClose) {
     Sequence input;
     ON_CALL(*m_mockInput, isOpen())
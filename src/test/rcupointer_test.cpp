@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "util/rcupointer.h"
+
+namespace {
+
+class RcuPointerTest : public testing::Test {
+  protected:
+    struct Value {
+        explicit Value(int value)
+                : value(value),
+                  check(-value) {
+        }
+        int value;
+        int check;
+    };
+};
+
+TEST_F(RcuPointerTest, ReclaimRetiredSnapshots) {
+    RcuPointer<Value> pointer(std::make_unique<const Value>(1));
+    EXPECT_EQ(1, pointer.read()->value);
+
+    // No reader is active
+    pointer.publish(std::make_unique<const Value>(2));
+    EXPECT_EQ(0, pointer.retiredCount());
+
+    {
+        const auto pValue = pointer.read();
+        pointer.publish(std::make_unique<const Value>(3));
+        // The reader still sees its snapshot
+        EXPECT_EQ(2, pValue->value);
+        EXPECT_EQ(1, pointer.retiredCount());
+        EXPECT_EQ(3, pointer.read()->value);
+    }
+
+    pointer.publish(std::make_unique<const Value>(4));
+    EXPECT_EQ(0, pointer.retiredCount());
+    EXPECT_EQ(4, pointer.read()->value);
+}
+
+TEST_F(RcuPointerTest, ConcurrentReaders) {
+    RcuPointer<Value> pointer(std::make_unique<const Value>(0));
+    std::atomic<bool> stop(false);
+    std::atomic<int> errors(0);
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 2; ++i) {
+        readers.emplace_back([&pointer, &stop, &errors] {
+            int lastValue = 0;
+            while (!stop.load()) {
+                const auto pValue = pointer.read();
+                // Deleted snapshots would fail the check with high
+                // probability, in particular with sanitizers enabled.
+                if (pValue->check != -pValue->value ||
+                        pValue->value < lastValue) {
+                    ++errors;
+                }
+                lastValue = pValue->value;
+            }
+        });
+    }
+
+    for (int value = 1; value <= 100000; ++value) {
+        pointer.publish(std::make_unique<const Value>(value));
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(0, errors.load());
+    pointer.publish(std::make_unique<const Value>(0));
+    EXPECT_EQ(0, pointer.retiredCount());
+}
+
+} // anonymous namespace
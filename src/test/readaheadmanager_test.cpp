@@ -126,3 +126,29 @@ TEST_F(ReadAheadManagerTest, FractionalFrameLoop) {
     // The rounding error must not exceed a half frame (one samples in stereo)
     EXPECT_NEAR(16, m_pReadAheadManager->getPlaypos(), 1);
 }
+
+TEST_F(ReadAheadManagerTest, HintReaderCoversBothPlayDirections) {
+    const SINT kPositionFrame = 4 * CachingReaderChunk::kFrames;
+    m_pReadAheadManager->notifySeek(kPositionFrame * 2.0);
+
+    HintVector hints;
+    m_pReadAheadManager->hintReader(1.0, &hints);
+    ASSERT_EQ(2, hints.size());
+    // Ahead of the play position
+    EXPECT_EQ(kPositionFrame, hints[0].frame);
+    EXPECT_EQ(2 * CachingReaderChunk::kFrames, hints[0].frameCount);
+    EXPECT_EQ(1, hints[0].priority);
+    // Behind the play position
+    EXPECT_EQ(kPositionFrame - CachingReaderChunk::kFrames, hints[1].frame);
+    EXPECT_EQ(CachingReaderChunk::kFrames, hints[1].frameCount);
+    EXPECT_FALSE(hints[0].pinned);
+    EXPECT_FALSE(hints[1].pinned);
+
+    hints.clear();
+    m_pReadAheadManager->hintReader(-1.0, &hints);
+    ASSERT_EQ(2, hints.size());
+    EXPECT_EQ(kPositionFrame - 2 * CachingReaderChunk::kFrames, hints[0].frame);
+    EXPECT_EQ(2 * CachingReaderChunk::kFrames, hints[0].frameCount);
+    EXPECT_EQ(kPositionFrame, hints[1].frame);
+    EXPECT_EQ(CachingReaderChunk::kFrames, hints[1].frameCount);
+}
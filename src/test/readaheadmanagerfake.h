@@ -0,0 +1,34 @@
+#pragma once
+
+#include "engine/readaheadmanager.h"
+#include "util/math.h"
+
+// Provides an endless stereo sine wave without any disk access, e.g. for
+// testing and benchmarking the scalers of EngineBuffer.
+class ReadAheadManagerSineFake : public ReadAheadManager {
+  public:
+    ReadAheadManagerSineFake()
+            : m_frame(0),
+              m_samplesRead(0) {
+    }
+
+    SINT getNextSamples(double dRate, CSAMPLE* buffer, SINT requested_samples) override {
+        Q_UNUSED(dRate);
+        for (SINT i = 0; i < requested_samples; i += 2) {
+            const CSAMPLE value = static_cast<CSAMPLE>(
+                    sin(2 * M_PI * 440 * (m_frame++ % 44100) / 44100.0));
+            buffer[i] = value;
+            buffer[i + 1] = value;
+        }
+        m_samplesRead += requested_samples;
+        return requested_samples;
+    }
+
+    SINT samplesRead() const {
+        return m_samplesRead;
+    }
+
+  private:
+    SINT m_frame;
+    SINT m_samplesRead;
+};
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <QDir>
+#include <QTemporaryDir>
+
+#include "library/scanner/scannerjournal.h"
+
+namespace {
+
+class ScannerJournalTest : public testing::Test {
+  protected:
+    ScannerJournalTest()
+            : m_lastModified(QDateTime::fromMSecsSinceEpoch(1500000000000)) {
+    }
+
+    QString journalFilePath() const {
+        return QDir(m_tempDir.path()).filePath("libraryscanner.journal");
+    }
+
+    // Simulates a completed scan that lists all given directories
+    void scanDirectories(ScannerJournal* pJournal, const QStringList& dirPaths) {
+        pJournal->beginScan();
+        for (const auto& dirPath : dirPaths) {
+            pJournal->updateDirectory(dirPath, m_lastModified);
+        }
+        pJournal->finishScan(true);
+    }
+
+    QTemporaryDir m_tempDir;
+    const QDateTime m_lastModified;
+};
+
+TEST_F(ScannerJournalTest, UnchangedDirectories) {
+    ScannerJournal journal(journalFilePath());
+    scanDirectories(&journal, {"/music", "/music/a", "/music/b", "/music/a/c"});
+
+    journal.beginScan();
+    EXPECT_TRUE(journal.keepUnchangedDirectory("/music", m_lastModified));
+    EXPECT_FALSE(journal.keepUnchangedDirectory("/music/a", m_lastModified.addSecs(1)));
+    EXPECT_FALSE(journal.keepUnchangedDirectory("/music/d", m_lastModified));
+    EXPECT_FALSE(journal.keepUnchangedDirectory("/music/b", QDateTime()));
+
+    QStringList subdirs = journal.previousSubdirectories("/music");
+    subdirs.sort();
+    EXPECT_EQ(QStringList({"/music/a", "/music/b"}), subdirs);
+    EXPECT_EQ(QStringList({"/music/a/c"}), journal.previousSubdirectories("/music/a"));
+    EXPECT_TRUE(journal.previousSubdirectories("/music/b").isEmpty());
+}
+
+TEST_F(ScannerJournalTest, CompletedScanDiscardsMissingDirectories) {
+    ScannerJournal journal(journalFilePath());
+    scanDirectories(&journal, {"/music", "/music/a", "/music/b"});
+
+    journal.beginScan();
+    EXPECT_TRUE(journal.keepUnchangedDirectory("/music", m_lastModified));
+    journal.updateDirectory("/music/a", m_lastModified);
+    journal.finishScan(true);
+
+    QStringList directories = journal.directories();
+    directories.sort();
+    EXPECT_EQ(QStringList({"/music", "/music/a"}), directories);
+}
+
+TEST_F(ScannerJournalTest, IncompleteScanKeepsPreviousEntries) {
+    ScannerJournal journal(journalFilePath());
+    scanDirectories(&journal, {"/music", "/music/a"});
+
+    journal.beginScan();
+    journal.updateDirectory("/music", m_lastModified.addSecs(1));
+    journal.finishScan(false);
+
+    journal.beginScan();
+    EXPECT_TRUE(journal.keepUnchangedDirectory("/music", m_lastModified));
+    EXPECT_TRUE(journal.keepUnchangedDirectory("/music/a", m_lastModified));
+}
+
+TEST_F(ScannerJournalTest, InvalidatedDirectoryIsScannedAgain) {
+    ScannerJournal journal(journalFilePath());
+    scanDirectories(&journal, {"/music", "/music/a"});
+
+    journal.invalidateDirectory("/music/a");
+    journal.beginScan();
+    EXPECT_TRUE(journal.keepUnchangedDirectory("/music", m_lastModified));
+    // Still known as a sub-directory
+    EXPECT_EQ(QStringList({"/music/a"}), journal.previousSubdirectories("/music"));
+    EXPECT_FALSE(journal.keepUnchangedDirectory("/music/a", m_lastModified));
+}
+
+TEST_F(ScannerJournalTest, SaveAndLoad) {
+    ASSERT_TRUE(m_tempDir.isValid());
+    {
+        ScannerJournal journal(journalFilePath());
+        EXPECT_TRUE(journal.load()); // not existing
+        scanDirectories(&journal, {"/music", QString::fromUtf8("/music/Beyoncé")});
+        EXPECT_TRUE(journal.save());
+    }
+    ScannerJournal journal(journalFilePath());
+    ASSERT_TRUE(journal.load());
+    journal.beginScan();
+    EXPECT_TRUE(journal.keepUnchangedDirectory("/music", m_lastModified));
+    EXPECT_TRUE(journal.keepUnchangedDirectory(
+            QString::fromUtf8("/music/Beyoncé"), m_lastModified));
+}
+
+} // anonymous namespace
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+#include <cmath>
+#include <vector>
+
+#include "encoder/encodervorbissettings.h"
+#include "encoder/sharedencoder.h"
+#include "test/mixxxtest.h"
+
+namespace {
+
+class ByteSink : public EncoderCallback {
+  public:
+    void write(const unsigned char* header,
+            const unsigned char* body,
+            int headerLen,
+            int bodyLen) override {
+        data.append(reinterpret_cast<const char*>(header), headerLen);
+        data.append(reinterpret_cast<const char*>(body), bodyLen);
+    }
+    int tell() override {
+        return -1;
+    }
+    void seek(int pos) override {
+        Q_UNUSED(pos);
+    }
+    int filelen() override {
+        return 0;
+    }
+
+    QByteArray data;
+};
+
+class SharedEncoderTest : public MixxxTest {
+  protected:
+    SharedEncoderTest()
+            : m_pSettings(std::make_shared<EncoderVorbisSettings>(config())),
+              m_buffer(2 * 8192) {
+        for (size_t i = 0; i < m_buffer.size(); i += 2) {
+            m_buffer[i] = static_cast<CSAMPLE>(0.5 * std::sin(i * 0.01));
+            m_buffer[i + 1] = m_buffer[i];
+        }
+    }
+
+    void process(SharedEncoderSubscription* pSubscription, int count) {
+        for (int i = 0; i < count; ++i) {
+            pSubscription->process(m_buffer.data(), static_cast<int>(m_buffer.size()));
+        }
+    }
+
+    static constexpr int kSampleRate = 44100;
+    EncoderSettingsPointer m_pSettings;
+    std::vector<CSAMPLE> m_buffer;
+};
+
+TEST_F(SharedEncoderTest, InactiveSubscription) {
+    ByteSink sink;
+    SharedEncoderSubscriptionPointer pSubscription =
+            SharedEncoder::subscribe(m_pSettings, kSampleRate, &sink);
+    ASSERT_TRUE(pSubscription);
+    process(pSubscription.get(), 10);
+    EXPECT_TRUE(sink.data.isEmpty());
+
+    pSubscription->setActive(true);
+    process(pSubscription.get(), 10);
+    EXPECT_TRUE(sink.data.startsWith("OggS"));
+}
+
+TEST_F(SharedEncoderTest, JoinExistingEncoderOnly) {
+    ByteSink sink;
+    EXPECT_FALSE(SharedEncoder::join(*m_pSettings, kSampleRate, &sink));
+
+    ByteSink broadcastSink;
+    SharedEncoderSubscriptionPointer pBroadcast =
+            SharedEncoder::subscribe(m_pSettings, kSampleRate, &broadcastSink);
+    ASSERT_TRUE(pBroadcast);
+    EXPECT_TRUE(SharedEncoder::join(*m_pSettings, kSampleRate, &sink));
+    EXPECT_FALSE(SharedEncoder::join(*m_pSettings, 48000, &sink));
+}
+
+TEST_F(SharedEncoderTest, JoinInactiveUntilActivated) {
+    ByteSink broadcastSink;
+    SharedEncoderSubscriptionPointer pBroadcast =
+            SharedEncoder::subscribe(m_pSettings, kSampleRate, &broadcastSink);
+    ASSERT_TRUE(pBroadcast);
+
+    ByteSink recordingSink;
+    SharedEncoderSubscriptionPointer pRecording =
+            SharedEncoder::join(*m_pSettings, kSampleRate, &recordingSink);
+    ASSERT_TRUE(pRecording);
+    process(pRecording.get(), 10);
+    EXPECT_TRUE(recordingSink.data.isEmpty());
+
+    // The recording drives the encoder although it joined last
+    pRecording->setActive(true);
+    process(pRecording.get(), 10);
+    EXPECT_TRUE(recordingSink.data.startsWith("OggS"));
+}
+
+TEST_F(SharedEncoderTest, FanOut) {
+    ByteSink firstSink;
+    SharedEncoderSubscriptionPointer pFirst =
+            SharedEncoder::subscribe(m_pSettings, kSampleRate, &firstSink);
+    ASSERT_TRUE(pFirst);
+    pFirst->setActive(true);
+    process(pFirst.get(), 10);
+    ASSERT_FALSE(firstSink.data.isEmpty());
+
+    ByteSink secondSink;
+    SharedEncoderSubscriptionPointer pSecond =
+            SharedEncoder::subscribe(m_pSettings, kSampleRate, &secondSink);
+    ASSERT_TRUE(pSecond);
+    pSecond->setActive(true);
+    // Only the first subscription drives the encoder, so this only passes
+    // the replayed stream header to the second sink
+    process(pSecond.get(), 10);
+    const QByteArray streamHeader = secondSink.data;
+    ASSERT_FALSE(streamHeader.isEmpty());
+    EXPECT_TRUE(firstSink.data.startsWith(streamHeader));
+
+    const int firstSize = firstSink.data.size();
+    process(pFirst.get(), 10);
+    pSecond->process(nullptr, 0);
+    EXPECT_LT(firstSize, firstSink.data.size());
+    EXPECT_EQ(firstSink.data.mid(firstSize), secondSink.data.mid(streamHeader.size()));
+    EXPECT_EQ(0, pFirst->takeOverflowCount());
+    EXPECT_EQ(0, pSecond->takeOverflowCount());
+
+    // The second subscription takes over
+    pFirst.reset();
+    const int secondSize = secondSink.data.size();
+    process(pSecond.get(), 10);
+    EXPECT_LT(secondSize, secondSink.data.size());
+}
+
+} // anonymous namespace
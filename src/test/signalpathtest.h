@@ -54,7 +54,11 @@ class TestEngineMaster : public EngineMaster {
 
 class BaseSignalPathTest : public MixxxTest {
   protected:
-    BaseSignalPathTest() {
+    // channelWorkerThreads > 0 lets the engine process independent channels
+    // concurrently (see EngineMaster).
+    explicit BaseSignalPathTest(int channelWorkerThreads = 0) {
+        m_pConfig->setValue(ConfigKey("[Master]", "channel_worker_threads"),
+                channelWorkerThreads);
         m_pGuiTick = std::make_unique<GuiTick>();
         m_pChannelHandleFactory = new ChannelHandleFactory();
         m_pNumDecks = new ControlObject(ConfigKey("[Master]", "num_decks"));
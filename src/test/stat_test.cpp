@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <QTemporaryDir>
+#include <algorithm>
+#include <vector>
+
+#include "util/stat.h"
+#include "util/stattimeline.h"
+#include "util/streamingquantile.h"
+
+namespace {
+
+TEST(StreamingQuantileTest, ExactForFewValues) {
+    StreamingQuantile median(0.5);
+    EXPECT_EQ(0.0, median.value());
+    median.add(3.0);
+    median.add(1.0);
+    median.add(2.0);
+    EXPECT_EQ(3, median.count());
+    EXPECT_EQ(2.0, median.value());
+
+    median.clear();
+    EXPECT_EQ(0, median.count());
+}
+
+TEST(StreamingQuantileTest, Estimate) {
+    StreamingQuantile median(0.5);
+    StreamingQuantile percentile90(0.9);
+    StreamingQuantile percentile99(0.99);
+    std::vector<double> values;
+    unsigned int random = 12345;
+    for (int i = 0; i < 10000; ++i) {
+        random = random * 1103515245 + 12345;
+        const double value = (random >> 16) % 1000;
+        values.push_back(value);
+        median.add(value);
+        percentile90.add(value);
+        percentile99.add(value);
+    }
+    std::sort(values.begin(), values.end());
+    EXPECT_NEAR(values[5000], median.value(), 20.0);
+    EXPECT_NEAR(values[9000], percentile90.value(), 20.0);
+    EXPECT_NEAR(values[9900], percentile99.value(), 20.0);
+}
+
+TEST(StatTest, HistogramBuckets) {
+    EXPECT_EQ(0, Stat::histogramBucket(-1.0));
+    EXPECT_EQ(0, Stat::histogramBucket(0.5));
+    EXPECT_EQ(1, Stat::histogramBucket(1.0));
+    EXPECT_EQ(2, Stat::histogramBucket(2.0));
+    EXPECT_EQ(2, Stat::histogramBucket(3.9));
+    EXPECT_EQ(11, Stat::histogramBucket(1024.0));
+    EXPECT_EQ(Stat::kHistogramBuckets - 1, Stat::histogramBucket(1e300));
+    EXPECT_EQ(1024.0, Stat::histogramBucketMin(11));
+
+    Stat stat;
+    stat.m_compute = Stat::HISTOGRAM | Stat::SAMPLE_MEDIAN;
+    StatReport report = {};
+    for (double value : {1.0, 3.0, 3.5, 1000.0}) {
+        report.value = value;
+        stat.processReport(report);
+    }
+    EXPECT_EQ(1.0, stat.m_histogram[1]);
+    EXPECT_EQ(2.0, stat.m_histogram[2]);
+    EXPECT_EQ(1.0, stat.m_histogram[10]);
+    EXPECT_EQ(3.5, stat.m_median.value());
+}
+
+TEST(StatTest, RegisterTags) {
+    const int id = Stat::registerTag(QStringLiteral("StatTest tag"));
+    EXPECT_NE(Stat::kInvalidTagId, id);
+    EXPECT_EQ(id, Stat::registerTag(QStringLiteral("StatTest tag")));
+    EXPECT_EQ(QStringLiteral("StatTest tag"), Stat::tagName(id));
+
+    // Formatted tags share the id of the same plain tag
+    EXPECT_EQ(id, Stat::registerTag("StatTest %1", QStringLiteral("tag")));
+    EXPECT_EQ(id, Stat::registerTag("StatTest %1", QStringLiteral("tag")));
+    const int numberId = Stat::registerTag("StatTest %1", 7);
+    EXPECT_EQ(QStringLiteral("StatTest 7"), Stat::tagName(numberId));
+
+    const int suffixId = Stat::registerTag(id, "_duration");
+    EXPECT_EQ(QStringLiteral("StatTest tag_duration"), Stat::tagName(suffixId));
+    EXPECT_EQ(suffixId, Stat::registerTag(id, "_duration"));
+
+    EXPECT_TRUE(Stat::tagName(Stat::tagCount()).isEmpty());
+}
+
+TEST(StatTest, TimelineRoundTrip) {
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString fileName = dir.filePath("timeline.bin");
+    const int startId = Stat::registerTag(QStringLiteral("StatTest start"));
+    const int eventId = Stat::registerTag(QStringLiteral("StatTest event"));
+
+    StatTimelineWriter writer;
+    ASSERT_TRUE(writer.open(fileName));
+    writer.writeEvent({100, startId, Stat::EVENT_START});
+    writer.writeEvent({50, eventId, Stat::EVENT});
+    writer.writeEvent({200, startId, Stat::EVENT_END});
+    writer.close();
+
+    StatTimelineReader reader;
+    ASSERT_TRUE(reader.open(fileName));
+    StatTimeline::Event event;
+    ASSERT_TRUE(reader.readEvent(&event));
+    EXPECT_EQ(100, event.timeNanos);
+    EXPECT_EQ(startId, event.tagId);
+    EXPECT_EQ(Stat::EVENT_START, event.type);
+    EXPECT_EQ(QStringLiteral("StatTest start"), reader.tagName(startId));
+    ASSERT_TRUE(reader.readEvent(&event));
+    EXPECT_EQ(eventId, event.tagId);
+    EXPECT_EQ(QStringLiteral("StatTest event"), reader.tagName(eventId));
+    ASSERT_TRUE(reader.readEvent(&event));
+    EXPECT_EQ(200, event.timeNanos);
+    EXPECT_EQ(Stat::EVENT_END, event.type);
+    EXPECT_FALSE(reader.readEvent(&event));
+    EXPECT_FALSE(reader.hasError());
+}
+
+} // anonymous namespace
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include "library/trackcolumnstore.h"
+
+namespace {
+
+constexpr int kArtistColumn = 0;
+constexpr int kTitleColumn = 1;
+constexpr int kBpmColumn = 2;
+
+class TrackColumnStoreTest : public testing::Test {
+  protected:
+    TrackColumnStoreTest()
+            : m_store(3) {
+        m_store.setSearchColumns({kArtistColumn, kTitleColumn});
+    }
+
+    int updateTrack(int id, const QString& artist, const QString& title, double bpm) {
+        return m_store.updateRow(TrackId(QVariant(id)),
+                {QVariant(artist), QVariant(title), QVariant(bpm)});
+    }
+
+    TrackColumnStore m_store;
+};
+
+TEST_F(TrackColumnStoreTest, UpdateAndRemoveRows) {
+    const int row1 = updateTrack(1, "Artist", "Title 1", 120.0);
+    const int row2 = updateTrack(2, "Artist", "Title 2", 125.0);
+    EXPECT_NE(row1, row2);
+    EXPECT_EQ(2, m_store.rowCount());
+    EXPECT_EQ(row2, m_store.row(TrackId(QVariant(2))));
+    EXPECT_EQ(TrackId(QVariant(1)), m_store.trackId(row1));
+    EXPECT_EQ(QVariant(125.0), m_store.value(row2, kBpmColumn));
+
+    // Updating an existing track doesn't allocate a new row
+    EXPECT_EQ(row1, updateTrack(1, "Artist", "Title 1", 121.0));
+    EXPECT_EQ(QVariant(121.0), m_store.value(row1, kBpmColumn));
+
+    EXPECT_TRUE(m_store.removeRow(TrackId(QVariant(1))));
+    EXPECT_FALSE(m_store.removeRow(TrackId(QVariant(1))));
+    EXPECT_FALSE(m_store.contains(TrackId(QVariant(1))));
+    EXPECT_FALSE(m_store.trackId(row1).isValid());
+
+    // Unused rows are recycled
+    EXPECT_EQ(row1, updateTrack(3, "Artist", "Title 3", 130.0));
+    EXPECT_EQ(2, m_store.rowCount());
+}
+
+TEST_F(TrackColumnStoreTest, InternStrings) {
+    updateTrack(1, "Artist", "Title 1", 120.0);
+    updateTrack(2, "Artist", "Title 2", 125.0);
+    updateTrack(3, "Artist", "Title 1", 130.0);
+    // "Artist", "Title 1", "Title 2"
+    EXPECT_EQ(3, m_store.internedStringCount());
+}
+
+TEST_F(TrackColumnStoreTest, SearchText) {
+    const int row = updateTrack(1, QString::fromUtf8("Björk"), "Hyperballad", 120.0);
+    const QString& searchText = m_store.searchText(row);
+    EXPECT_TRUE(searchText.contains("bjork"));
+    EXPECT_TRUE(searchText.contains("hyperballad"));
+    // Values of different columns are separated
+    EXPECT_FALSE(searchText.contains("bjorkhyper"));
+    EXPECT_FALSE(searchText.contains("120"));
+
+    m_store.setSearchColumns({kTitleColumn});
+    EXPECT_FALSE(m_store.searchText(row).contains("bjork"));
+}
+
+TEST_F(TrackColumnStoreTest, InvalidateSortRanks) {
+    updateTrack(1, "Artist 1", "Title", 120.0);
+    const int row = updateTrack(2, "Artist 2", "Title", 125.0);
+    m_store.setSortRanks(kArtistColumn, {0, 1});
+    m_store.setSortRanks(kBpmColumn, {0, 1});
+
+    // Only the ranks of the modified column become invalid
+    updateTrack(2, "Artist 2", "Title", 110.0);
+    EXPECT_NE(nullptr, m_store.sortRanks(kArtistColumn));
+    EXPECT_EQ(nullptr, m_store.sortRanks(kBpmColumn));
+
+    // Removing a row keeps the order of the remaining rows
+    m_store.removeRow(m_store.trackId(row));
+    EXPECT_NE(nullptr, m_store.sortRanks(kArtistColumn));
+
+    // New rows invalidate all ranks
+    updateTrack(3, "Artist 3", "Title", 120.0);
+    EXPECT_EQ(nullptr, m_store.sortRanks(kArtistColumn));
+}
+
+} // anonymous namespace
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include "library/tracktrigramindex.h"
+
+namespace {
+
+class TrackTrigramIndexTest : public testing::Test {
+  protected:
+    QVector<int> findCandidates(const QString& term) const {
+        QVector<int> rows;
+        EXPECT_TRUE(m_index.findCandidates(term, &rows));
+        return rows;
+    }
+
+    TrackTrigramIndex m_index;
+};
+
+TEST_F(TrackTrigramIndexTest, FindCandidates) {
+    m_index.insert(0, "daft punk\naround the world");
+    m_index.insert(1, "the chemical brothers\nhey boy hey girl");
+    m_index.insert(2, "daft punk\none more time");
+
+    EXPECT_EQ(QVector<int>({0, 2}), findCandidates("punk"));
+    EXPECT_EQ(QVector<int>({0, 1}), findCandidates("the"));
+    EXPECT_EQ(QVector<int>({2}), findCandidates("more time"));
+    EXPECT_TRUE(findCandidates("aphex").isEmpty());
+
+    // Candidates contain all trigrams, but not necessarily the whole term
+    m_index.insert(3, "abcd bcde");
+    EXPECT_EQ(QVector<int>({3}), findCandidates("abcde"));
+
+    // Too short
+    QVector<int> rows;
+    EXPECT_FALSE(m_index.findCandidates("da", &rows));
+}
+
+TEST_F(TrackTrigramIndexTest, UpdateRows) {
+    // Rows are not inserted in ascending order
+    m_index.insert(3, "orbital\nbelfast");
+    m_index.insert(1, "orbital\nhalcyon");
+    EXPECT_EQ(QVector<int>({1, 3}), findCandidates("orbital"));
+
+    m_index.remove(1, "orbital\nhalcyon");
+    EXPECT_EQ(QVector<int>({3}), findCandidates("orbital"));
+    EXPECT_TRUE(findCandidates("halcyon").isEmpty());
+
+    m_index.insert(2, "orbital\nchime");
+    EXPECT_EQ(QVector<int>({2, 3}), findCandidates("orbital"));
+
+    m_index.clear();
+    EXPECT_EQ(0, m_index.trigramCount());
+}
+
+} // anonymous namespace
@@ -0,0 +1,140 @@
+#ifdef __VINYLCONTROL__
+
+#include <benchmark/benchmark.h>
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <QtDebug>
+#include <cmath>
+#include <vector>
+
+#include "util/assert.h"
+#include "util/math.h"
+#include "vinylcontrol/vinylcontrolxwax.h"
+
+// Benchmarks of the xwax timecoder that decodes the timecode of each vinyl
+// control deck. Run with
+// `mixxx-test --benchmark --benchmark_filter=BM_VinylControlXwax`.
+// The benchmark argument is the sample rate. Each benchmark thread decodes
+// its own deck, like the VinylControlDecoder threads do, so the runs with
+// several threads show how well the decks scale across cores.
+//
+// The timecode is rendered from the xwax timecode definition instead of
+// being read from a recording, so it is free of noise and wow. The decoder
+// still locks on to it and takes the same code paths as with a record that
+// is played forwards at normal speed.
+
+namespace {
+
+constexpr int kChannels = TIMECODER_CHANNELS;
+constexpr int kBufferFrames = 1024;
+constexpr int kTimecodeSeconds = 4;
+
+// Guards the lookup tables of the timecode definitions, which are built on
+// first use and shared by all timecoders
+QMutex s_timecoderInitMutex;
+
+bits_t lfsr(bits_t code, bits_t taps) {
+    bits_t taken = code & taps;
+    bits_t xrs = 0;
+    while (taken != 0) {
+        xrs += taken & 0x1;
+        taken >>= 1;
+    }
+    return xrs & 0x1;
+}
+
+// Renders the bitstream of the timecode from its start as an amplitude
+// modulated carrier with a second carrier in quadrature, see timecoder.c
+std::vector<signed short> renderTimecode(const timecode_def& def, int sampleRate) {
+    const bool leftPrimary = def.flags & 0x2; // SWITCH_PRIMARY
+    const double secondaryPhase = (def.flags & 0x1) ? 0.5 * M_PI : -0.5 * M_PI; // SWITCH_PHASE
+    const int frames = kTimecodeSeconds * sampleRate;
+    std::vector<signed short> pcm(frames * kChannels);
+
+    bits_t code = def.seed;
+    int cycle = -1;
+    double amplitude = 0.0;
+    for (int frame = 0; frame < frames; ++frame) {
+        const double phase = 2 * M_PI * def.resolution * frame / sampleRate;
+        const int currentCycle = static_cast<int>(phase / (2 * M_PI));
+        if (currentCycle != cycle) {
+            // The next bit of the LFSR enters at the most significant bit
+            cycle = currentCycle;
+            code = (code >> 1) | (lfsr(code, def.taps | 0x1) << (def.bits - 1));
+            const bool bit = (code >> (def.bits - 1)) & 0x1;
+            amplitude = bit ? 0.8 : 0.5;
+        }
+        const double primary = amplitude * sin(phase);
+        const double secondary = 0.8 * sin(phase + secondaryPhase);
+        pcm[frame * kChannels + (leftPrimary ? 0 : 1)] =
+                static_cast<signed short>(primary * SAMPLE_MAX);
+        pcm[frame * kChannels + (leftPrimary ? 1 : 0)] =
+                static_cast<signed short>(secondary * SAMPLE_MAX);
+    }
+    return pcm;
+}
+
+void runTimecoderBenchmark(benchmark::State& state, const char* timecodeName) {
+    const int sampleRate = state.range_x();
+
+    timecoder timecoder;
+    timecode_def* pDef;
+    {
+        QMutexLocker locker(&s_timecoderInitMutex);
+        pDef = timecoder_find_definition(timecodeName);
+        if (pDef) {
+            timecoder_init(&timecoder, pDef, 1.0, sampleRate, /* phono */ false);
+        }
+    }
+    VERIFY_OR_DEBUG_ASSERT(pDef) {
+        // This version of the benchmark library can neither skip a
+        // benchmark nor return before KeepRunning() has returned false.
+        state.SetLabel("unknown timecode");
+        while (state.KeepRunning()) {
+        }
+        return;
+    }
+    std::vector<signed short> pcm = renderTimecode(*pDef, sampleRate);
+    const int pcmFrames = static_cast<int>(pcm.size()) / kChannels;
+
+    // Let the decoder lock on to the timecode before measuring
+    timecoder_submit(&timecoder, pcm.data(), pcmFrames);
+    if (timecoder_get_position(&timecoder, nullptr) == -1) {
+        qWarning() << "BM_VinylControlXwax: The timecoder did not decode" << timecodeName;
+    }
+
+    int frame = 0;
+    while (state.KeepRunning()) {
+        if (frame + kBufferFrames > pcmFrames) {
+            // Keeps the pitch but breaks the timecode until it has locked on
+            // again, like a needle drop.
+            frame = 0;
+        }
+        timecoder_submit(&timecoder, pcm.data() + frame * kChannels, kBufferFrames);
+        benchmark::DoNotOptimize(timecoder_get_pitch(&timecoder));
+        frame += kBufferFrames;
+    }
+    // Report stereo frames decoded per second of wall time.
+    state.SetItemsProcessed(static_cast<size_t>(state.iterations()) * kBufferFrames);
+
+    timecoder_clear(&timecoder);
+}
+
+void timecoderBenchmarkArgs(benchmark::internal::Benchmark* pBenchmark) {
+    pBenchmark->Arg(44100)->Arg(96000)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
+}
+
+void BM_VinylControlXwax_Serato(benchmark::State& state) {
+    runTimecoderBenchmark(state, "serato_2a");
+}
+BENCHMARK(BM_VinylControlXwax_Serato)->Apply(timecoderBenchmarkArgs);
+
+void BM_VinylControlXwax_Traktor(benchmark::State& state) {
+    runTimecoderBenchmark(state, "traktor_a");
+}
+BENCHMARK(BM_VinylControlXwax_Traktor)->Apply(timecoderBenchmarkArgs);
+
+} // anonymous namespace
+
+#endif // __VINYLCONTROL__
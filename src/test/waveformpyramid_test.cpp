@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "waveform/waveformpyramid.h"
+
+namespace {
+
+WaveformData makeData(unsigned char low, unsigned char mid,
+        unsigned char high, unsigned char all) {
+    WaveformData data;
+    data.filtered.low = low;
+    data.filtered.mid = mid;
+    data.filtered.high = high;
+    data.filtered.all = all;
+    return data;
+}
+
+TEST(WaveformPyramidTest, Levels) {
+    // 1000 frames
+    std::vector<WaveformData> data(2000, makeData(0, 0, 0, 0));
+    // A single peak in the left channel of frame 500
+    data[1000] = makeData(10, 20, 30, 40);
+    // and in the right channel of frame 999
+    data[1999] = makeData(50, 60, 70, 80);
+
+    const WaveformPyramid pyramid(data.data(), static_cast<int>(data.size()));
+    // 500, 250, 125 frames
+    ASSERT_EQ(3, pyramid.levelCount());
+    EXPECT_EQ(1000, pyramid.levelDataSize(0));
+    EXPECT_EQ(250, pyramid.levelDataSize(2));
+
+    for (int level = 0; level < pyramid.levelCount(); ++level) {
+        const WaveformData* levelData = pyramid.levelData(level);
+        const int framesPerLevelFrame = WaveformPyramid::framesPerLevelFrame(level);
+        const int leftPeak = 2 * (500 / framesPerLevelFrame);
+        EXPECT_EQ(makeData(10, 20, 30, 40).m_i, levelData[leftPeak].m_i);
+        EXPECT_EQ(0, levelData[leftPeak + 1].m_i);
+        const int rightPeak = 2 * (999 / framesPerLevelFrame) + 1;
+        EXPECT_EQ(makeData(50, 60, 70, 80).m_i, levelData[rightPeak].m_i);
+        EXPECT_EQ(0, levelData[rightPeak - 1].m_i);
+    }
+}
+
+TEST(WaveformPyramidTest, FindLevel) {
+    std::vector<WaveformData> data(2000, makeData(0, 0, 0, 0));
+    const WaveformPyramid pyramid(data.data(), static_cast<int>(data.size()));
+    ASSERT_EQ(3, pyramid.levelCount());
+
+    EXPECT_EQ(-1, pyramid.findLevel(0.5));
+    EXPECT_EQ(-1, pyramid.findLevel(1.9));
+    EXPECT_EQ(0, pyramid.findLevel(2.0));
+    EXPECT_EQ(1, pyramid.findLevel(7.9));
+    EXPECT_EQ(2, pyramid.findLevel(1000.0));
+}
+
+TEST(WaveformPyramidTest, TooShort) {
+    std::vector<WaveformData> data(100, makeData(1, 2, 3, 4));
+    const WaveformPyramid pyramid(data.data(), static_cast<int>(data.size()));
+    EXPECT_EQ(0, pyramid.levelCount());
+    EXPECT_EQ(-1, pyramid.findLevel(100.0));
+}
+
+} // anonymous namespace
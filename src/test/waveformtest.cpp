@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <QtDebug>
+
+#include "proto/waveform.pb.h"
+#include "waveform/waveform.h"
+
+namespace {
+
+class WaveformTest : public testing::Test {
+  protected:
+    static void expectEqualData(const Waveform& expected, const Waveform& actual) {
+        ASSERT_EQ(expected.getDataSize(), actual.getDataSize());
+        EXPECT_DOUBLE_EQ(expected.getAudioVisualRatio(), actual.getAudioVisualRatio());
+        for (int i = 0; i < expected.getDataSize(); ++i) {
+            ASSERT_EQ(expected.get(i).m_i, actual.get(i).m_i) << "index " << i;
+        }
+    }
+};
+
+TEST_F(WaveformTest, FlatRoundTrip) {
+    // Spans multiple regions
+    Waveform waveform(44100, 44100 * 200, 441, -1);
+    ASSERT_GT(waveform.getDataSize(), 64 * 1024);
+    // The first region is incompressible and will be stored uncompressed
+    unsigned int random = 12345;
+    for (int i = 0; i < waveform.getDataSize(); ++i) {
+        WaveformData& datum = waveform.data()[i];
+        if (i < 64 * 1024) {
+            random = random * 1103515245 + 12345;
+            datum.m_i = static_cast<int>(random);
+        } else {
+            datum.filtered.low = i % 7;
+            datum.filtered.mid = i % 11;
+            datum.filtered.high = i % 13;
+            datum.filtered.all = i % 17;
+        }
+    }
+
+    const QByteArray data = waveform.toByteArray();
+    EXPECT_TRUE(Waveform::isFlatByteArray(data));
+    EXPECT_LT(data.size(), waveform.getDataSize() * static_cast<int>(sizeof(WaveformData)));
+
+    Waveform restored(data);
+    EXPECT_TRUE(restored.isValid());
+    EXPECT_EQ(Waveform::SaveState::Saved, restored.saveState());
+    EXPECT_EQ(restored.getDataSize(), restored.getCompletion());
+    expectEqualData(waveform, restored);
+}
+
+TEST_F(WaveformTest, ReadLegacyProtobuf) {
+    mixxx::track::io::Waveform proto;
+    proto.set_visual_sample_rate(441);
+    proto.set_audio_visual_ratio(100);
+    auto* pAll = proto.mutable_signal_all();
+    auto* pFiltered = proto.mutable_signal_filtered();
+    auto* pLow = pFiltered->mutable_low();
+    auto* pMid = pFiltered->mutable_mid();
+    auto* pHigh = pFiltered->mutable_high();
+    for (auto* pSignal : {pAll, pLow, pMid, pHigh}) {
+        pSignal->set_units(mixxx::track::io::Waveform::RMS);
+        pSignal->set_channels(2);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        pAll->add_value(i % 256);
+        pLow->add_value((i + 1) % 256);
+        pMid->add_value((i + 2) % 256);
+        pHigh->add_value((i + 3) % 256);
+    }
+    std::string serialized;
+    proto.SerializeToString(&serialized);
+    const QByteArray data(serialized.data(), static_cast<int>(serialized.size()));
+    EXPECT_FALSE(Waveform::isFlatByteArray(data));
+
+    Waveform waveform(data);
+    ASSERT_EQ(1000, waveform.getDataSize());
+    EXPECT_EQ(Waveform::SaveState::Saved, waveform.saveState());
+    EXPECT_EQ(999 % 256, waveform.getAll(999));
+    EXPECT_EQ(1, waveform.getLow(0));
+    EXPECT_EQ(2, waveform.getMid(0));
+    EXPECT_EQ(3, waveform.getHigh(0));
+
+    // Converted into the flat format when saved again
+    Waveform converted(waveform.toByteArray());
+    expectEqualData(waveform, converted);
+}
+
+TEST_F(WaveformTest, RejectTruncatedData) {
+    Waveform waveform(44100, 44100 * 10, 441, -1);
+    QByteArray data = waveform.toByteArray();
+    data.chop(1);
+    Waveform restored(data);
+    EXPECT_FALSE(restored.isValid());
+    EXPECT_EQ(Waveform::SaveState::NotSaved, restored.saveState());
+}
+
+} // anonymous namespace
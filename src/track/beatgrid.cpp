@@ -40,7 +40,7 @@ BeatGrid::BeatGrid(
         SINT iSampleRate)
         : m_mutex(QMutex::Recursive),
           m_iSampleRate(iSampleRate > 0 ? iSampleRate : track.getSampleRate()),
-          m_dBeatLength(0.0) {
+          m_snapshot(std::make_unique<const Snapshot>()) {
     // BeatGrid should live in the same thread as the track it is associated
     // with.
     moveToThread(track.thread());
@@ -58,8 +58,7 @@ BeatGrid::BeatGrid(const BeatGrid& other)
         : m_mutex(QMutex::Recursive),
           m_subVersion(other.m_subVersion),
           m_iSampleRate(other.m_iSampleRate),
-          m_grid(other.m_grid),
-          m_dBeatLength(other.m_dBeatLength) {
+          m_snapshot(std::make_unique<const Snapshot>(*other.m_snapshot.read())) {
     moveToThread(other.thread());
 }
 
@@ -69,20 +68,23 @@ void BeatGrid::setGrid(double dBpm, double dFirstBeatSample) {
     }
 
     QMutexLocker lock(&m_mutex);
-    m_grid.mutable_bpm()->set_bpm(dBpm);
-    m_grid.mutable_first_beat()->set_frame_position(dFirstBeatSample / kFrameSize);
+    auto pSnapshot = std::make_unique<Snapshot>(*m_snapshot.read());
+    pSnapshot->grid.mutable_bpm()->set_bpm(dBpm);
+    pSnapshot->grid.mutable_first_beat()->set_frame_position(dFirstBeatSample / kFrameSize);
     // Calculate beat length as sample offsets
-    m_dBeatLength = (60.0 * m_iSampleRate / dBpm) * kFrameSize;
+    pSnapshot->beatLength = (60.0 * m_iSampleRate / dBpm) * kFrameSize;
+    m_snapshot.publish(std::move(pSnapshot));
 }
 
 QByteArray BeatGrid::toByteArray() const {
-    QMutexLocker locker(&m_mutex);
+    const auto pSnapshot = m_snapshot.read();
     std::string output;
-    m_grid.SerializeToString(&output);
+    pSnapshot->grid.SerializeToString(&output);
     return QByteArray(output.data(), output.length());
 }
 
 BeatsPointer BeatGrid::clone() const {
+    // Lock to get a consistent sub-version
     QMutexLocker locker(&m_mutex);
     BeatsPointer other(new BeatGrid(*this));
     return other;
@@ -91,8 +93,11 @@ BeatsPointer BeatGrid::clone() const {
 void BeatGrid::readByteArray(const QByteArray& byteArray) {
     mixxx::track::io::BeatGrid grid;
     if (grid.ParseFromArray(byteArray.constData(), byteArray.length())) {
-        m_grid = grid;
-        m_dBeatLength = (60.0 * m_iSampleRate / bpm()) * kFrameSize;
+        QMutexLocker lock(&m_mutex);
+        auto pSnapshot = std::make_unique<Snapshot>();
+        pSnapshot->grid = grid;
+        pSnapshot->beatLength = (60.0 * m_iSampleRate / pSnapshot->bpm()) * kFrameSize;
+        m_snapshot.publish(std::move(pSnapshot));
         return;
     }
 
@@ -106,12 +111,12 @@ void BeatGrid::readByteArray(const QByteArray& byteArray) {
     setGrid(blob->bpm, blob->firstBeat * kFrameSize);
 }
 
-double BeatGrid::firstBeatSample() const {
-    return m_grid.first_beat().frame_position() * kFrameSize;
+double BeatGrid::Snapshot::firstBeatSample() const {
+    return grid.first_beat().frame_position() * kFrameSize;
 }
 
-double BeatGrid::bpm() const {
-    return m_grid.bpm().bpm();
+double BeatGrid::Snapshot::bpm() const {
+    return grid.bpm().bpm();
 }
 
 QString BeatGrid::getVersion() const {
@@ -129,8 +134,8 @@ void BeatGrid::setSubVersion(QString subVersion) {
 }
 
 // internal use only
-bool BeatGrid::isValid() const {
-    return m_iSampleRate > 0 && bpm() > 0;
+bool BeatGrid::isValid(const Snapshot& snapshot) const {
+    return m_iSampleRate > 0 && snapshot.bpm() > 0;
 }
 
 // This could be implemented in the Beats Class itself.
@@ -147,13 +152,13 @@ double BeatGrid::findPrevBeat(double dSamples) const {
 
 // This is an internal call. This could be implemented in the Beats Class itself.
 double BeatGrid::findClosestBeat(double dSamples) const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid()) {
+    const auto pSnapshot = m_snapshot.read();
+    if (!isValid(*pSnapshot)) {
         return -1;
     }
     double prevBeat;
     double nextBeat;
-    findPrevNextBeats(dSamples, &prevBeat, &nextBeat);
+    findPrevNextBeats(*pSnapshot, dSamples, &prevBeat, &nextBeat);
     if (prevBeat == -1) {
         // If both values are -1, we correctly return -1.
         return nextBeat;
@@ -164,12 +169,18 @@ double BeatGrid::findClosestBeat(double dSamples) const {
 }
 
 double BeatGrid::findNthBeat(double dSamples, int n) const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid() || n == 0) {
+    const auto pSnapshot = m_snapshot.read();
+    return findNthBeat(*pSnapshot, dSamples, n);
+}
+
+double BeatGrid::findNthBeat(const Snapshot& snapshot, double dSamples, int n) const {
+    if (!isValid(snapshot) || n == 0) {
         return -1;
     }
 
-    double beatFraction = (dSamples - firstBeatSample()) / m_dBeatLength;
+    const double dBeatLength = snapshot.beatLength;
+    const double dFirstBeatSample = snapshot.firstBeatSample();
+    double beatFraction = (dSamples - dFirstBeatSample) / dBeatLength;
     double prevBeat = floor(beatFraction);
     double nextBeat = ceil(beatFraction);
 
@@ -194,35 +205,38 @@ double BeatGrid::findNthBeat(double dSamples, int n) const {
     double dClosestBeat;
     if (n > 0) {
         // We're going forward, so use ceil to round up to the next multiple of
-        // m_dBeatLength
-        dClosestBeat = nextBeat * m_dBeatLength + firstBeatSample();
+        // the beat length
+        dClosestBeat = nextBeat * dBeatLength + dFirstBeatSample;
         n = n - 1;
     } else {
         // We're going backward, so use floor to round down to the next multiple
-        // of m_dBeatLength
-        dClosestBeat = prevBeat * m_dBeatLength + firstBeatSample();
+        // of the beat length
+        dClosestBeat = prevBeat * dBeatLength + dFirstBeatSample;
         n = n + 1;
     }
 
-    double dResult = dClosestBeat + n * m_dBeatLength;
+    double dResult = dClosestBeat + n * dBeatLength;
     return dResult;
 }
 
 bool BeatGrid::findPrevNextBeats(double dSamples,
                                  double* dpPrevBeatSamples,
                                  double* dpNextBeatSamples) const {
-    double dFirstBeatSample;
-    double dBeatLength;
-    {
-        QMutexLocker locker(&m_mutex);
-        if (!isValid()) {
-            *dpPrevBeatSamples = -1.0;
-            *dpNextBeatSamples = -1.0;
-            return false;
-        }
-        dFirstBeatSample = firstBeatSample();
-        dBeatLength = m_dBeatLength;
+    const auto pSnapshot = m_snapshot.read();
+    return findPrevNextBeats(*pSnapshot, dSamples, dpPrevBeatSamples, dpNextBeatSamples);
+}
+
+bool BeatGrid::findPrevNextBeats(const Snapshot& snapshot,
+                                 double dSamples,
+                                 double* dpPrevBeatSamples,
+                                 double* dpNextBeatSamples) const {
+    if (!isValid(snapshot)) {
+        *dpPrevBeatSamples = -1.0;
+        *dpNextBeatSamples = -1.0;
+        return false;
     }
+    const double dFirstBeatSample = snapshot.firstBeatSample();
+    const double dBeatLength = snapshot.beatLength;
 
     double beatFraction = (dSamples - dFirstBeatSample) / dBeatLength;
     double prevBeat = floor(beatFraction);
@@ -248,25 +262,25 @@ bool BeatGrid::findPrevNextBeats(double dSamples,
 
 
 std::unique_ptr<BeatIterator> BeatGrid::findBeats(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid() || startSample > stopSample) {
+    const auto pSnapshot = m_snapshot.read();
+    if (!isValid(*pSnapshot) || startSample > stopSample) {
         return std::unique_ptr<BeatIterator>();
     }
     //qDebug() << "BeatGrid::findBeats startSample" << startSample << "stopSample"
-    //         << stopSample << "beatlength" << m_dBeatLength << "BPM" << bpm();
-    double curBeat = findNextBeat(startSample);
+    //         << stopSample << "beatlength" << pSnapshot->beatLength << "BPM" << pSnapshot->bpm();
+    double curBeat = findNthBeat(*pSnapshot, startSample, +1);
     if (curBeat == -1.0) {
         return std::unique_ptr<BeatIterator>();
     }
-    return std::make_unique<BeatGridIterator>(m_dBeatLength, curBeat, stopSample);
+    return std::make_unique<BeatGridIterator>(pSnapshot->beatLength, curBeat, stopSample);
 }
 
 bool BeatGrid::hasBeatInRange(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid() || startSample > stopSample) {
+    const auto pSnapshot = m_snapshot.read();
+    if (!isValid(*pSnapshot) || startSample > stopSample) {
         return false;
     }
-    double curBeat = findNextBeat(startSample);
+    double curBeat = findNthBeat(*pSnapshot, startSample, +1);
     if (curBeat != -1.0 && curBeat <= stopSample) {
         return true;
     }
@@ -274,30 +288,30 @@ bool BeatGrid::hasBeatInRange(double startSample, double stopSample) const {
 }
 
 double BeatGrid::getBpm() const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid()) {
+    const auto pSnapshot = m_snapshot.read();
+    if (!isValid(*pSnapshot)) {
         return 0;
     }
-    return bpm();
+    return pSnapshot->bpm();
 }
 
 double BeatGrid::getBpmRange(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid() || startSample > stopSample) {
+    const auto pSnapshot = m_snapshot.read();
+    if (!isValid(*pSnapshot) || startSample > stopSample) {
         return -1;
     }
-    return bpm();
+    return pSnapshot->bpm();
 }
 
 double BeatGrid::getBpmAroundPosition(double curSample, int n) const {
     Q_UNUSED(curSample);
     Q_UNUSED(n);
 
-    QMutexLocker locker(&m_mutex);
-    if (!isValid()) {
+    const auto pSnapshot = m_snapshot.read();
+    if (!isValid(*pSnapshot)) {
         return -1;
     }
-    return bpm();
+    return pSnapshot->bpm();
 }
 
 void BeatGrid::addBeat(double dBeatSample) {
@@ -321,11 +335,13 @@ void BeatGrid::moveBeat(double dBeatSample, double dNewBeatSample) {
 
 void BeatGrid::translate(double dNumSamples) {
     QMutexLocker locker(&m_mutex);
-    if (!isValid()) {
+    auto pSnapshot = std::make_unique<Snapshot>(*m_snapshot.read());
+    if (!isValid(*pSnapshot)) {
         return;
     }
-    double newFirstBeatFrames = (firstBeatSample() + dNumSamples) / kFrameSize;
-    m_grid.mutable_first_beat()->set_frame_position(newFirstBeatFrames);
+    double newFirstBeatFrames = (pSnapshot->firstBeatSample() + dNumSamples) / kFrameSize;
+    pSnapshot->grid.mutable_first_beat()->set_frame_position(newFirstBeatFrames);
+    m_snapshot.publish(std::move(pSnapshot));
     locker.unlock();
     emit updated();
 }
@@ -364,8 +380,10 @@ void BeatGrid::setBpm(double dBpm) {
     if (dBpm > getMaxBpm()) {
         dBpm = getMaxBpm();
     }
-    m_grid.mutable_bpm()->set_bpm(dBpm);
-    m_dBeatLength = (60.0 * m_iSampleRate / dBpm) * kFrameSize;
+    auto pSnapshot = std::make_unique<Snapshot>(*m_snapshot.read());
+    pSnapshot->grid.mutable_bpm()->set_bpm(dBpm);
+    pSnapshot->beatLength = (60.0 * m_iSampleRate / dBpm) * kFrameSize;
+    m_snapshot.publish(std::move(pSnapshot));
     locker.unlock();
     emit updated();
 }
@@ -6,6 +6,7 @@
 #include "track/track.h"
 #include "track/beats.h"
 #include "proto/beats.pb.h"
+#include "util/rcupointer.h"
 
 #define BEAT_GRID_1_VERSION "BeatGrid-1.0"
 #define BEAT_GRID_2_VERSION "BeatGrid-2.0"
@@ -13,6 +14,10 @@
 // BeatGrid is an implementation of the Beats interface that implements an
 // infinite grid of beats, aligned to a song simply by a starting offset of the
 // first beat and the song's average beats-per-minute.
+//
+// The grid is never modified in place. Mutations publish a modified copy,
+// so that the engine thread can query the grid without ever waiting for a
+// lock that is held by the GUI.
 class BeatGrid final : public Beats {
   public:
     // Construct a BeatGrid. If a more accurate sample rate is known, provide it
@@ -72,23 +77,35 @@ class BeatGrid final : public Beats {
     void setBpm(double dBpm) override;
 
   private:
+    // Immutable once published
+    struct Snapshot {
+        // Data storage for BeatGrid
+        mixxx::track::io::BeatGrid grid;
+        // The length of a beat in samples
+        double beatLength = 0.0;
+
+        double firstBeatSample() const;
+        double bpm() const;
+    };
+
     BeatGrid(const BeatGrid& other);
-    double firstBeatSample() const;
-    double bpm() const;
 
     void readByteArray(const QByteArray& byteArray);
     // For internal use only.
-    bool isValid() const;
+    bool isValid(const Snapshot& snapshot) const;
+    double findNthBeat(const Snapshot& snapshot, double dSamples, int n) const;
+    bool findPrevNextBeats(const Snapshot& snapshot,
+                           double dSamples,
+                           double* dpPrevBeatSamples,
+                           double* dpNextBeatSamples) const;
 
+    // Serializes all mutations
     mutable QMutex m_mutex;
     // The sub-version of this beatgrid.
     QString m_subVersion;
     // The number of samples per second
     SINT m_iSampleRate;
-    // Data storage for BeatGrid
-    mixxx::track::io::BeatGrid m_grid;
-    // The length of a beat in samples
-    double m_dBeatLength;
+    RcuPointer<Snapshot> m_snapshot;
 };
 
 
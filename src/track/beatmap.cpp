@@ -32,9 +32,12 @@ bool BeatLessThan(const Beat& beat1, const Beat& beat2) {
 
 class BeatMapIterator : public BeatIterator {
   public:
-    BeatMapIterator(BeatList::const_iterator start, BeatList::const_iterator end)
-            : m_currentBeat(start),
-              m_endBeat(end) {
+    // Keeps a reference to the implicitly shared beat list, which is never
+    // modified after it has been published.
+    BeatMapIterator(const BeatList& beats, int start, int end)
+            : m_beats(beats),
+              m_currentBeat(m_beats.constBegin() + start),
+              m_endBeat(m_beats.constBegin() + end) {
         // Advance to the first enabled beat.
         while (m_currentBeat != m_endBeat && !m_currentBeat->enabled()) {
             ++m_currentBeat;
@@ -55,6 +58,7 @@ class BeatMapIterator : public BeatIterator {
     }
 
   private:
+    const BeatList m_beats;
     BeatList::const_iterator m_currentBeat;
     BeatList::const_iterator m_endBeat;
 };
@@ -62,8 +66,7 @@ class BeatMapIterator : public BeatIterator {
 BeatMap::BeatMap(const Track& track, SINT iSampleRate)
         : m_mutex(QMutex::Recursive),
           m_iSampleRate(iSampleRate > 0 ? iSampleRate : track.getSampleRate()),
-          m_dCachedBpm(0),
-          m_dLastFrame(0) {
+          m_snapshot(std::make_unique<const Snapshot>()) {
     // BeatMap should live in the same thread as the track it is associated
     // with.
     moveToThread(track.thread());
@@ -87,20 +90,19 @@ BeatMap::BeatMap (const BeatMap& other)
         : m_mutex(QMutex::Recursive),
           m_subVersion(other.m_subVersion),
           m_iSampleRate(other.m_iSampleRate),
-          m_dCachedBpm(other.m_dCachedBpm),
-          m_dLastFrame(other.m_dLastFrame),
-          m_beats(other.m_beats) {
+          m_snapshot(std::make_unique<const Snapshot>(*other.m_snapshot.read())) {
     moveToThread(other.thread());
 }
 
 QByteArray BeatMap::toByteArray() const {
-    QMutexLocker locker(&m_mutex);
+    const auto pSnapshot = m_snapshot.read();
+    const BeatList& beats = pSnapshot->beats;
     // No guarantees BeatLists are made of a data type which located adjacent
     // items in adjacent memory locations.
     mixxx::track::io::BeatMap map;
 
-    for (int i = 0; i < m_beats.size(); ++i) {
-        map.add_beat()->CopyFrom(m_beats[i]);
+    for (int i = 0; i < beats.size(); ++i) {
+        map.add_beat()->CopyFrom(beats[i]);
     }
 
     std::string output;
@@ -109,6 +111,7 @@ QByteArray BeatMap::toByteArray() const {
 }
 
 BeatsPointer BeatMap::clone() const {
+    // Lock to get a consistent sub-version
     QMutexLocker locker(&m_mutex);
     BeatsPointer other(new BeatMap(*this));
     return other;
@@ -121,11 +124,13 @@ bool BeatMap::readByteArray(const QByteArray& byteArray) {
                 << byteArray.size();
         return false;
     }
+    BeatList beats;
     for (int i = 0; i < map.beat_size(); ++i) {
         const Beat& beat = map.beat(i);
-        m_beats.append(beat);
+        beats.append(beat);
     }
-    onBeatlistChanged();
+    QMutexLocker locker(&m_mutex);
+    onBeatlistChanged(beats);
     return true;
 }
 
@@ -135,6 +140,7 @@ void BeatMap::createFromBeatVector(const QVector<double>& beats) {
     }
     double previous_beatpos = -1;
     Beat beat;
+    BeatList beatList;
 
     foreach (double beatpos, beats) {
         // beatpos is in frames. Do not accept fractional frames.
@@ -144,11 +150,12 @@ void BeatMap::createFromBeatVector(const QVector<double>& beats) {
             qDebug() << "discarding beat " << beatpos;
         } else {
             beat.set_frame_position(beatpos);
-            m_beats.append(beat);
+            beatList.append(beat);
             previous_beatpos = beatpos;
         }
     }
-    onBeatlistChanged();
+    QMutexLocker locker(&m_mutex);
+    onBeatlistChanged(beatList);
 }
 
 QString BeatMap::getVersion() const {
@@ -165,8 +172,8 @@ void BeatMap::setSubVersion(QString subVersion) {
     m_subVersion = subVersion;
 }
 
-bool BeatMap::isValid() const {
-    return m_iSampleRate > 0 && m_beats.size() > 0;
+bool BeatMap::isValid(const BeatList& beats) const {
+    return m_iSampleRate > 0 && beats.size() > 0;
 }
 
 double BeatMap::findNextBeat(double dSamples) const {
@@ -178,13 +185,14 @@ double BeatMap::findPrevBeat(double dSamples) const {
 }
 
 double BeatMap::findClosestBeat(double dSamples) const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid()) {
+    const auto pSnapshot = m_snapshot.read();
+    const BeatList& beats = pSnapshot->beats;
+    if (!isValid(beats)) {
         return -1;
     }
     double prevBeat;
     double nextBeat;
-    findPrevNextBeats(dSamples, &prevBeat, &nextBeat);
+    findPrevNextBeats(beats, dSamples, &prevBeat, &nextBeat);
     if (prevBeat == -1) {
         // If both values are -1, we correctly return -1.
         return nextBeat;
@@ -195,9 +203,12 @@ double BeatMap::findClosestBeat(double dSamples) const {
 }
 
 double BeatMap::findNthBeat(double dSamples, int n) const {
-    QMutexLocker locker(&m_mutex);
+    const auto pSnapshot = m_snapshot.read();
+    return findNthBeat(pSnapshot->beats, dSamples, n);
+}
 
-    if (!isValid() || n == 0) {
+double BeatMap::findNthBeat(const BeatList& beats, double dSamples, int n) const {
+    if (!isValid(beats) || n == 0) {
         return -1;
     }
 
@@ -207,22 +218,22 @@ double BeatMap::findNthBeat(double dSamples, int n) const {
 
     // it points at the first occurrence of beat or the next largest beat
     BeatList::const_iterator it =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(), beat, BeatLessThan);
+            std::lower_bound(beats.constBegin(), beats.constEnd(), beat, BeatLessThan);
 
     // If the position is within 1/10th of a second of the next or previous
     // beat, pretend we are on that beat.
     const double kFrameEpsilon = 0.1 * m_iSampleRate;
 
     // Back-up by one.
-    if (it != m_beats.begin()) {
+    if (it != beats.begin()) {
         --it;
     }
 
     // Scan forward to find whether we are on a beat.
-    BeatList::const_iterator on_beat = m_beats.constEnd();
-    BeatList::const_iterator previous_beat = m_beats.constEnd();
-    BeatList::const_iterator next_beat = m_beats.constEnd();
-    for (; it != m_beats.end(); ++it) {
+    BeatList::const_iterator on_beat = beats.constEnd();
+    BeatList::const_iterator previous_beat = beats.constEnd();
+    BeatList::const_iterator next_beat = beats.constEnd();
+    for (; it != beats.end(); ++it) {
         qint32 delta = it->frame_position() - beat.frame_position();
 
         // We are "on" this beat.
@@ -246,13 +257,13 @@ double BeatMap::findNthBeat(double dSamples, int n) const {
 
     // If we are within epsilon samples of a beat then the immediately next and
     // previous beats are the beat we are on.
-    if (on_beat != m_beats.end()) {
+    if (on_beat != beats.end()) {
         next_beat = on_beat;
         previous_beat = on_beat;
     }
 
     if (n > 0) {
-        for (; next_beat != m_beats.end(); ++next_beat) {
+        for (; next_beat != beats.end(); ++next_beat) {
             if (!next_beat->enabled()) {
                 continue;
             }
@@ -262,7 +273,7 @@ double BeatMap::findNthBeat(double dSamples, int n) const {
             }
             --n;
         }
-    } else if (n < 0 && previous_beat != m_beats.end()) {
+    } else if (n < 0 && previous_beat != beats.end()) {
         for (; true; --previous_beat) {
             if (previous_beat->enabled()) {
                 if (n == -1) {
@@ -273,7 +284,7 @@ double BeatMap::findNthBeat(double dSamples, int n) const {
             }
 
             // Don't step before the start of the list.
-            if (previous_beat == m_beats.begin()) {
+            if (previous_beat == beats.begin()) {
                 break;
             }
         }
@@ -284,9 +295,15 @@ double BeatMap::findNthBeat(double dSamples, int n) const {
 bool BeatMap::findPrevNextBeats(double dSamples,
                                 double* dpPrevBeatSamples,
                                 double* dpNextBeatSamples) const {
-    QMutexLocker locker(&m_mutex);
+    const auto pSnapshot = m_snapshot.read();
+    return findPrevNextBeats(pSnapshot->beats, dSamples, dpPrevBeatSamples, dpNextBeatSamples);
+}
 
-    if (!isValid()) {
+bool BeatMap::findPrevNextBeats(const BeatList& beats,
+                                double dSamples,
+                                double* dpPrevBeatSamples,
+                                double* dpNextBeatSamples) const {
+    if (!isValid(beats)) {
         *dpPrevBeatSamples = -1;
         *dpNextBeatSamples = -1;
         return false;
@@ -298,22 +315,22 @@ bool BeatMap::findPrevNextBeats(double dSamples,
 
     // it points at the first occurrence of beat or the next largest beat
     BeatList::const_iterator it =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(), beat, BeatLessThan);
+            std::lower_bound(beats.constBegin(), beats.constEnd(), beat, BeatLessThan);
 
     // If the position is within 1/10th of a second of the next or previous
     // beat, pretend we are on that beat.
     const double kFrameEpsilon = 0.1 * m_iSampleRate;
 
     // Back-up by one.
-    if (it != m_beats.begin()) {
+    if (it != beats.begin()) {
         --it;
     }
 
     // Scan forward to find whether we are on a beat.
-    BeatList::const_iterator on_beat = m_beats.constEnd();
-    BeatList::const_iterator previous_beat = m_beats.constEnd();
-    BeatList::const_iterator next_beat = m_beats.constEnd();
-    for (; it != m_beats.end(); ++it) {
+    BeatList::const_iterator on_beat = beats.constEnd();
+    BeatList::const_iterator previous_beat = beats.constEnd();
+    BeatList::const_iterator next_beat = beats.constEnd();
+    for (; it != beats.end(); ++it) {
         qint32 delta = it->frame_position() - beat.frame_position();
 
         // We are "on" this beat.
@@ -337,7 +354,7 @@ bool BeatMap::findPrevNextBeats(double dSamples,
 
     // If we are within epsilon samples of a beat then the immediately next and
     // previous beats are the beat we are on.
-    if (on_beat != m_beats.end()) {
+    if (on_beat != beats.end()) {
         previous_beat = on_beat;
         next_beat = on_beat + 1;
     }
@@ -345,14 +362,14 @@ bool BeatMap::findPrevNextBeats(double dSamples,
     *dpPrevBeatSamples = -1;
     *dpNextBeatSamples = -1;
 
-    for (; next_beat != m_beats.end(); ++next_beat) {
+    for (; next_beat != beats.end(); ++next_beat) {
         if (!next_beat->enabled()) {
             continue;
         }
         *dpNextBeatSamples = framesToSamples(next_beat->frame_position());
         break;
     }
-    if (previous_beat != m_beats.end()) {
+    if (previous_beat != beats.end()) {
         for (; true; --previous_beat) {
             if (previous_beat->enabled()) {
                 *dpPrevBeatSamples = framesToSamples(previous_beat->frame_position());
@@ -360,7 +377,7 @@ bool BeatMap::findPrevNextBeats(double dSamples,
             }
 
             // Don't step before the start of the list.
-            if (previous_beat == m_beats.begin()) {
+            if (previous_beat == beats.begin()) {
                 break;
             }
         }
@@ -369,10 +386,11 @@ bool BeatMap::findPrevNextBeats(double dSamples,
 }
 
 std::unique_ptr<BeatIterator> BeatMap::findBeats(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
+    const auto pSnapshot = m_snapshot.read();
+    const BeatList& beats = pSnapshot->beats;
     //startSample and stopSample are sample offsets, converting them to
     //frames
-    if (!isValid() || startSample > stopSample) {
+    if (!isValid(beats) || startSample > stopSample) {
         return std::unique_ptr<BeatIterator>();
     }
 
@@ -381,25 +399,28 @@ std::unique_ptr<BeatIterator> BeatMap::findBeats(double startSample, double stop
     stopBeat.set_frame_position(samplesToFrames(stopSample));
 
     BeatList::const_iterator curBeat =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(),
+            std::lower_bound(beats.constBegin(), beats.constEnd(),
                         startBeat, BeatLessThan);
 
     BeatList::const_iterator lastBeat =
-            std::upper_bound(m_beats.constBegin(), m_beats.constEnd(),
+            std::upper_bound(beats.constBegin(), beats.constEnd(),
                         stopBeat, BeatLessThan);
 
     if (curBeat >= lastBeat) {
         return std::unique_ptr<BeatIterator>();
     }
-    return std::make_unique<BeatMapIterator>(curBeat, lastBeat);
+    return std::make_unique<BeatMapIterator>(beats,
+            static_cast<int>(curBeat - beats.constBegin()),
+            static_cast<int>(lastBeat - beats.constBegin()));
 }
 
 bool BeatMap::hasBeatInRange(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid() || startSample > stopSample) {
+    const auto pSnapshot = m_snapshot.read();
+    const BeatList& beats = pSnapshot->beats;
+    if (!isValid(beats) || startSample > stopSample) {
         return false;
     }
-    double curBeat = findNextBeat(startSample);
+    double curBeat = findNthBeat(beats, startSample, 1);
     if (curBeat <= stopSample) {
         return true;
     }
@@ -407,97 +428,102 @@ bool BeatMap::hasBeatInRange(double startSample, double stopSample) const {
 }
 
 double BeatMap::getBpm() const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid())
+    const auto pSnapshot = m_snapshot.read();
+    if (!isValid(pSnapshot->beats))
         return -1;
-    return m_dCachedBpm;
+    return pSnapshot->cachedBpm;
 }
 
 double BeatMap::getBpmRange(double startSample, double stopSample) const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid())
+    const auto pSnapshot = m_snapshot.read();
+    const BeatList& beats = pSnapshot->beats;
+    if (!isValid(beats))
         return -1;
     Beat startBeat, stopBeat;
     startBeat.set_frame_position(samplesToFrames(startSample));
     stopBeat.set_frame_position(samplesToFrames(stopSample));
-    return calculateBpm(startBeat, stopBeat);
+    return calculateBpm(beats, startBeat, stopBeat);
 }
 
 double BeatMap::getBpmAroundPosition(double curSample, int n) const {
-    QMutexLocker locker(&m_mutex);
-    if (!isValid())
+    const auto pSnapshot = m_snapshot.read();
+    const BeatList& beats = pSnapshot->beats;
+    if (!isValid(beats))
         return -1;
 
     // To make sure we are always counting n beats, iterate backward to the
     // lower bound, then iterate forward from there to the upper bound.
     // a value of -1 indicates we went off the map -- count from the beginning.
-    double lower_bound = findNthBeat(curSample, -n);
+    double lower_bound = findNthBeat(beats, curSample, -n);
     if (lower_bound == -1) {
-        lower_bound = framesToSamples(m_beats.first().frame_position());
+        lower_bound = framesToSamples(beats.first().frame_position());
     }
 
     // If we hit the end of the beat map, recalculate the lower bound.
-    double upper_bound = findNthBeat(lower_bound, n * 2);
+    double upper_bound = findNthBeat(beats, lower_bound, n * 2);
     if (upper_bound == -1) {
-        upper_bound = framesToSamples(m_beats.last().frame_position());
-        lower_bound = findNthBeat(upper_bound, n * -2);
+        upper_bound = framesToSamples(beats.last().frame_position());
+        lower_bound = findNthBeat(beats, upper_bound, n * -2);
         // Super edge-case -- the track doesn't have n beats!  Do the best
         // we can.
         if (lower_bound == -1) {
-            lower_bound = framesToSamples(m_beats.first().frame_position());
+            lower_bound = framesToSamples(beats.first().frame_position());
         }
     }
 
     Beat startBeat, stopBeat;
     startBeat.set_frame_position(samplesToFrames(lower_bound));
     stopBeat.set_frame_position(samplesToFrames(upper_bound));
-    return calculateBpm(startBeat, stopBeat);
+    return calculateBpm(beats, startBeat, stopBeat);
 }
 
 void BeatMap::addBeat(double dBeatSample) {
     QMutexLocker locker(&m_mutex);
+    BeatList beats = m_snapshot.read()->beats;
     Beat beat;
     beat.set_frame_position(samplesToFrames(dBeatSample));
     BeatList::iterator it = std::lower_bound(
-        m_beats.begin(), m_beats.end(), beat, BeatLessThan);
+        beats.begin(), beats.end(), beat, BeatLessThan);
 
     // Don't insert a duplicate beat. TODO(XXX) determine what epsilon to
     // consider a beat identical to another.
     if (it->frame_position() == beat.frame_position())
         return;
 
-    m_beats.insert(it, beat);
-    onBeatlistChanged();
+    beats.insert(it, beat);
+    onBeatlistChanged(beats);
     locker.unlock();
     emit updated();
 }
 
 void BeatMap::removeBeat(double dBeatSample) {
     QMutexLocker locker(&m_mutex);
+    BeatList beats = m_snapshot.read()->beats;
     Beat beat;
     beat.set_frame_position(samplesToFrames(dBeatSample));
     BeatList::iterator it = std::lower_bound(
-        m_beats.begin(), m_beats.end(), beat, BeatLessThan);
+        beats.begin(), beats.end(), beat, BeatLessThan);
 
     // In case there are duplicates, remove every instance of dBeatSample
     // TODO(XXX) add invariant checks against this
     // TODO(XXX) determine what epsilon to consider a beat identical to another
     while (it->frame_position() == beat.frame_position()) {
-        it = m_beats.erase(it);
+        it = beats.erase(it);
     }
-    onBeatlistChanged();
+    onBeatlistChanged(beats);
     locker.unlock();
     emit updated();
 }
 
 void BeatMap::moveBeat(double dBeatSample, double dNewBeatSample) {
     QMutexLocker locker(&m_mutex);
+    BeatList beats = m_snapshot.read()->beats;
     Beat beat, newBeat;
     beat.set_frame_position(samplesToFrames(dBeatSample));
     newBeat.set_frame_position(samplesToFrames(dNewBeatSample));
 
     BeatList::iterator it = std::lower_bound(
-        m_beats.begin(), m_beats.end(), beat, BeatLessThan);
+        beats.begin(), beats.end(), beat, BeatLessThan);
 
     // In case there are duplicates, remove every instance of dBeatSample
     // TODO(XXX) add invariant checks against this
@@ -506,39 +532,40 @@ void BeatMap::moveBeat(double dBeatSample, double dNewBeatSample) {
         if (newBeat.enabled() != it->enabled()) {
             newBeat.set_enabled(it->enabled());
         }
-        it = m_beats.erase(it);
+        it = beats.erase(it);
     }
 
     // Now add a beat to dNewBeatSample
-    it = std::lower_bound(m_beats.begin(), m_beats.end(), newBeat, BeatLessThan);
+    it = std::lower_bound(beats.begin(), beats.end(), newBeat, BeatLessThan);
     // TODO(XXX) beat epsilon
     if (it->frame_position() != newBeat.frame_position()) {
-        m_beats.insert(it, newBeat);
+        beats.insert(it, newBeat);
     }
-    onBeatlistChanged();
+    onBeatlistChanged(beats);
     locker.unlock();
     emit updated();
 }
 
 void BeatMap::translate(double dNumSamples) {
     QMutexLocker locker(&m_mutex);
+    BeatList beats = m_snapshot.read()->beats;
     // Converting to frame offset
-    if (!isValid()) {
+    if (!isValid(beats)) {
         return;
     }
 
     double dNumFrames = samplesToFrames(dNumSamples);
-    for (BeatList::iterator it = m_beats.begin();
-         it != m_beats.end(); ) {
+    for (BeatList::iterator it = beats.begin();
+         it != beats.end(); ) {
         double newpos = it->frame_position() + dNumFrames;
         if (newpos >= 0) {
             it->set_frame_position(newpos);
             ++it;
         } else {
-            it = m_beats.erase(it);
+            it = beats.erase(it);
         }
     }
-    onBeatlistChanged();
+    onBeatlistChanged(beats);
     locker.unlock();
     emit updated();
 }
@@ -546,140 +573,153 @@ void BeatMap::translate(double dNumSamples) {
 void BeatMap::scale(enum BPMScale scale) {
 
     QMutexLocker locker(&m_mutex);
-    if (!isValid() || m_beats.isEmpty()) {
+    BeatList beats = m_snapshot.read()->beats;
+    if (!isValid(beats) || beats.isEmpty()) {
         return;
     }
 
     switch (scale) {
     case DOUBLE:
         // introduce a new beat into every gap
-        scaleDouble();
+        scaleDouble(&beats);
         break;
     case HALVE:
         // remove every second beat
-        scaleHalve();
+        scaleHalve(&beats);
         break;
     case TWOTHIRDS:
         // introduce a new beat into every gap
-        scaleDouble();
+        scaleDouble(&beats);
         // remove every second and third beat
-        scaleThird();
+        scaleThird(&beats);
         break;
     case THREEFOURTHS:
         // introduce two beats into every gap
-        scaleTriple();
+        scaleTriple(&beats);
         // remove every second third and forth beat
-        scaleFourth();
+        scaleFourth(&beats);
         break;
     case FOURTHIRDS:
         // introduce three beats into every gap
-        scaleQuadruple();
+        scaleQuadruple(&beats);
         // remove every second third and forth beat
-        scaleThird();
+        scaleThird(&beats);
         break;
     case THREEHALVES:
         // introduce two beats into every gap
-        scaleTriple();
+        scaleTriple(&beats);
         // remove every second beat
-        scaleHalve();
+        scaleHalve(&beats);
         break;
     default:
         DEBUG_ASSERT(!"scale value invalid");
         return;
     }
-    onBeatlistChanged();
+    onBeatlistChanged(beats);
     locker.unlock();
     emit updated();
 }
 
-void BeatMap::scaleDouble() {
-    Beat prevBeat = m_beats.first();
+// static
+void BeatMap::scaleDouble(BeatList* pBeats) {
+    BeatList& beats = *pBeats;
+    Beat prevBeat = beats.first();
     // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
+    BeatList::iterator it = beats.begin() + 1;
+    for (; it != beats.end(); ++it) {
         // Need to not accrue fractional frames.
         int distance = it->frame_position() - prevBeat.frame_position();
         Beat beat;
         beat.set_frame_position(prevBeat.frame_position() + distance / 2);
-        it = m_beats.insert(it, beat);
+        it = beats.insert(it, beat);
         prevBeat = (++it)[0];
     }
 }
 
-void BeatMap::scaleTriple() {
-    Beat prevBeat = m_beats.first();
+// static
+void BeatMap::scaleTriple(BeatList* pBeats) {
+    BeatList& beats = *pBeats;
+    Beat prevBeat = beats.first();
     // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
+    BeatList::iterator it = beats.begin() + 1;
+    for (; it != beats.end(); ++it) {
         // Need to not accrue fractional frames.
         int distance = it->frame_position() - prevBeat.frame_position();
         Beat beat;
         beat.set_frame_position(prevBeat.frame_position() + distance / 3);
-        it = m_beats.insert(it, beat);
+        it = beats.insert(it, beat);
         ++it;
         beat.set_frame_position(prevBeat.frame_position() + distance * 2 / 3);
-        it = m_beats.insert(it, beat);
+        it = beats.insert(it, beat);
         prevBeat = (++it)[0];
     }
 }
 
-void BeatMap::scaleQuadruple() {
-    Beat prevBeat = m_beats.first();
+// static
+void BeatMap::scaleQuadruple(BeatList* pBeats) {
+    BeatList& beats = *pBeats;
+    Beat prevBeat = beats.first();
     // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
+    BeatList::iterator it = beats.begin() + 1;
+    for (; it != beats.end(); ++it) {
         // Need to not accrue fractional frames.
         int distance = it->frame_position() - prevBeat.frame_position();
         Beat beat;
         for (int i = 1; i <= 3; i++) {
             beat.set_frame_position(prevBeat.frame_position() + distance * i / 4);
-            it = m_beats.insert(it, beat);
+            it = beats.insert(it, beat);
             ++it;
         }
         prevBeat = it[0];
     }
 }
 
-void BeatMap::scaleHalve() {
+// static
+void BeatMap::scaleHalve(BeatList* pBeats) {
+    BeatList& beats = *pBeats;
     // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
+    BeatList::iterator it = beats.begin() + 1;
+    for (; it != beats.end(); ++it) {
+        it = beats.erase(it);
+        if (it == beats.end()) {
             break;
         }
     }
 }
 
-void BeatMap::scaleThird() {
+// static
+void BeatMap::scaleThird(BeatList* pBeats) {
+    BeatList& beats = *pBeats;
     // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
+    BeatList::iterator it = beats.begin() + 1;
+    for (; it != beats.end(); ++it) {
+        it = beats.erase(it);
+        if (it == beats.end()) {
             break;
         }
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
+        it = beats.erase(it);
+        if (it == beats.end()) {
             break;
         }
     }
 }
 
-void BeatMap::scaleFourth() {
+// static
+void BeatMap::scaleFourth(BeatList* pBeats) {
+    BeatList& beats = *pBeats;
     // Skip the first beat to preserve the first beat in a measure
-    BeatList::iterator it = m_beats.begin() + 1;
-    for (; it != m_beats.end(); ++it) {
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
+    BeatList::iterator it = beats.begin() + 1;
+    for (; it != beats.end(); ++it) {
+        it = beats.erase(it);
+        if (it == beats.end()) {
             break;
         }
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
+        it = beats.erase(it);
+        if (it == beats.end()) {
             break;
         }
-        it = m_beats.erase(it);
-        if (it == m_beats.end()) {
+        it = beats.erase(it);
+        if (it == beats.end()) {
             break;
         }
     }
@@ -715,28 +755,30 @@ void BeatMap::setBpm(double dBpm) {
      */
 }
 
-void BeatMap::onBeatlistChanged() {
-    if (!isValid()) {
-        m_dLastFrame = 0;
-        m_dCachedBpm = 0;
-        return;
+void BeatMap::onBeatlistChanged(BeatList beats) {
+    auto pSnapshot = std::make_unique<Snapshot>();
+    if (isValid(beats)) {
+        pSnapshot->lastFrame = beats.last().frame_position();
+        Beat startBeat = beats.first();
+        Beat stopBeat =  beats.last();
+        pSnapshot->cachedBpm = calculateBpm(beats, startBeat, stopBeat);
     }
-    m_dLastFrame = m_beats.last().frame_position();
-    Beat startBeat = m_beats.first();
-    Beat stopBeat =  m_beats.last();
-    m_dCachedBpm = calculateBpm(startBeat, stopBeat);
+    pSnapshot->beats = std::move(beats);
+    m_snapshot.publish(std::move(pSnapshot));
 }
 
-double BeatMap::calculateBpm(const Beat& startBeat, const Beat& stopBeat) const {
+double BeatMap::calculateBpm(const BeatList& beats,
+                             const Beat& startBeat,
+                             const Beat& stopBeat) const {
     if (startBeat.frame_position() > stopBeat.frame_position()) {
         return -1;
     }
 
     BeatList::const_iterator curBeat =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(), startBeat, BeatLessThan);
+            std::lower_bound(beats.constBegin(), beats.constEnd(), startBeat, BeatLessThan);
 
     BeatList::const_iterator lastBeat =
-            std::upper_bound(m_beats.constBegin(), m_beats.constEnd(), stopBeat, BeatLessThan);
+            std::upper_bound(beats.constBegin(), beats.constEnd(), stopBeat, BeatLessThan);
 
     QVector<double> beatvect;
     for (; curBeat != lastBeat; ++curBeat) {
@@ -13,11 +13,15 @@
 #include "track/track.h"
 #include "track/beats.h"
 #include "proto/beats.pb.h"
+#include "util/rcupointer.h"
 
 #define BEAT_MAP_VERSION "BeatMap-1.0"
 
 typedef QList<mixxx::track::io::Beat> BeatList;
 
+// The beat list is never modified in place. Mutations publish a modified
+// copy, so that the engine thread can query the beats without ever waiting
+// for a lock that is held by the GUI.
 class BeatMap final : public Beats {
   public:
     // Construct a BeatMap. iSampleRate may be provided if a more accurate
@@ -81,29 +85,42 @@ class BeatMap final : public Beats {
     void setBpm(double dBpm) override;
 
   private:
+    // Immutable once published
+    struct Snapshot {
+        BeatList beats;
+        double cachedBpm = 0;
+        double lastFrame = 0;
+    };
+
     BeatMap(const BeatMap& other);
     bool readByteArray(const QByteArray& byteArray);
     void createFromBeatVector(const QVector<double>& beats);
-    void onBeatlistChanged();
+    // Publishes the modified beats. Must be called while holding m_mutex.
+    void onBeatlistChanged(BeatList beats);
 
-    double calculateBpm(const mixxx::track::io::Beat& startBeat,
+    double calculateBpm(const BeatList& beats,
+                        const mixxx::track::io::Beat& startBeat,
                         const mixxx::track::io::Beat& stopBeat) const;
     // For internal use only.
-    bool isValid() const;
+    bool isValid(const BeatList& beats) const;
+    double findNthBeat(const BeatList& beats, double dSamples, int n) const;
+    bool findPrevNextBeats(const BeatList& beats,
+                           double dSamples,
+                           double* dpPrevBeatSamples,
+                           double* dpNextBeatSamples) const;
 
-    void scaleDouble();
-    void scaleTriple();
-    void scaleQuadruple();
-    void scaleHalve();
-    void scaleThird();
-    void scaleFourth();
+    static void scaleDouble(BeatList* pBeats);
+    static void scaleTriple(BeatList* pBeats);
+    static void scaleQuadruple(BeatList* pBeats);
+    static void scaleHalve(BeatList* pBeats);
+    static void scaleThird(BeatList* pBeats);
+    static void scaleFourth(BeatList* pBeats);
 
+    // Serializes all mutations
     mutable QMutex m_mutex;
     QString m_subVersion;
     SINT m_iSampleRate;
-    double m_dCachedBpm;
-    double m_dLastFrame;
-    BeatList m_beats;
+    RcuPointer<Snapshot> m_snapshot;
 };
 
 #endif /* BEATMAP_H_ */
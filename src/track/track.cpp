@@ -670,6 +670,10 @@ void Track::setWaveformSummary(ConstWaveformPointer pWaveform) {
     emit waveformSummaryUpdated();
 }
 
+void Track::setWaveformSummaryAnalyzed(int dataBegin, int dataEnd) {
+    emit waveformSummaryAnalyzed(dataBegin, dataEnd);
+}
+
 void Track::setCuePoint(CuePosition cue) {
     QMutexLocker lock(&m_qMutex);
 
@@ -243,6 +243,9 @@ class Track : public QObject {
 
     ConstWaveformPointer getWaveformSummary() const;
     void setWaveformSummary(ConstWaveformPointer pWaveform);
+    // Called by the analyzer while it fills the waveform summary. The data
+    // in the range [dataBegin, dataEnd) is complete and can be drawn.
+    void setWaveformSummaryAnalyzed(int dataBegin, int dataEnd);
 
     // Get the track's main cue point
     CuePosition getCuePoint() const;
@@ -312,6 +315,7 @@ class Track : public QObject {
   signals:
     void waveformUpdated();
     void waveformSummaryUpdated();
+    void waveformSummaryAnalyzed(int dataBegin, int dataEnd);
     void coverArtUpdated();
     void bpmUpdated(double bpm);
     void beatsUpdated();
@@ -0,0 +1,335 @@
+#include "util/callbacktrace.h"
+
+#include <QFile>
+#include <QStringList>
+#include <QTextStream>
+#include <QtDebug>
+
+#include "util/assert.h"
+#include "util/math.h"
+#include "util/time.h"
+
+namespace {
+
+QString formatMicros(qint64 nanos) {
+    return QString::number(nanos / 1000.0, 'f', 3);
+}
+
+} // anonymous namespace
+
+CallbackTrace::CallbackTrace()
+        : m_callbackThread(nullptr),
+          m_inCallback(false),
+          m_stageStartNanos(0),
+          m_stageDepth(0),
+          m_worstLoad(0.0),
+          m_callbackCount(0),
+          m_xrunCount(0) {
+    for (auto& slot : m_ring) {
+        storeSpan(&slot, Span());
+    }
+    storeSpan(&m_worst, Span());
+    for (auto& bucket : m_histogram) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+// static
+CallbackTrace& CallbackTrace::instance() {
+    static CallbackTrace s_instance;
+    return s_instance;
+}
+
+// static
+QString CallbackTrace::stageName(Stage stage) {
+    switch (stage) {
+    case Stage::Io:
+        return QStringLiteral("io");
+    case Stage::Mixer:
+        return QStringLiteral("mixer");
+    case Stage::Decks:
+        return QStringLiteral("decks");
+    case Stage::Effects:
+        return QStringLiteral("effects");
+    case Stage::Sync:
+        return QStringLiteral("sync");
+    case Stage::Sidechain:
+        return QStringLiteral("sidechain");
+    case Stage::Count:
+        break;
+    }
+    DEBUG_ASSERT(!"unknown stage");
+    return QString();
+}
+
+CallbackTrace::Stage CallbackTrace::Span::dominantStage() const {
+    int dominant = 0;
+    for (int i = 1; i < kStageCount; ++i) {
+        if (stageNanos[i] > stageNanos[dominant]) {
+            dominant = i;
+        }
+    }
+    return static_cast<Stage>(dominant);
+}
+
+void CallbackTrace::beginCallback(mixxx::Duration budget) {
+    // A callback that bailed out early is simply discarded
+    const qint64 nowNanos = mixxx::Time::elapsed().toIntegerNanos();
+    m_current = Span();
+    m_current.sequence = m_callbackCount.load(std::memory_order_relaxed) + 1;
+    m_current.startNanos = nowNanos;
+    m_current.budgetNanos = budget.toIntegerNanos();
+    m_stageStartNanos = nowNanos;
+    m_stageStack[0] = Stage::Io;
+    m_stageDepth = 1;
+    m_inCallback = true;
+    m_callbackThread.store(QThread::currentThreadId(), std::memory_order_relaxed);
+}
+
+void CallbackTrace::endCallback() {
+    if (!m_inCallback) {
+        return;
+    }
+    const qint64 nowNanos = mixxx::Time::elapsed().toIntegerNanos();
+    accumulateStage(nowNanos);
+    m_inCallback = false;
+    m_current.durationNanos = nowNanos - m_current.startNanos;
+
+    const auto index = static_cast<int>((m_current.sequence - 1) % kRingSize);
+    storeSpan(&m_ring[index], m_current);
+
+    const double load = m_current.load();
+    if (load > m_worstLoad) {
+        m_worstLoad = load;
+        storeSpan(&m_worst, m_current);
+    }
+    const int bucket = math_clamp(
+            static_cast<int>(load * (kHistogramBuckets - 1)),
+            0,
+            kHistogramBuckets - 1);
+    m_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    if (m_current.xrun) {
+        m_xrunCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_callbackCount.store(m_current.sequence, std::memory_order_release);
+}
+
+void CallbackTrace::markXrun() {
+    if (m_inCallback) {
+        m_current.xrun = true;
+    }
+}
+
+bool CallbackTrace::enterStage(Stage stage) {
+    if (QThread::currentThreadId() !=
+            m_callbackThread.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (!m_inCallback || m_stageDepth >= kMaxStageDepth) {
+        return false;
+    }
+    accumulateStage(mixxx::Time::elapsed().toIntegerNanos());
+    m_stageStack[m_stageDepth++] = stage;
+    return true;
+}
+
+void CallbackTrace::leaveStage() {
+    // The callback may have ended while the scope was still open
+    if (!m_inCallback || m_stageDepth <= 1) {
+        return;
+    }
+    accumulateStage(mixxx::Time::elapsed().toIntegerNanos());
+    --m_stageDepth;
+}
+
+void CallbackTrace::accumulateStage(qint64 nowNanos) {
+    const Stage stage = m_stageStack[m_stageDepth - 1];
+    m_current.stageNanos[static_cast<int>(stage)] += nowNanos - m_stageStartNanos;
+    m_stageStartNanos = nowNanos;
+}
+
+// static
+void CallbackTrace::storeSpan(Slot* pSlot, const Span& span) {
+    // An odd lock value tells readers that the slot is being written
+    const quint32 lock = pSlot->lock.load(std::memory_order_relaxed);
+    pSlot->lock.store(lock + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    pSlot->sequence.store(span.sequence, std::memory_order_relaxed);
+    pSlot->startNanos.store(span.startNanos, std::memory_order_relaxed);
+    pSlot->durationNanos.store(span.durationNanos, std::memory_order_relaxed);
+    pSlot->budgetNanos.store(span.budgetNanos, std::memory_order_relaxed);
+    for (int i = 0; i < kStageCount; ++i) {
+        pSlot->stageNanos[i].store(span.stageNanos[i], std::memory_order_relaxed);
+    }
+    pSlot->xrun.store(span.xrun, std::memory_order_relaxed);
+    pSlot->lock.store(lock + 2, std::memory_order_release);
+}
+
+// static
+bool CallbackTrace::loadSpan(const Slot& slot, Span* pSpan) {
+    const quint32 lock = slot.lock.load(std::memory_order_acquire);
+    if (lock & 1) {
+        return false;
+    }
+    pSpan->sequence = slot.sequence.load(std::memory_order_relaxed);
+    pSpan->startNanos = slot.startNanos.load(std::memory_order_relaxed);
+    pSpan->durationNanos = slot.durationNanos.load(std::memory_order_relaxed);
+    pSpan->budgetNanos = slot.budgetNanos.load(std::memory_order_relaxed);
+    for (int i = 0; i < kStageCount; ++i) {
+        pSpan->stageNanos[i] = slot.stageNanos[i].load(std::memory_order_relaxed);
+    }
+    pSpan->xrun = slot.xrun.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.lock.load(std::memory_order_relaxed) == lock;
+}
+
+QVector<CallbackTrace::Span> CallbackTrace::spans() const {
+    const quint64 count = callbackCount();
+    const quint64 first = count > kRingSize ? count - kRingSize + 1 : 1;
+    QVector<Span> result;
+    result.reserve(static_cast<int>(count - first + 1));
+    for (quint64 sequence = first; sequence <= count; ++sequence) {
+        Span span;
+        // Skip spans that have been overwritten in the meantime
+        if (loadSpan(m_ring[(sequence - 1) % kRingSize], &span) &&
+                span.sequence == sequence) {
+            result.append(span);
+        }
+    }
+    return result;
+}
+
+CallbackTrace::Span CallbackTrace::worstSpan() const {
+    Span span;
+    while (!loadSpan(m_worst, &span)) {
+        // The engine thread never holds the lock for long
+    }
+    return span;
+}
+
+QVector<quint64> CallbackTrace::loadHistogram() const {
+    QVector<quint64> result(kHistogramBuckets);
+    for (int i = 0; i < kHistogramBuckets; ++i) {
+        result[i] = m_histogram[i].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void CallbackTrace::reset() {
+    DEBUG_ASSERT(!m_inCallback);
+    for (auto& slot : m_ring) {
+        storeSpan(&slot, Span());
+    }
+    storeSpan(&m_worst, Span());
+    m_worstLoad = 0.0;
+    for (auto& bucket : m_histogram) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_xrunCount.store(0, std::memory_order_relaxed);
+    m_callbackCount.store(0, std::memory_order_release);
+}
+
+bool CallbackTrace::writeChromeTrace(const QString& fileName) const {
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "Could not open callback trace file for writing:"
+                   << file.fileName();
+        return false;
+    }
+
+    QTextStream out(&file);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+           "\"args\":{\"name\":\"Engine\"}}";
+    const QVector<Span> allSpans = spans();
+    for (const auto& span : allSpans) {
+        const QString ts = formatMicros(span.startNanos);
+        out << ",\n{\"name\":\"callback\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+            << "\"ts\":" << ts
+            << ",\"dur\":" << formatMicros(span.durationNanos)
+            << ",\"args\":{\"sequence\":" << span.sequence
+            << ",\"budget_us\":" << formatMicros(span.budgetNanos)
+            << ",\"load\":" << QString::number(span.load(), 'f', 3)
+            << ",\"dominant_stage\":\"" << stageName(span.dominantStage())
+            << "\"}}";
+        out << ",\n{\"name\":\"stages_us\",\"ph\":\"C\",\"pid\":1,"
+            << "\"ts\":" << ts << ",\"args\":{";
+        for (int i = 0; i < kStageCount; ++i) {
+            if (i > 0) {
+                out << ',';
+            }
+            out << '"' << stageName(static_cast<Stage>(i)) << "\":"
+                << formatMicros(span.stageNanos[i]);
+        }
+        out << "}}";
+        if (span.xrun) {
+            out << ",\n{\"name\":\"xrun\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,"
+                << "\"tid\":1,\"ts\":" << ts << '}';
+        }
+    }
+    out << "\n]}\n";
+    return true;
+}
+
+bool CallbackTrace::writeCsv(const QString& fileName) const {
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "Could not open callback trace file for writing:"
+                   << file.fileName();
+        return false;
+    }
+
+    QTextStream out(&file);
+    out << "sequence,start_us,duration_us,budget_us,load,xrun";
+    for (int i = 0; i < kStageCount; ++i) {
+        out << ',' << stageName(static_cast<Stage>(i)) << "_us";
+    }
+    out << '\n';
+    const QVector<Span> allSpans = spans();
+    for (const auto& span : allSpans) {
+        out << span.sequence
+            << ',' << formatMicros(span.startNanos)
+            << ',' << formatMicros(span.durationNanos)
+            << ',' << formatMicros(span.budgetNanos)
+            << ',' << QString::number(span.load(), 'f', 3)
+            << ',' << (span.xrun ? 1 : 0);
+        for (int i = 0; i < kStageCount; ++i) {
+            out << ',' << formatMicros(span.stageNanos[i]);
+        }
+        out << '\n';
+    }
+    return true;
+}
+
+bool CallbackTrace::write(const QString& fileName) const {
+    if (fileName.endsWith(QStringLiteral(".csv"), Qt::CaseInsensitive)) {
+        return writeCsv(fileName);
+    }
+    return writeChromeTrace(fileName);
+}
+
+void CallbackTrace::logSummary() const {
+    const quint64 count = callbackCount();
+    if (count == 0) {
+        return;
+    }
+    const QVector<quint64> histogram = loadHistogram();
+    QStringList buckets;
+    for (int i = 0; i < kHistogramBuckets; ++i) {
+        const QString range = i < kHistogramBuckets - 1
+                ? QString("<%1%").arg((i + 1) * 10)
+                : QString(">=100%");
+        buckets << QString("%1: %2").arg(range, QString::number(histogram[i]));
+    }
+    qDebug() << "Audio callbacks:" << count
+             << "xruns:" << xrunCount()
+             << "load histogram:" << buckets.join(", ");
+
+    const Span worst = worstSpan();
+    qDebug() << "Worst audio callback:" << worst.sequence
+             << "took" << formatMicros(worst.durationNanos) << "us of"
+             << formatMicros(worst.budgetNanos) << "us, mostly in"
+             << stageName(worst.dominantStage())
+             << "(" << formatMicros(worst.stageNanos[
+                       static_cast<int>(worst.dominantStage())]) << "us )";
+}
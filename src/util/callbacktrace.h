@@ -0,0 +1,168 @@
+#pragma once
+
+#include <QString>
+#include <QThread>
+#include <QVector>
+#include <atomic>
+
+#include "util/class.h"
+#include "util/duration.h"
+
+// CallbackTrace records a span for each audio callback of the clock
+// reference device, together with the time that has been spent in each
+// stage of the engine. It is meant to find the stage that made a callback
+// miss its deadline on a machine where a debugger or profiler is not an
+// option.
+//
+// Recording is real-time safe: the engine thread only reads the clock and
+// stores plain numbers into a fixed ring buffer that is pre-allocated when
+// the instance is constructed. Each slot is guarded by a sequence lock, so
+// other threads can copy the recorded spans at any time without ever
+// blocking the engine thread. Spans that are overwritten while they are
+// being copied are skipped.
+//
+// All recording functions except enterStage() must be called from the
+// engine thread only. Stages that are entered on other threads, e.g. the
+// channel worker threads, are ignored and count towards the enclosing stage
+// of the engine thread.
+class CallbackTrace {
+  public:
+    enum class Stage {
+        // Everything outside of EngineMaster::process(), mostly the sound
+        // device copying samples from and to the driver
+        Io = 0,
+        // EngineMaster::process() outside of any other stage
+        Mixer,
+        Decks,
+        Effects,
+        Sync,
+        Sidechain,
+        Count,
+    };
+    static constexpr int kStageCount = static_cast<int>(Stage::Count);
+    static constexpr int kRingSize = 4096;
+    // Buckets of the callback load histogram, each covering 10% of the
+    // time budget of a callback. The last bucket collects all callbacks
+    // that have exceeded their budget.
+    static constexpr int kHistogramBuckets = 11;
+
+    struct Span {
+        quint64 sequence = 0;
+        // Since Mixxx startup, see mixxx::Time
+        qint64 startNanos = 0;
+        qint64 durationNanos = 0;
+        // The duration of the audio buffer
+        qint64 budgetNanos = 0;
+        // Exclusive time, nested stages are not included in the enclosing
+        // stage. All stages add up to durationNanos.
+        qint64 stageNanos[kStageCount] = {};
+        // The driver reported an xrun during this callback
+        bool xrun = false;
+
+        double load() const {
+            return budgetNanos > 0
+                    ? static_cast<double>(durationNanos) / budgetNanos
+                    : 0.0;
+        }
+        Stage dominantStage() const;
+    };
+
+    // Attributes the time until it is destroyed to the given stage. Does
+    // nothing outside of a callback.
+    class StageScope {
+      public:
+        explicit StageScope(Stage stage, CallbackTrace* pTrace = &instance())
+                : m_pTrace(pTrace),
+                  m_active(pTrace->enterStage(stage)) {
+        }
+        ~StageScope() {
+            if (m_active) {
+                m_pTrace->leaveStage();
+            }
+        }
+
+      private:
+        CallbackTrace* const m_pTrace;
+        const bool m_active;
+
+        DISALLOW_COPY_AND_ASSIGN(StageScope);
+    };
+
+    CallbackTrace();
+
+    // The instance used by the sound devices and the engine. It should be
+    // created before the first callback, e.g. by the SoundManager.
+    static CallbackTrace& instance();
+
+    static QString stageName(Stage stage);
+
+    // Called from the engine thread
+    void beginCallback(mixxx::Duration budget);
+    void endCallback();
+    void markXrun();
+    bool enterStage(Stage stage);
+    void leaveStage();
+
+    // Thread-safe. Returns the spans in the ring buffer, oldest first.
+    QVector<Span> spans() const;
+    // Thread-safe. Returns the span with the highest load since the last
+    // reset(), or a span with sequence 0 if no callback has been traced.
+    Span worstSpan() const;
+    // Thread-safe. The number of callbacks per load bucket.
+    QVector<quint64> loadHistogram() const;
+    quint64 callbackCount() const {
+        return m_callbackCount.load(std::memory_order_acquire);
+    }
+    quint64 xrunCount() const {
+        return m_xrunCount.load(std::memory_order_relaxed);
+    }
+
+    // Must not be called while callbacks are traced
+    void reset();
+
+    // Writes the spans in the Trace Event Format that can be loaded into
+    // chrome://tracing or https://ui.perfetto.dev
+    bool writeChromeTrace(const QString& fileName) const;
+    // Writes one span per line
+    bool writeCsv(const QString& fileName) const;
+    // Writes a CSV file if the file name ends with .csv and a Chrome trace
+    // otherwise.
+    bool write(const QString& fileName) const;
+    void logSummary() const;
+
+  private:
+    static constexpr int kMaxStageDepth = 8;
+
+    struct Slot {
+        std::atomic<quint32> lock{0};
+        std::atomic<quint64> sequence;
+        std::atomic<qint64> startNanos;
+        std::atomic<qint64> durationNanos;
+        std::atomic<qint64> budgetNanos;
+        std::atomic<qint64> stageNanos[kStageCount];
+        std::atomic<bool> xrun;
+    };
+    static void storeSpan(Slot* pSlot, const Span& span);
+    static bool loadSpan(const Slot& slot, Span* pSpan);
+
+    void accumulateStage(qint64 nowNanos);
+
+    // The thread that has begun the last callback
+    std::atomic<Qt::HANDLE> m_callbackThread;
+
+    // Only accessed from the engine thread
+    bool m_inCallback;
+    Span m_current;
+    qint64 m_stageStartNanos;
+    Stage m_stageStack[kMaxStageDepth];
+    int m_stageDepth;
+    double m_worstLoad;
+
+    Slot m_ring[kRingSize];
+    Slot m_worst;
+    std::atomic<quint64> m_callbackCount;
+    std::atomic<quint64> m_xrunCount;
+    std::atomic<quint64> m_histogram[kHistogramBuckets];
+
+    DISALLOW_COPY_AND_ASSIGN(CallbackTrace);
+};
@@ -14,6 +14,7 @@ CmdlineArgs::CmdlineArgs()
       m_developer(false),
       m_safeMode(false),
       m_debugAssertBreak(false),
+      m_analyze(false),
       m_settingsPathSet(false),
       m_logLevel(mixxx::kLogLevelDefault),
       m_logFlushLevel(mixxx::kLogFlushLevelDefault),
@@ -29,7 +30,8 @@ CmdlineArgs::CmdlineArgs()
 
 bool CmdlineArgs::Parse(int &argc, char **argv) {
     bool logLevelSet = false;
-    for (int i = 0; i < argc; ++i) {
+    // argv[0] is the path of the executable
+    for (int i = 1; i < argc; ++i) {
         if (   argv[i] == QString("-h")
             || argv[i] == QString("--h")
             || argv[i] == QString("--help")) {
@@ -41,6 +43,7 @@ bool CmdlineArgs::Parse(int &argc, char **argv) {
             m_startInFullscreen = true;
         } else if (argv[i] == QString("--locale") && i+1 < argc) {
             m_locale = argv[i+1];
+            i++;
         } else if (argv[i] == QString("--settingsPath") && i+1 < argc) {
             m_settingsPath = QString::fromLocal8Bit(argv[i+1]);
             // TODO(XXX) Trailing slash not needed anymore as we switches from String::append
@@ -49,6 +52,7 @@ bool CmdlineArgs::Parse(int &argc, char **argv) {
                 m_settingsPath.append("/");
             }
             m_settingsPathSet=true;
+            i++;
         } else if (argv[i] == QString("--resourcePath") && i+1 < argc) {
             m_resourcePath = QString::fromLocal8Bit(argv[i+1]);
             i++;
@@ -58,6 +62,9 @@ bool CmdlineArgs::Parse(int &argc, char **argv) {
         } else if (argv[i] == QString("--timelinePath") && i+1 < argc) {
             m_timelinePath = QString::fromLocal8Bit(argv[i+1]);
             i++;
+        } else if (argv[i] == QString("--callbackTracePath") && i+1 < argc) {
+            m_callbackTracePath = QString::fromLocal8Bit(argv[i+1]);
+            i++;
         } else if (argv[i] == QString("--logLevel") && i+1 < argc) {
             logLevelSet = true;
             auto level = QLatin1String(argv[i+1]);
@@ -102,6 +109,8 @@ when a critical error occurs unless this is set properly.\n", stdout);
             m_safeMode = true;
         } else if (QString::fromLocal8Bit(argv[i]).contains("--debugAssertBreak", Qt::CaseInsensitive)) {
             m_debugAssertBreak = true;
+        } else if (argv[i] == QString("--analyze")) {
+            m_analyze = true;
         } else {
             m_musicFiles += QString::fromLocal8Bit(argv[i]);
         }
@@ -156,6 +165,11 @@ void CmdlineArgs::printUsage() {
 \n\
 -f, --fullScreen        Starts Mixxx in full-screen mode\n\
 \n\
+--analyze [PATH...]     Analyzes the given files and directories without\n\
+                        starting the GUI and exits. Analyzes all tracks in\n\
+                        the library if no PATH is given. New tracks are\n\
+                        added to the library.\n\
+\n\
 --logLevel LEVEL        Sets the verbosity of command line logging\n\
                         critical - Critical/Fatal only\n\
                         warning  - Above + Warnings\n\
@@ -166,6 +180,12 @@ void CmdlineArgs::printUsage() {
 --logFlushLevel LEVEL   Sets the the logging level at which the log buffer\n\
                         is flushed to mixxx.log. LEVEL is one of the values\n\
                         defined at --logLevel above.\n\
+\n\
+--callbackTracePath PATH\n\
+                        Writes the timing of the last audio callbacks\n\
+                        and their engine stages to PATH on exit, as CSV\n\
+                        if PATH ends with .csv, otherwise as a Chrome\n\
+                        trace (chrome://tracing).\n\
 \n"
 #ifdef MIXXX_BUILD_DEBUG
 "\
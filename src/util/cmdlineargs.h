@@ -25,6 +25,9 @@ class CmdlineArgs final {
     bool getDeveloper() const { return m_developer; }
     bool getSafeMode() const { return m_safeMode; }
     bool getDebugAssertBreak() const { return m_debugAssertBreak; }
+    // Analyze the music files (or the whole library if none are given)
+    // without starting the GUI
+    bool getAnalyze() const { return m_analyze; }
     bool getSettingsPathSet() const { return m_settingsPathSet; }
     mixxx::LogLevel getLogLevel() const { return m_logLevel; }
     mixxx::LogLevel getLogFlushLevel() const { return m_logFlushLevel; }
@@ -37,6 +40,8 @@ class CmdlineArgs final {
     const QString& getResourcePath() const { return m_resourcePath; }
     const QString& getPluginPath() const { return m_pluginPath; }
     const QString& getTimelinePath() const { return m_timelinePath; }
+    bool getCallbackTraceEnabled() const { return !m_callbackTracePath.isEmpty(); }
+    const QString& getCallbackTracePath() const { return m_callbackTracePath; }
 
   private:
     CmdlineArgs();
@@ -47,6 +52,7 @@ class CmdlineArgs final {
     bool m_developer; // Developer Mode
     bool m_safeMode;
     bool m_debugAssertBreak;
+    bool m_analyze;
     bool m_settingsPathSet; // has --settingsPath been set on command line ?
     mixxx::LogLevel m_logLevel; // Level of stderr logging message verbosity
     mixxx::LogLevel m_logFlushLevel; // Level of mixx.log file flushing
@@ -55,6 +61,7 @@ class CmdlineArgs final {
     QString m_resourcePath;
     QString m_pluginPath;
     QString m_timelinePath;
+    QString m_callbackTracePath;
 };
 
 #endif /* CMDLINEARGS_H */
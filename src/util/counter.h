@@ -2,17 +2,25 @@
 #define COUNTER_H
 
 #include "util/stat.h"
+#include "util/statsmanager.h"
 
 class Counter {
   public:
+    // Registering the tag may allocate, so nothing is registered while no
+    // stats are collected. Prefer Counter(int) in realtime code.
     Counter(const QString& tag)
-    : m_tag(tag) {
+    : m_tagId(StatsManager::s_bStatsManagerEnabled ?
+              Stat::registerTag(tag) : Stat::kInvalidTagId) {
+    }
+    // Reports to a tag that has been registered with Stat::registerTag()
+    explicit Counter(int tagId)
+    : m_tagId(tagId) {
     }
     void increment(int by=1) {
         Stat::ComputeFlags flags = Stat::experimentFlags(
             Stat::COUNT | Stat::SUM | Stat::AVERAGE |
             Stat::SAMPLE_VARIANCE | Stat::MIN | Stat::MAX);
-        Stat::track(m_tag, Stat::COUNTER, flags, by);
+        Stat::track(m_tagId, Stat::COUNTER, flags, by);
     }
     Counter& operator+=(int by) {
         this->increment(by);
@@ -24,7 +32,7 @@ class Counter {
         return result;
     }
   private:
-    QString m_tag;
+    int m_tagId;
 };
 
 #endif /* COUNTER_H */
@@ -5,19 +5,23 @@
 #include <QString>
 
 #include "util/stat.h"
-#include "util/duration.h"
 
 class Event {
   public:
-    Event()
-            : m_type(Stat::UNSPECIFIED) {
+    typedef Stat::StatType EventType;
+
+    // Use a tag id from Stat::registerTag() in code that runs frequently
+    static bool event(int tagId, Event::EventType type = Stat::EVENT) {
+        return Stat::track(tagId, type, Stat::experimentFlags(Stat::COUNT), 0.0);
     }
 
-    typedef Stat::StatType EventType;
+    static bool start(int tagId) {
+        return event(tagId, Stat::EVENT_START);
+    }
 
-    QString m_tag;
-    EventType m_type;
-    mixxx::Duration m_time;
+    static bool end(int tagId) {
+        return event(tagId, Stat::EVENT_END);
+    }
 
     static bool event(const QString& tag, Event::EventType type = Stat::EVENT) {
         return Stat::track(tag, type, Stat::experimentFlags(Stat::COUNT), 0.0);
@@ -33,8 +37,8 @@ class Event {
 
     // Disallow to use this class with implicit converted char strings.
     // This should not be uses to avoid unicode encoding and memory
-    // allocation at every call. Use a static tag like this:
-    // static const QString tag("TAG TEXT");
+    // allocation at every call. Register the tag once with
+    // Stat::registerTag() instead.
     static bool event(const char*, Event::EventType) = delete;
     static bool start(const char*) = delete;
     static bool end(const char*) = delete;
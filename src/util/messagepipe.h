@@ -28,6 +28,12 @@ class MessagePipe {
         return m_sender_messages.size();
     }
 
+    // Returns the next ReceiverMessageType message without removing it, or
+    // nullptr if no message is waiting. Non-blocking.
+    ReceiverMessageType* peekMessage() {
+        return m_sender_messages.front();
+    }
+
     // Try to read read a ReceiverMessageType written by the receiver
     // addressed to the sender. Non-blocking.
     bool readMessage(ReceiverMessageType* message) {
@@ -45,6 +51,15 @@ class MessagePipe {
         return m_receiver_messages.try_push(message);
     }
 
+    // Returns the number of SenderMessageType messages that can be written
+    // before the pipe is full. Non-blocking. The receiver may only increase
+    // this number concurrently by reading messages.
+    int writeAvailable() const {
+        // One slot of the queue always remains unused
+        return static_cast<int>(m_receiver_messages.capacity() - 1 -
+                m_receiver_messages.size());
+    }
+
   private:
     rigtorp::SPSCQueue<SenderMessageType>& m_receiver_messages;
     rigtorp::SPSCQueue<ReceiverMessageType>& m_sender_messages;
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "util/assert.h"
+#include "util/class.h"
+
+// RcuPointer publishes immutable snapshots of a value to readers that must
+// never block, e.g. the engine thread (read-copy-update).
+//
+// Readers enter a read-side section by creating a ReadLock, which costs an
+// atomic increment and decrement and never waits for anything. Writers
+// create a modified copy of the current snapshot and publish it with an
+// atomic pointer swap. The replaced snapshot is retired and only deleted by
+// a later publish() once no reader is inside a read-side section anymore,
+// or when the RcuPointer is destroyed. Readers therefore never delete
+// snapshots, not even when they have been the last ones to access them.
+//
+// Writers must be serialized by the caller, e.g. by a mutex that is only
+// ever locked by writers.
+template<typename T>
+class RcuPointer {
+  public:
+    // Grants access to the snapshot that was current when the lock was
+    // created. Must not outlive the RcuPointer.
+    class ReadLock {
+      public:
+        explicit ReadLock(const RcuPointer* pOwner)
+                : m_pOwner(pOwner) {
+            // Sequentially consistent, see publish()
+            m_pOwner->m_readers.fetch_add(1);
+            m_pSnapshot = m_pOwner->m_pCurrent.load();
+        }
+        ReadLock(ReadLock&& other)
+                : m_pOwner(other.m_pOwner),
+                  m_pSnapshot(other.m_pSnapshot) {
+            other.m_pOwner = nullptr;
+            other.m_pSnapshot = nullptr;
+        }
+        ~ReadLock() {
+            if (m_pOwner) {
+                m_pOwner->m_readers.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        const T* get() const {
+            return m_pSnapshot;
+        }
+        const T& operator*() const {
+            return *m_pSnapshot;
+        }
+        const T* operator->() const {
+            return m_pSnapshot;
+        }
+
+      private:
+        const RcuPointer* m_pOwner;
+        const T* m_pSnapshot;
+
+        DISALLOW_COPY_AND_ASSIGN(ReadLock);
+    };
+
+    explicit RcuPointer(std::unique_ptr<const T> pSnapshot)
+            : m_pCurrent(pSnapshot.release()),
+              m_readers(0) {
+        DEBUG_ASSERT(m_pCurrent.load());
+    }
+    ~RcuPointer() {
+        DEBUG_ASSERT(m_readers.load() == 0);
+        delete m_pCurrent.load();
+    }
+
+    ReadLock read() const {
+        return ReadLock(this);
+    }
+
+    // Replaces the current snapshot. Retired snapshots are deleted on the
+    // calling thread as soon as it is safe.
+    void publish(std::unique_ptr<const T> pSnapshot) {
+        DEBUG_ASSERT(pSnapshot);
+        m_retired.emplace_back(m_pCurrent.exchange(pSnapshot.release()));
+        // A reader that still holds a retired snapshot has loaded it before
+        // the exchange above and has incremented the counter before that.
+        // If no reader is active after the exchange, all readers that start
+        // from now on only see the new snapshot.
+        if (m_readers.load() == 0) {
+            m_retired.clear();
+        }
+    }
+
+    // The number of replaced snapshots that are still waiting for readers
+    // to leave their read-side sections.
+    int retiredCount() const {
+        return static_cast<int>(m_retired.size());
+    }
+
+  private:
+    std::atomic<const T*> m_pCurrent;
+    mutable std::atomic<int> m_readers;
+    // Only accessed by writers
+    std::vector<std::unique_ptr<const T>> m_retired;
+
+    DISALLOW_COPY_AND_ASSIGN(RcuPointer);
+};
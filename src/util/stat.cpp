@@ -1,22 +1,169 @@
+#include <cmath>
 #include <limits>
 
+#include <QHash>
+#include <QMutex>
+#include <QPair>
 #include <QStringList>
+#include <QVector>
 #include <QtDebug>
 
 #include "util/stat.h"
 #include "util/time.h"
 #include "util/math.h"
+#include "util/memory.h"
+#include "util/rcupointer.h"
 #include "util/statsmanager.h"
 
+namespace {
+
+// Tags are never unregistered, so ids stay valid until Mixxx exits.
+struct StatTagRegistry {
+    QVector<QString> names;
+    QHash<QString, int> ids;
+    QHash<QPair<quintptr, QString>, int> formattedIds;
+    QHash<QPair<quintptr, int>, int> formattedIntIds;
+    QHash<QPair<int, quintptr>, int> suffixedIds;
+};
+
+// Reporting threads look up tags without locking, writers copy the registry
+// and publish the modified copy.
+RcuPointer<StatTagRegistry>& tagRegistry() {
+    static RcuPointer<StatTagRegistry> s_registry(
+            std::make_unique<StatTagRegistry>());
+    return s_registry;
+}
+
+// Tags may be registered during static initialization
+QMutex& tagRegistryWriteMutex() {
+    static QMutex s_mutex;
+    return s_mutex;
+}
+
+template<typename Key>
+int lookupTag(QHash<Key, int> StatTagRegistry::*pIds, const Key& key) {
+    const auto registry = tagRegistry().read();
+    return ((*registry).*pIds).value(key, Stat::kInvalidTagId);
+}
+
+// Must be called with tagRegistryWriteMutex() locked
+int insertTag(StatTagRegistry* pRegistry, const QString& tag) {
+    int id = pRegistry->ids.value(tag, Stat::kInvalidTagId);
+    if (id == Stat::kInvalidTagId) {
+        id = pRegistry->names.size();
+        pRegistry->names.append(tag);
+        pRegistry->ids.insert(tag, id);
+    }
+    return id;
+}
+
+template<typename Key, typename MakeTag>
+int registerCachedTag(QHash<Key, int> StatTagRegistry::*pIds,
+        const Key& key,
+        MakeTag makeTag) {
+    int id = lookupTag(pIds, key);
+    if (id != Stat::kInvalidTagId) {
+        return id;
+    }
+    QMutexLocker locker(&tagRegistryWriteMutex());
+    auto pRegistry = std::make_unique<StatTagRegistry>(*tagRegistry().read());
+    id = (*pRegistry.*pIds).value(key, Stat::kInvalidTagId);
+    if (id != Stat::kInvalidTagId) {
+        return id;
+    }
+    id = insertTag(pRegistry.get(), makeTag());
+    (*pRegistry.*pIds).insert(key, id);
+    tagRegistry().publish(std::move(pRegistry));
+    return id;
+}
+
+} // anonymous namespace
+
+// static
+int Stat::registerTag(const QString& tag) {
+    int id = lookupTag(&StatTagRegistry::ids, tag);
+    if (id != kInvalidTagId) {
+        return id;
+    }
+    QMutexLocker locker(&tagRegistryWriteMutex());
+    auto pRegistry = std::make_unique<StatTagRegistry>(*tagRegistry().read());
+    id = insertTag(pRegistry.get(), tag);
+    tagRegistry().publish(std::move(pRegistry));
+    return id;
+}
+
+// static
+int Stat::registerTag(const char* format, const QString& arg) {
+    return registerCachedTag(&StatTagRegistry::formattedIds,
+            qMakePair(reinterpret_cast<quintptr>(format), arg),
+            [format, &arg] {
+                return arg.isEmpty() ? QString(format) : QString(format).arg(arg);
+            });
+}
+
+// static
+int Stat::registerTag(const char* format, int arg) {
+    return registerCachedTag(&StatTagRegistry::formattedIntIds,
+            qMakePair(reinterpret_cast<quintptr>(format), arg),
+            [format, arg] {
+                return QString(format).arg(arg);
+            });
+}
+
+// static
+int Stat::registerTag(int tagId, const char* suffix) {
+    return registerCachedTag(&StatTagRegistry::suffixedIds,
+            qMakePair(tagId, reinterpret_cast<quintptr>(suffix)),
+            [tagId, suffix] {
+                return tagName(tagId) + suffix;
+            });
+}
+
+// static
+QString Stat::tagName(int tagId) {
+    const auto registry = tagRegistry().read();
+    return registry->names.value(tagId);
+}
+
+// static
+int Stat::tagCount() {
+    const auto registry = tagRegistry().read();
+    return registry->names.size();
+}
+
+// static
+int Stat::histogramBucket(double value) {
+    if (!(value >= 1.0)) {
+        return 0;
+    }
+    int exponent;
+    // value = fraction * 2^exponent with fraction in [0.5, 1)
+    std::frexp(value, &exponent);
+    return math_min(exponent, kHistogramBuckets - 1);
+}
+
+// static
+double Stat::histogramBucketMin(int bucket) {
+    if (bucket <= 0) {
+        return -std::numeric_limits<double>::infinity();
+    }
+    return std::ldexp(1.0, bucket - 1);
+}
+
 Stat::Stat()
-        : m_type(UNSPECIFIED),
+        : m_tagId(kInvalidTagId),
+          m_type(UNSPECIFIED),
           m_compute(NONE),
           m_report_count(0),
           m_sum(0),
           m_min(std::numeric_limits<double>::max()),
           m_max(std::numeric_limits<double>::min()),
           m_variance_mk(0),
-          m_variance_sk(0) {
+          m_variance_sk(0),
+          m_median(0.5),
+          m_percentile90(0.9),
+          m_percentile99(0.99) {
+    std::fill(m_histogram, m_histogram + kHistogramBuckets, 0.0);
 }
 
 QString Stat::valueUnits() const {
@@ -61,12 +208,17 @@ void Stat::processReport(const StatReport& report) {
         }
     }
 
-    if (m_compute & Stat::HISTOGRAM) {
-        m_histogram[report.value] += 1.0;
+    if (m_compute & Stat::SAMPLE_MEDIAN) {
+        m_median.add(report.value);
+    }
+
+    if (m_compute & Stat::SAMPLE_PERCENTILES) {
+        m_percentile90.add(report.value);
+        m_percentile99.add(report.value);
     }
 
-    if (m_compute & Stat::VALUES) {
-        m_values.push_back(report.value);
+    if (m_compute & Stat::HISTOGRAM) {
+        m_histogram[histogramBucket(report.value)] += 1.0;
     }
 }
 
@@ -119,15 +271,21 @@ QDebug operator<<(QDebug dbg, const Stat &stat) {
     }
 
     if (stat.m_compute & Stat::SAMPLE_MEDIAN) {
-        // TODO(rryan): implement
+        stats << "median=" + QString::number(stat.m_median.value()) + stat.valueUnits();
+    }
+
+    if (stat.m_compute & Stat::SAMPLE_PERCENTILES) {
+        stats << "p90=" + QString::number(stat.m_percentile90.value()) + stat.valueUnits();
+        stats << "p99=" + QString::number(stat.m_percentile99.value()) + stat.valueUnits();
     }
 
     if (stat.m_compute & Stat::HISTOGRAM) {
         QStringList histogram;
-        for (auto it = stat.m_histogram.constBegin();
-             it != stat.m_histogram.constEnd(); ++it) {
-            histogram << QString::number(it.key()) + stat.valueUnits() + ":" +
-                    QString::number(it.value());
+        for (int i = 0; i < Stat::kHistogramBuckets; ++i) {
+            if (stat.m_histogram[i] > 0.0) {
+                histogram << ">=" + QString::number(Stat::histogramBucketMin(i)) +
+                        stat.valueUnits() + ":" + QString::number(stat.m_histogram[i]);
+            }
         }
         stats << "histogram=" + histogram.join(",");
     }
@@ -137,15 +295,18 @@ QDebug operator<<(QDebug dbg, const Stat &stat) {
 }
 
 // static
-bool Stat::track(QString tag,
+bool Stat::track(int tagId,
                  Stat::StatType type,
                  Stat::ComputeFlags compute,
                  double value) {
     if (!StatsManager::s_bStatsManagerEnabled) {
         return false;
     }
+    VERIFY_OR_DEBUG_ASSERT(tagId != kInvalidTagId) {
+        return false;
+    }
     StatReport report;
-    report.tag = std::move(tag);
+    report.tagId = tagId;
     report.type = type;
     report.compute = compute;
     report.time = mixxx::Time::elapsed().toIntegerNanos();
@@ -153,3 +314,14 @@ bool Stat::track(QString tag,
     StatsManager* pManager = StatsManager::instance();
     return pManager && pManager->maybeWriteReport(std::move(report));
 }
+
+// static
+bool Stat::track(const QString& tag,
+                 Stat::StatType type,
+                 Stat::ComputeFlags compute,
+                 double value) {
+    if (!StatsManager::s_bStatsManagerEnabled) {
+        return false;
+    }
+    return track(registerTag(tag), type, compute, value);
+}
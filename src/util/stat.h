@@ -1,10 +1,9 @@
 #pragma once
 
-#include <QMap>
-#include <QVector>
 #include <QString>
 
 #include "util/experiment.h"
+#include "util/streamingquantile.h"
 
 struct StatReport;
 
@@ -54,17 +53,15 @@ class Stat {
         AVERAGE         = 0x0004,
         // O(1) in time and space.
         SAMPLE_VARIANCE = 0x0008,
+        // O(1) in time and space, estimated
         SAMPLE_MEDIAN   = 0x0010,
         // O(1) in time and space.
         MIN             = 0x0020,
         // O(1) in time and space.
         MAX             = 0x0040,
-        // O(1) in time, O(k) in space where k is # of distinct values.
-        // Use carefully!
+        // O(1) in time and space. Counts the reports in buckets that are
+        // twice as wide as the previous one.
         HISTOGRAM       = 0x0080,
-        // O(1) in time, O(n) in space where n is the # of reports.
-        // Use carefully!
-        VALUES          = 0x0100,
         // TODO, track average reports per second
         REPORTS_PER_SECOND = 0x0200,
         // TODO, track the time in between received reports.
@@ -73,6 +70,8 @@ class Stat {
         STATS_EXPERIMENT  = 0x0800,
         // Used for marking stats recorded in BASE mode.
         STATS_BASE        = 0x1000,
+        // O(1) in time and space, estimated 90th and 99th percentile
+        SAMPLE_PERCENTILES = 0x2000,
     };
     typedef int ComputeFlags;
 
@@ -97,6 +96,34 @@ class Stat {
         }
     }
 
+    // Bucket 0 counts all values below 1, bucket i > 0 the values in
+    // [2^(i-1), 2^i). The last bucket also counts all larger values.
+    static constexpr int kHistogramBuckets = 64;
+    static int histogramBucket(double value);
+    // The lower bound of a bucket
+    static double histogramBucketMin(int bucket);
+
+    static constexpr int kInvalidTagId = -1;
+
+    // Returns the id of a tag, registering it first if necessary. Look up
+    // the id once and report with it afterwards, e.g. by storing it when
+    // the object that reports the stat is constructed. Looking up tags
+    // that are already registered is thread-safe and never blocks or
+    // allocates.
+    static int registerTag(const QString& tag);
+    // Registers the tag QString(format).arg(arg), or format if arg is
+    // empty. The result is cached by the address of format, so the tag
+    // string is only built once for each arg. format must be a string
+    // literal.
+    static int registerTag(const char* format, const QString& arg);
+    static int registerTag(const char* format, int arg);
+    // Registers the tag with the given suffix appended, cached by the
+    // address of suffix which must be a string literal.
+    static int registerTag(int tagId, const char* suffix);
+    // Returns an empty string for unknown ids
+    static QString tagName(int tagId);
+    static int tagCount();
+
     explicit Stat();
     void processReport(const StatReport& report);
     QString valueUnits() const;
@@ -106,26 +133,34 @@ class Stat {
     }
 
     QString m_tag;
+    int m_tagId;
     StatType m_type;
     ComputeFlags m_compute;
-    QVector<double> m_values;
     double m_report_count;
     double m_sum;
     double m_min;
     double m_max;
     double m_variance_mk;
     double m_variance_sk;
-    QMap<double, double> m_histogram;
+    StreamingQuantile m_median;
+    StreamingQuantile m_percentile90;
+    StreamingQuantile m_percentile99;
+    double m_histogram[kHistogramBuckets];
 
-    static bool track(QString tag,
+    static bool track(int tagId,
+                      Stat::StatType type,
+                      Stat::ComputeFlags compute,
+                      double value);
+    // Only registers the tag if stats are enabled
+    static bool track(const QString& tag,
                       Stat::StatType type,
                       Stat::ComputeFlags compute,
                       double value);
 
     // Disallow to use this class with implicit converted char strings.
     // This should not be uses to avoid unicode encoding and memory
-    // allocation at every call. Use a static tag like this:
-    // static const QString tag("TAG TEXT");
+    // allocation at every call. Register the tag once with registerTag()
+    // and report with its id instead.
     static bool track(const char *,
                       Stat::StatType,
                       Stat::ComputeFlags,
@@ -134,8 +169,9 @@ class Stat {
 
 QDebug operator<<(QDebug dbg, const Stat &stat);
 
+// Trivially copyable, so reporting a stat never allocates
 struct StatReport {
-    QString tag;
+    int tagId;
     qint64 time;
     Stat::StatType type;
     Stat::ComputeFlags compute;
@@ -16,6 +16,8 @@ StatModel::StatModel(QObject* pParent)
     setHeaderData(STAT_COLUMN_MEAN, Qt::Horizontal, tr("Mean"));
     setHeaderData(STAT_COLUMN_VARIANCE, Qt::Horizontal, tr("Variance"));
     setHeaderData(STAT_COLUMN_STDDEV, Qt::Horizontal, tr("Standard Deviation"));
+    setHeaderData(STAT_COLUMN_MEDIAN, Qt::Horizontal, tr("Median"));
+    setHeaderData(STAT_COLUMN_P99, Qt::Horizontal, tr("99th Percentile"));
 }
 
 StatModel::~StatModel() {
@@ -91,6 +93,12 @@ QVariant StatModel::data(const QModelIndex& index,
             return sqrt(stat.variance());
         case STAT_COLUMN_UNITS:
             return stat.valueUnits();
+        case STAT_COLUMN_MEDIAN:
+            return (stat.m_compute & Stat::SAMPLE_MEDIAN) ?
+                    QVariant(stat.m_median.value()) : QVariant("XXX");
+        case STAT_COLUMN_P99:
+            return (stat.m_compute & Stat::SAMPLE_PERCENTILES) ?
+                    QVariant(stat.m_percentile99.value()) : QVariant("XXX");
     }
     return QVariant();
 }
@@ -1,8 +1,7 @@
 #include <QtDebug>
 #include <QMutexLocker>
-#include <QTextStream>
-#include <QFile>
 #include <QMetaType>
+#include <algorithm>
 
 #include "util/statsmanager.h"
 #include "util/cmdlineargs.h"
@@ -30,6 +29,9 @@ StatsPipe::~StatsPipe() {
 StatsManager::StatsManager()
         : QThread(),
           m_quit(0) {
+    if (CmdlineArgs::Instance().getTimelineEnabled()) {
+        m_timeline.open(CmdlineArgs::Instance().getTimelinePath());
+    }
     s_bStatsManagerEnabled = true;
     setObjectName("StatsManager");
     moveToThread(this);
@@ -41,124 +43,50 @@ StatsManager::~StatsManager() {
     m_quit = 1;
     m_statsPipeCondition.wakeAll();
     wait();
+    m_timeline.close();
     qDebug() << "StatsManager shutdown report:";
+    logStats("ALL STATS", m_stats);
+    logStats("BASE STATS", m_baseStats);
+    logStats("EXPERIMENT STATS", m_experimentStats);
     qDebug() << "=====================================";
-    qDebug() << "ALL STATS";
-    qDebug() << "=====================================";
-    for (auto it = m_stats.constBegin();
-         it != m_stats.constEnd(); ++it) {
-        qDebug() << it.value();
-    }
+}
 
-    if (!m_baseStats.isEmpty()) {
-        qDebug() << "=====================================";
-        qDebug() << "BASE STATS";
-        qDebug() << "=====================================";
-        for (auto it = m_baseStats.constBegin();
-             it != m_baseStats.constEnd(); ++it) {
-            qDebug() << it.value();
+// static
+void StatsManager::logStats(const char* title, const QVector<Stat>& stats) {
+    QList<const Stat*> sortedStats;
+    for (const auto& stat : stats) {
+        if (stat.m_tagId != Stat::kInvalidTagId) {
+            sortedStats.append(&stat);
         }
     }
-
-    if (!m_experimentStats.isEmpty()) {
-        qDebug() << "=====================================";
-        qDebug() << "EXPERIMENT STATS";
-        qDebug() << "=====================================";
-        for (auto it = m_experimentStats.constBegin();
-             it != m_experimentStats.constEnd(); ++it) {
-            qDebug() << it.value();
-        }
+    if (sortedStats.isEmpty()) {
+        return;
     }
+    std::sort(sortedStats.begin(), sortedStats.end(),
+            [](const Stat* pStat1, const Stat* pStat2) {
+                return pStat1->m_tag < pStat2->m_tag;
+            });
     qDebug() << "=====================================";
-
-    if (CmdlineArgs::Instance().getTimelineEnabled()) {
-        writeTimeline(CmdlineArgs::Instance().getTimelinePath());
-    }
-}
-
-class OrderByTime {
-  public:
-    inline bool operator()(const Event& e1, const Event& e2) {
-        return e1.m_time < e2.m_time;
-    }
-};
-
-QString humanizeNanos(qint64 nanos) {
-    double seconds = static_cast<double>(nanos) / 1e9;
-    if (seconds > 1) {
-        return QString("%1s").arg(QString::number(seconds));
-    }
-
-    double millis = static_cast<double>(nanos) / 1e6;
-    if (millis > 1) {
-        return QString("%1ms").arg(QString::number(millis));
-    }
-
-    double micros = static_cast<double>(nanos) / 1e3;
-    if (micros > 1) {
-        return QString("%1us").arg(QString::number(micros));
+    qDebug() << title;
+    qDebug() << "=====================================";
+    for (const auto* pStat : sortedStats) {
+        qDebug() << *pStat;
     }
-
-    return QString("%1ns").arg(QString::number(nanos));
 }
 
-void StatsManager::writeTimeline(const QString& filename) {
-    QFile timeline(filename);
-    if (!timeline.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        qDebug() << "Could not open timeline file for writing:"
-                 << timeline.fileName();
-        return;
-    }
-
-    if (m_events.isEmpty()) {
-        qDebug() << "No events recorded.";
-        return;
-    }
-
-    // Sort by time.
-    std::sort(m_events.begin(), m_events.end(), OrderByTime());
-
-    mixxx::Duration last_time = m_events[0].m_time;
-
-    QMap<QString, qint64> startTimes;
-    QMap<QString, qint64> endTimes;
-
-    QTextStream out(&timeline);
-    foreach (const Event& event, m_events) {
-        qint64 last_start = startTimes.value(event.m_tag, -1);
-        qint64 last_end = endTimes.value(event.m_tag, -1);
-
-        qint64 duration_since_last_start = last_start == -1 ? 0 :
-                event.m_time.toIntegerNanos() - last_start;
-        qint64 duration_since_last_end = last_end == -1 ? 0 :
-                event.m_time.toIntegerNanos() - last_end;
-
-        if (event.m_type == Stat::EVENT_START) {
-            // We last saw a start and we just saw another start.
-            if (last_start > last_end) {
-                qDebug() << "Mismatched start/end pair" << event.m_tag;
-            }
-            startTimes[event.m_tag] = event.m_time.toIntegerNanos();
-        } else if (event.m_type == Stat::EVENT_END) {
-            // We last saw an end and we just saw another end.
-            if (last_end > last_start) {
-                qDebug() << "Mismatched start/end pair" << event.m_tag;
-            }
-            endTimes[event.m_tag] = event.m_time.toIntegerNanos();
-        }
-
-        // TODO(rryan): CSV escaping
-        qint64 elapsed = (event.m_time - last_time).toIntegerNanos();
-        out << event.m_time.toIntegerNanos() << ","
-            << "+" << humanizeNanos(elapsed) << ","
-            << "+" << humanizeNanos(duration_since_last_start) << ","
-            << "+" << humanizeNanos(duration_since_last_end) << ","
-            << Stat::statTypeToString(event.m_type) << ","
-            << event.m_tag << "\n";
-        last_time = event.m_time;
-    }
-
-    timeline.close();
+// static
+Stat& StatsManager::statForReport(QVector<Stat>* pStats, const StatReport& report) {
+    if (report.tagId >= pStats->size()) {
+        pStats->resize(report.tagId + 1);
+    }
+    Stat& stat = (*pStats)[report.tagId];
+    if (stat.m_tagId == Stat::kInvalidTagId) {
+        stat.m_tagId = report.tagId;
+        stat.m_tag = Stat::tagName(report.tagId);
+    }
+    stat.m_type = report.type;
+    stat.m_compute = report.compute;
+    return stat;
 }
 
 void StatsManager::onStatsPipeDestroyed(StatsPipe* pPipe) {
@@ -200,37 +128,25 @@ void StatsManager::processIncomingStatReports() {
     StatReport report;
     foreach (StatsPipe* pStatsPipe, m_statsPipes) {
         while (pStatsPipe->dequeue(&report)) {
-            QString tag = report.tag;
-            Stat& info = m_stats[tag];
-            info.m_tag = tag;
-            info.m_type = report.type;
-            info.m_compute = report.compute;
+            Stat& info = statForReport(&m_stats, report);
             info.processReport(report);
             emit statUpdated(info);
 
             if (report.compute & Stat::STATS_EXPERIMENT) {
-                Stat& experiment = m_experimentStats[tag];
-                experiment.m_tag = tag;
-                experiment.m_type = report.type;
-                experiment.m_compute = report.compute;
-                experiment.processReport(report);
+                statForReport(&m_experimentStats, report).processReport(report);
             } else if (report.compute & Stat::STATS_BASE) {
-                Stat& base = m_baseStats[tag];
-                base.m_tag = tag;
-                base.m_type = report.type;
-                base.m_compute = report.compute;
-                base.processReport(report);
+                statForReport(&m_baseStats, report).processReport(report);
             }
 
-            if (CmdlineArgs::Instance().getTimelineEnabled() &&
+            if (m_timeline.isOpen() &&
                     (report.type == Stat::EVENT ||
                      report.type == Stat::EVENT_START ||
                      report.type == Stat::EVENT_END)) {
-                Event event;
-                event.m_tag = tag;
-                event.m_type = report.type;
-                event.m_time = mixxx::Duration::fromNanos(report.time);
-                m_events.append(event);
+                StatTimeline::Event event;
+                event.timeNanos = report.time;
+                event.tagId = report.tagId;
+                event.type = report.type;
+                m_timeline.writeEvent(event);
             }
         }
     }
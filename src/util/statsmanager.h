@@ -1,6 +1,5 @@
 #pragma once
 
-#include <QMap>
 #include <QObject>
 #include <QString>
 #include <QThread>
@@ -10,12 +9,13 @@
 #include <QWaitCondition>
 #include <QThreadStorage>
 #include <QList>
+#include <QVector>
 
 #include "rigtorp/SPSCQueue.h"
 
 #include "util/singleton.h"
 #include "util/stat.h"
-#include "util/event.h"
+#include "util/stattimeline.h"
 
 class StatsManager;
 
@@ -77,14 +77,17 @@ class StatsManager : public QThread, public Singleton<StatsManager> {
     void processIncomingStatReports();
     StatsPipe* getStatsPipeForThread();
     void onStatsPipeDestroyed(StatsPipe* pPipe);
-    void writeTimeline(const QString& filename);
+    static Stat& statForReport(QVector<Stat>* pStats, const StatReport& report);
+    static void logStats(const char* title, const QVector<Stat>& stats);
 
     QAtomicInt m_emitAllStats;
     QAtomicInt m_quit;
-    QMap<QString, Stat> m_stats;
-    QMap<QString, Stat> m_baseStats;
-    QMap<QString, Stat> m_experimentStats;
-    QList<Event> m_events;
+    // Indexed by tag id
+    QVector<Stat> m_stats;
+    QVector<Stat> m_baseStats;
+    QVector<Stat> m_experimentStats;
+    // Guarded by m_statsPipeLock
+    StatTimelineWriter m_timeline;
 
     QWaitCondition m_statsPipeCondition;
     QMutex m_statsPipeLock;
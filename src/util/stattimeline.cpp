@@ -0,0 +1,126 @@
+#include "util/stattimeline.h"
+
+#include <QtDebug>
+#include <cstring>
+
+#include "util/assert.h"
+
+StatTimelineWriter::StatTimelineWriter() {
+    m_stream.setByteOrder(QDataStream::LittleEndian);
+}
+
+StatTimelineWriter::~StatTimelineWriter() {
+    close();
+}
+
+bool StatTimelineWriter::open(const QString& fileName) {
+    close();
+    m_file.setFileName(fileName);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Could not open timeline file for writing:"
+                   << m_file.fileName();
+        return false;
+    }
+    m_stream.setDevice(&m_file);
+    m_stream.writeRawData(StatTimeline::kMagic, StatTimeline::kMagicLength);
+    m_writtenTags.clear();
+    return true;
+}
+
+void StatTimelineWriter::close() {
+    if (!m_file.isOpen()) {
+        return;
+    }
+    m_stream.setDevice(nullptr);
+    m_file.close();
+}
+
+void StatTimelineWriter::writeTag(int tagId) {
+    if (tagId >= m_writtenTags.size()) {
+        m_writtenTags.resize(tagId + 1);
+    }
+    if (m_writtenTags[tagId]) {
+        return;
+    }
+    m_writtenTags[tagId] = true;
+    const QByteArray name = Stat::tagName(tagId).toUtf8().left(0xFFFF);
+    m_stream << static_cast<quint8>(StatTimeline::kTagRecord)
+             << static_cast<quint32>(tagId)
+             << static_cast<quint16>(name.size());
+    m_stream.writeRawData(name.constData(), name.size());
+}
+
+void StatTimelineWriter::writeEvent(const StatTimeline::Event& event) {
+    VERIFY_OR_DEBUG_ASSERT(isOpen() && event.tagId >= 0) {
+        return;
+    }
+    writeTag(event.tagId);
+    m_stream << static_cast<quint8>(StatTimeline::kEventRecord)
+             << static_cast<quint8>(event.type)
+             << static_cast<quint32>(event.tagId)
+             << static_cast<qint64>(event.timeNanos);
+}
+
+StatTimelineReader::StatTimelineReader()
+        : m_error(false) {
+    m_stream.setByteOrder(QDataStream::LittleEndian);
+}
+
+bool StatTimelineReader::open(const QString& fileName) {
+    m_tags.clear();
+    m_error = false;
+    m_file.setFileName(fileName);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not open timeline file for reading:"
+                   << m_file.fileName();
+        m_error = true;
+        return false;
+    }
+    m_stream.setDevice(&m_file);
+    char magic[StatTimeline::kMagicLength];
+    if (m_stream.readRawData(magic, StatTimeline::kMagicLength) !=
+                    StatTimeline::kMagicLength ||
+            memcmp(magic, StatTimeline::kMagic, StatTimeline::kMagicLength) != 0) {
+        qWarning() << "Not a timeline file:" << m_file.fileName();
+        m_error = true;
+        return false;
+    }
+    return true;
+}
+
+bool StatTimelineReader::readEvent(StatTimeline::Event* pEvent) {
+    while (!m_error && !m_stream.atEnd()) {
+        quint8 kind;
+        m_stream >> kind;
+        if (kind == StatTimeline::kTagRecord) {
+            quint32 tagId;
+            quint16 length;
+            m_stream >> tagId >> length;
+            QByteArray name(length, '\0');
+            if (m_stream.readRawData(name.data(), length) != length) {
+                m_error = true;
+                break;
+            }
+            m_tags.insert(static_cast<int>(tagId), QString::fromUtf8(name));
+        } else if (kind == StatTimeline::kEventRecord) {
+            quint8 type;
+            quint32 tagId;
+            qint64 timeNanos;
+            m_stream >> type >> tagId >> timeNanos;
+            if (m_stream.status() != QDataStream::Ok) {
+                m_error = true;
+                break;
+            }
+            pEvent->type = static_cast<Stat::StatType>(type);
+            pEvent->tagId = static_cast<int>(tagId);
+            pEvent->timeNanos = timeNanos;
+            return true;
+        } else {
+            m_error = true;
+        }
+    }
+    if (m_error) {
+        qWarning() << "Timeline file is corrupt:" << m_file.fileName();
+    }
+    return false;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <QDataStream>
+#include <QFile>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include "util/class.h"
+#include "util/stat.h"
+
+// The timeline of stat events that is written with --timelinePath. It is
+// streamed to disk while Mixxx is running, so its memory usage does not grow
+// with the length of the session. scripts/stattimeline.py converts it into
+// a CSV file.
+//
+// The file starts with the 8 bytes "MIXXXTL1", followed by records that each
+// start with a one byte kind. All numbers are little-endian.
+//
+//   Tag record:   quint32 tag id, quint16 length, UTF-8 tag name
+//   Event record: quint8 Stat::StatType, quint32 tag id,
+//                 qint64 nanoseconds since Mixxx startup
+//
+// The tag record of an id precedes all events that refer to it. Events are
+// written in the order they have been received from the reporting threads,
+// which is not necessarily the order of their times.
+namespace StatTimeline {
+
+constexpr char kMagic[] = "MIXXXTL1";
+constexpr int kMagicLength = 8;
+enum RecordKind : quint8 {
+    kTagRecord = 1,
+    kEventRecord = 2,
+};
+
+struct Event {
+    qint64 timeNanos;
+    int tagId;
+    Stat::StatType type;
+};
+
+} // namespace StatTimeline
+
+class StatTimelineWriter final {
+  public:
+    StatTimelineWriter();
+    ~StatTimelineWriter();
+
+    bool open(const QString& fileName);
+    bool isOpen() const {
+        return m_file.isOpen();
+    }
+    void close();
+
+    void writeEvent(const StatTimeline::Event& event);
+
+  private:
+    void writeTag(int tagId);
+
+    QFile m_file;
+    QDataStream m_stream;
+    QVector<bool> m_writtenTags;
+
+    DISALLOW_COPY_AND_ASSIGN(StatTimelineWriter);
+};
+
+class StatTimelineReader final {
+  public:
+    StatTimelineReader();
+
+    bool open(const QString& fileName);
+
+    // Returns false at the end of the file or if the file is corrupt, see
+    // hasError().
+    bool readEvent(StatTimeline::Event* pEvent);
+    bool hasError() const {
+        return m_error;
+    }
+
+    QString tagName(int tagId) const {
+        return m_tags.value(tagId);
+    }
+
+  private:
+    QFile m_file;
+    QDataStream m_stream;
+    QHash<int, QString> m_tags;
+    bool m_error;
+
+    DISALLOW_COPY_AND_ASSIGN(StatTimelineReader);
+};
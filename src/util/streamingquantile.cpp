@@ -0,0 +1,106 @@
+#include "util/streamingquantile.h"
+
+#include <algorithm>
+
+#include "util/assert.h"
+
+StreamingQuantile::StreamingQuantile(double quantile)
+        : m_quantile(quantile),
+          m_count(0) {
+    DEBUG_ASSERT(quantile > 0.0 && quantile < 1.0);
+    clear();
+}
+
+void StreamingQuantile::clear() {
+    m_count = 0;
+    std::fill(m_heights, m_heights + kMarkers, 0.0);
+    for (int i = 0; i < kMarkers; ++i) {
+        m_positions[i] = i + 1;
+    }
+    const double p = m_quantile;
+    m_desiredPositions[0] = 1.0;
+    m_desiredPositions[1] = 1.0 + 2.0 * p;
+    m_desiredPositions[2] = 1.0 + 4.0 * p;
+    m_desiredPositions[3] = 3.0 + 2.0 * p;
+    m_desiredPositions[4] = 5.0;
+    m_increments[0] = 0.0;
+    m_increments[1] = p / 2.0;
+    m_increments[2] = p;
+    m_increments[3] = (1.0 + p) / 2.0;
+    m_increments[4] = 1.0;
+}
+
+void StreamingQuantile::add(double value) {
+    if (m_count < kMarkers) {
+        m_heights[m_count++] = value;
+        if (m_count == kMarkers) {
+            std::sort(m_heights, m_heights + kMarkers);
+        }
+        return;
+    }
+    ++m_count;
+
+    // Find the cell that contains the value and extend the extreme markers
+    int cell;
+    if (value < m_heights[0]) {
+        m_heights[0] = value;
+        cell = 0;
+    } else if (value >= m_heights[kMarkers - 1]) {
+        m_heights[kMarkers - 1] = value;
+        cell = kMarkers - 2;
+    } else {
+        cell = 0;
+        while (value >= m_heights[cell + 1]) {
+            ++cell;
+        }
+    }
+    for (int i = cell + 1; i < kMarkers; ++i) {
+        m_positions[i] += 1.0;
+    }
+    for (int i = 0; i < kMarkers; ++i) {
+        m_desiredPositions[i] += m_increments[i];
+    }
+
+    // Move the inner markers towards their desired positions
+    for (int i = 1; i < kMarkers - 1; ++i) {
+        const double delta = m_desiredPositions[i] - m_positions[i];
+        if ((delta >= 1.0 && m_positions[i + 1] - m_positions[i] > 1.0) ||
+                (delta <= -1.0 && m_positions[i - 1] - m_positions[i] < -1.0)) {
+            const int d = delta > 0.0 ? 1 : -1;
+            const double height = parabolic(i, d);
+            if (m_heights[i - 1] < height && height < m_heights[i + 1]) {
+                m_heights[i] = height;
+            } else {
+                m_heights[i] = linear(i, d);
+            }
+            m_positions[i] += d;
+        }
+    }
+}
+
+double StreamingQuantile::parabolic(int i, double d) const {
+    const double* q = m_heights;
+    const double* n = m_positions;
+    return q[i] + d / (n[i + 1] - n[i - 1]) *
+            ((n[i] - n[i - 1] + d) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+                    (n[i + 1] - n[i] - d) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+}
+
+double StreamingQuantile::linear(int i, int d) const {
+    return m_heights[i] + d * (m_heights[i + d] - m_heights[i]) /
+            (m_positions[i + d] - m_positions[i]);
+}
+
+double StreamingQuantile::value() const {
+    if (m_count == 0) {
+        return 0.0;
+    }
+    if (m_count <= kMarkers) {
+        double sorted[kMarkers];
+        std::copy(m_heights, m_heights + m_count, sorted);
+        std::sort(sorted, sorted + m_count);
+        const int index = static_cast<int>(m_quantile * (m_count - 1) + 0.5);
+        return sorted[index];
+    }
+    return m_heights[2];
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// Estimates a quantile of a stream of values in constant time and space
+// with the P-square algorithm of Jain and Chlamtac, "The P^2 Algorithm for
+// Dynamic Calculation of Quantiles and Histograms Without Storing
+// Observations", 1985.
+//
+// The first five values are stored as they are and the estimate is exact
+// up to then. Afterwards five markers are moved along with the values so
+// that the middle marker approximates the requested quantile.
+class StreamingQuantile {
+  public:
+    // quantile must be in the range (0, 1), e.g. 0.5 for the median
+    explicit StreamingQuantile(double quantile = 0.5);
+
+    void add(double value);
+    void clear();
+
+    double quantile() const {
+        return m_quantile;
+    }
+    int count() const {
+        return m_count;
+    }
+    // Returns 0 if no value has been added yet
+    double value() const;
+
+  private:
+    static constexpr int kMarkers = 5;
+
+    double parabolic(int i, double d) const;
+    double linear(int i, int d) const;
+
+    double m_quantile;
+    int m_count;
+    // Marker heights
+    double m_heights[kMarkers];
+    // Actual and desired marker positions, counted from 1
+    double m_positions[kMarkers];
+    double m_desiredPositions[kMarkers];
+    double m_increments[kMarkers];
+};
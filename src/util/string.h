@@ -22,6 +22,12 @@ class StringCollator {
         return m_collator.compare(s1, s2);
     }
 
+    // Sort keys are compared much faster than the strings themselves
+    // when the same strings need to be compared over and over again.
+    QCollatorSortKey sortKey(const QString& s) const {
+        return m_collator.sortKey(s);
+    }
+
   private:
     QCollator m_collator;
 };
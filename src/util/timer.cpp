@@ -5,7 +5,11 @@
 #include "waveform/guitick.h"
 
 Timer::Timer(const QString& key, Stat::ComputeFlags compute)
-        : m_key(key),
+        : Timer(Stat::registerTag(key), compute) {
+}
+
+Timer::Timer(int tagId, Stat::ComputeFlags compute)
+        : m_tagId(tagId),
           m_compute(Stat::experimentFlags(compute)),
           m_running(false) {
 }
@@ -22,7 +26,7 @@ mixxx::Duration Timer::restart(bool report) {
             // Ignore the report if it crosses the experiment boundary.
             Experiment::Mode oldMode = Stat::modeFromFlags(m_compute);
             if (oldMode == Experiment::mode()) {
-                Stat::track(m_key, Stat::DURATION_NANOSEC, m_compute,
+                Stat::track(m_tagId, Stat::DURATION_NANOSEC, m_compute,
                             elapsed.toIntegerNanos());
             }
         }
@@ -39,7 +43,7 @@ mixxx::Duration Timer::elapsed(bool report) {
         // Ignore the report if it crosses the experiment boundary.
         Experiment::Mode oldMode = Stat::modeFromFlags(m_compute);
         if (oldMode == Experiment::mode()) {
-            Stat::track(m_key, Stat::DURATION_NANOSEC, m_compute,
+            Stat::track(m_tagId, Stat::DURATION_NANOSEC, m_compute,
                         elapsedTime.toIntegerNanos());
         }
     }
@@ -73,7 +77,7 @@ mixxx::Duration SuspendableTimer::elapsed(bool report) {
         // Ignore the report if it crosses the experiment boundary.
         Experiment::Mode oldMode = Stat::modeFromFlags(m_compute);
         if (oldMode == Experiment::mode()) {
-            Stat::track(m_key, Stat::DURATION_NANOSEC, m_compute,
+            Stat::track(m_tagId, Stat::DURATION_NANOSEC, m_compute,
                         m_leapTime.toIntegerNanos());
         }
     }
@@ -11,7 +11,8 @@
 #include "util/stat.h"
 
 const Stat::ComputeFlags kDefaultComputeFlags = Stat::COUNT | Stat::SUM | Stat::AVERAGE |
-        Stat::MAX | Stat::MIN | Stat::SAMPLE_VARIANCE;
+        Stat::MAX | Stat::MIN | Stat::SAMPLE_VARIANCE | Stat::SAMPLE_MEDIAN |
+        Stat::SAMPLE_PERCENTILES;
 
 // A Timer that is instrumented for reporting elapsed times to StatsManager
 // under a certain key. Construct with custom compute flags to get custom values
@@ -20,6 +21,9 @@ class Timer {
   public:
     Timer(const QString& key,
           Stat::ComputeFlags compute = kDefaultComputeFlags);
+    // Reports to a tag that has been registered with Stat::registerTag()
+    Timer(int tagId,
+          Stat::ComputeFlags compute = kDefaultComputeFlags);
     void start();
 
     // Restart the timer returning the time duration since it was last
@@ -32,7 +36,7 @@ class Timer {
     mixxx::Duration elapsed(bool report);
 
   protected:
-    QString m_key;
+    int m_tagId;
     Stat::ComputeFlags m_compute;
     bool m_running;
     PerformanceTimer m_time;
@@ -58,7 +62,7 @@ class ScopedTimer {
             : m_pTimer(NULL),
               m_cancel(false) {
         if (CmdlineArgs::Instance().getDeveloper()) {
-            initialize(QString(key), QString::number(i), compute);
+            initialize(Stat::registerTag(key, i), compute);
         }
     }
 
@@ -67,7 +71,8 @@ class ScopedTimer {
             : m_pTimer(NULL),
               m_cancel(false) {
         if (CmdlineArgs::Instance().getDeveloper()) {
-            initialize(QString(key), arg ? QString(arg) : QString(), compute);
+            initialize(Stat::registerTag(key, arg ? QString(arg) : QString()),
+                    compute);
         }
     }
 
@@ -76,7 +81,7 @@ class ScopedTimer {
             : m_pTimer(NULL),
               m_cancel(false) {
         if (CmdlineArgs::Instance().getDeveloper()) {
-            initialize(QString(key), arg, compute);
+            initialize(Stat::registerTag(key, arg), compute);
         }
     }
 
@@ -89,15 +94,9 @@ class ScopedTimer {
         }
     }
 
-    inline void initialize(const QString& key, const QString& arg,
+    inline void initialize(int tagId,
                 Stat::ComputeFlags compute = kDefaultComputeFlags) {
-        QString strKey;
-        if (arg.isEmpty()) {
-            strKey = key;
-        } else {
-            strKey = key.arg(arg);
-        }
-        m_pTimer = new(m_timerMem) Timer(strKey, compute);
+        m_pTimer = new(m_timerMem) Timer(tagId, compute);
         m_pTimer->start();
     }
 
@@ -14,79 +14,74 @@ class Trace {
   public:
     Trace(const char* tag, const char* arg=NULL,
           bool writeToStdout=false, bool time=true)
-            : m_writeToStdout(writeToStdout),
+            : m_tagId(Stat::kInvalidTagId),
+              m_writeToStdout(writeToStdout),
               m_time(time) {
         if (writeToStdout || CmdlineArgs::Instance().getDeveloper()) {
-            initialize(tag, arg);
+            initialize(Stat::registerTag(tag, arg ? QString(arg) : QString()));
         }
     }
 
     Trace(const char* tag, int arg,
           bool writeToStdout=false, bool time=true)
-            : m_writeToStdout(writeToStdout),
+            : m_tagId(Stat::kInvalidTagId),
+              m_writeToStdout(writeToStdout),
               m_time(time) {
         if (writeToStdout || CmdlineArgs::Instance().getDeveloper()) {
-            initialize(tag, QString::number(arg));
+            initialize(Stat::registerTag(tag, arg));
         }
     }
 
     Trace(const char* tag, const QString& arg,
           bool writeToStdout=false, bool time=true)
-            : m_writeToStdout(writeToStdout),
+            : m_tagId(Stat::kInvalidTagId),
+              m_writeToStdout(writeToStdout),
               m_time(time) {
         if (writeToStdout || CmdlineArgs::Instance().getDeveloper()) {
-            initialize(tag, arg);
+            initialize(Stat::registerTag(tag, arg));
         }
     }
 
     virtual ~Trace() {
         // Proxy for whether initialize was called.
-        if (m_tag.isEmpty()) {
+        if (m_tagId == Stat::kInvalidTagId) {
             return;
         }
 
-        Event::end(m_tag);
+        Event::end(m_tagId);
 
         if (m_time) {
             mixxx::Duration elapsed = m_timer.elapsed();
             if (m_writeToStdout) {
-                qDebug() << "END [" << m_tag << "] elapsed: "
+                qDebug() << "END [" << Stat::tagName(m_tagId) << "] elapsed: "
                          << elapsed.debugNanosWithUnit();
             }
 
-            // NOTE(rryan) do we need to do this string append? We could add
-            // a check in StatsManager to infer that a DURATION_NANOSEC
-            // event for the same tag that has an EVENT_START/EVENT_END is a
-            // duration instead of changing the tag.
+            // The duration tag is registered only once per tag
             Stat::track(
-                m_tag + "_duration",
+                Stat::registerTag(m_tagId, "_duration"),
                 Stat::DURATION_NANOSEC,
                 Stat::COUNT | Stat::AVERAGE | Stat::SAMPLE_VARIANCE |
                 Stat::MAX | Stat::MIN,
                 elapsed.toIntegerNanos());
         } else if (m_writeToStdout) {
-            qDebug() << "END [" << m_tag << "]";
+            qDebug() << "END [" << Stat::tagName(m_tagId) << "]";
         }
     }
 
   private:
-    void initialize(const QString& key, const QString& arg) {
-        if (arg.isEmpty()) {
-            m_tag = key;
-        } else {
-            m_tag = key.arg(arg);
-        }
-
-        Event::start(m_tag);
+    void initialize(int tagId) {
+        m_tagId = tagId;
+        Event::start(m_tagId);
         if (m_time) {
             m_timer.start();
         }
         if (m_writeToStdout) {
-            qDebug() << "START [" << m_tag << "]";
+            qDebug() << "START [" << Stat::tagName(m_tagId) << "]";
         }
     }
 
-    QString m_tag;
+    int m_tagId;
     const bool m_writeToStdout, m_time;
     PerformanceTimer m_timer;
 
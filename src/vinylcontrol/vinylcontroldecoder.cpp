@@ -0,0 +1,110 @@
+#include "vinylcontrol/vinylcontroldecoder.h"
+
+#ifdef __LINUX__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <QMutexLocker>
+#include <QtDebug>
+
+#include "util/defs.h"
+#include "util/sample.h"
+#include "vinylcontrol/vinylcontrol.h"
+#include "vinylcontrol/vinylcontrolprocessor.h"
+
+namespace {
+
+// About 340 ms of stereo samples at 96 kHz
+const int kSamplePipeFifoSize = 65536;
+
+} // anonymous namespace
+
+VinylControlDecoder::VinylControlDecoder(VinylControlProcessor* pProcessor, int index)
+        : m_pProcessor(pProcessor),
+          m_index(index),
+          m_samplePipe(kSamplePipeFifoSize),
+          m_pWorkBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
+          m_pVinylControl(nullptr),
+          m_bQuit(false) {
+}
+
+VinylControlDecoder::~VinylControlDecoder() {
+    stop();
+    wait();
+    SampleUtil::free(m_pWorkBuffer);
+}
+
+void VinylControlDecoder::receiveBuffer(const CSAMPLE* pBuffer,
+                                        unsigned int iNumFrames) {
+    const int kChannels = 2;
+    const int nSamples = iNumFrames * kChannels;
+    int samplesWritten = m_samplePipe.write(pBuffer, nSamples);
+
+    if (samplesWritten < nSamples) {
+        qWarning() << "ERROR: Buffer overflow in VinylControlDecoder. Dropping samples on the floor."
+                   << "VCIndex:" << m_index;
+    }
+
+    m_samplesAvailable.release();
+}
+
+VinylControl* VinylControlDecoder::setVinylControl(VinylControl* pVinylControl) {
+    QMutexLocker locker(&m_vinylControlMutex);
+    VinylControl* pPrevious = m_pVinylControl;
+    m_pVinylControl = pVinylControl;
+    return pPrevious;
+}
+
+void VinylControlDecoder::stop() {
+    m_bQuit.store(true);
+    m_samplesAvailable.release();
+}
+
+void VinylControlDecoder::run() {
+    setObjectName(QString("VinylControlDecoder %1").arg(m_index + 1));
+
+#ifdef __LINUX__
+    // The decoded pitch drives the deck, so a decoder must not wait for
+    // other threads that run at a normal priority.
+    struct sched_param spm = { 0 };
+    spm.sched_priority = 1;
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &spm)) {
+        qDebug() << "VinylControlDecoder: Failed bumping priority";
+    }
+#endif
+
+    while (true) {
+        m_samplesAvailable.acquire();
+        if (m_bQuit.load()) {
+            break;
+        }
+        // All buffers that have been received so far are decoded at once
+        m_samplesAvailable.tryAcquire(m_samplesAvailable.available());
+        decodeAvailableSamples();
+    }
+}
+
+void VinylControlDecoder::decodeAvailableSamples() {
+    QMutexLocker locker(&m_vinylControlMutex);
+    while (m_samplePipe.readAvailable() > 0) {
+        int samplesRead = m_samplePipe.read(m_pWorkBuffer, MAX_BUFFER_LEN);
+
+        if (samplesRead % 2 != 0) {
+            qWarning() << "VinylControlDecoder received non-even number of samples via sample FIFO.";
+            samplesRead--;
+        }
+        int framesRead = samplesRead / 2;
+
+        if (m_pVinylControl) {
+            m_pVinylControl->analyzeSamples(m_pWorkBuffer, framesRead);
+        } else {
+            // Samples are being written to a non-existent processor. Warning?
+            qWarning() << "Samples written to non-existent VinylControl processor:" << m_index;
+        }
+    }
+
+    if (m_pVinylControl) {
+        m_pProcessor->reportSignalQuality(m_index, m_pVinylControl);
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef VINYLCONTROLDECODER_H
+#define VINYLCONTROLDECODER_H
+
+#include <QMutex>
+#include <QSemaphore>
+#include <QThread>
+#include <atomic>
+
+#include "util/fifo.h"
+#include "util/types.h"
+
+class VinylControl;
+class VinylControlProcessor;
+
+// VinylControlDecoder is a thread that decodes the timecode of a single vinyl
+// control input, so that several timecode decks are decoded in parallel and
+// one deck does not have to wait for the others. It receives the samples of
+// its input from the engine callback through a lock-free FIFO.
+class VinylControlDecoder : public QThread {
+    Q_OBJECT
+  public:
+    VinylControlDecoder(VinylControlProcessor* pProcessor, int index);
+    ~VinylControlDecoder() override;
+
+    // Called by the engine callback. Must not touch any state except for
+    // m_samplePipe and m_samplesAvailable.
+    void receiveBuffer(const CSAMPLE* pBuffer, unsigned int iNumFrames);
+
+    // Called from the main thread. Replaces the VinylControl of this input
+    // and returns the previous one, which is no longer used by the decoder
+    // and can be deleted by the caller.
+    VinylControl* setVinylControl(VinylControl* pVinylControl);
+
+    // Called from the main thread. Stops the thread without waiting for it.
+    void stop();
+
+  protected:
+    void run() override;
+
+  private:
+    void decodeAvailableSamples();
+
+    VinylControlProcessor* const m_pProcessor;
+    const int m_index;
+    FIFO<CSAMPLE> m_samplePipe;
+    CSAMPLE* m_pWorkBuffer;
+    // Released by the engine callback for every buffer
+    QSemaphore m_samplesAvailable;
+    // Held while m_pVinylControl decodes samples
+    QMutex m_vinylControlMutex;
+    VinylControl* m_pVinylControl;
+    std::atomic<bool> m_bQuit;
+};
+
+#endif /* VINYLCONTROLDECODER_H */
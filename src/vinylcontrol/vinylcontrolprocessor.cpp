@@ -3,28 +3,25 @@
 #include "vinylcontrol/vinylcontrolprocessor.h"
 
 #include "control/controlpushbutton.h"
+#include "util/assert.h"
 #include "util/defs.h"
 #include "util/event.h"
-#include "util/sample.h"
 #include "util/timer.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 #include "vinylcontrol/vinylcontrol.h"
+#include "vinylcontrol/vinylcontroldecoder.h"
 #include "vinylcontrol/vinylcontrolxwax.h"
 
 #define SIGNAL_QUALITY_FIFO_SIZE 256
-#define SAMPLE_PIPE_FIFO_SIZE 65536
 
 VinylControlProcessor::VinylControlProcessor(QObject* pParent, UserSettingsPointer pConfig)
-        : QThread(pParent),
+        : QObject(pParent),
           m_pConfig(pConfig),
           m_pToggle(new ControlPushButton(ConfigKey(VINYL_PREF_KEY, "Toggle"))),
-          m_pWorkBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
           m_processorsLock(QMutex::Recursive),
           m_processors(kMaximumVinylControlInputs, NULL),
           m_signalQualityFifo(SIGNAL_QUALITY_FIFO_SIZE),
-          m_bReportSignalQuality(false),
-          m_bQuit(false),
-          m_bReloadConfig(false) {
+          m_bReportSignalQuality(false) {
     connect(m_pToggle,
             &ControlPushButton::valueChanged,
             this,
@@ -32,19 +29,22 @@ VinylControlProcessor::VinylControlProcessor(QObject* pParent, UserSettingsPoint
             Qt::DirectConnection);
 
     for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
-        m_samplePipes[i] = new FIFO<CSAMPLE>(SAMPLE_PIPE_FIFO_SIZE);
+        m_decoders[i] = new VinylControlDecoder(this, i);
+        // The decoders sleep until their input receives samples
+        m_decoders[i]->start(QThread::TimeCriticalPriority);
     }
-
-    start(QThread::HighPriority);
 }
 
 VinylControlProcessor::~VinylControlProcessor() {
-    m_bQuit = true;
-    m_samplesAvailableSignal.wakeAll();
-    wait();
+    shutdown();
 
     delete m_pToggle;
-    SampleUtil::free(m_pWorkBuffer);
+
+    for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
+        // Waits for the decoder thread to finish
+        delete m_decoders[i];
+        m_decoders[i] = NULL;
+    }
 
     {
         QMutexLocker locker(&m_processorsLock);
@@ -52,9 +52,6 @@ VinylControlProcessor::~VinylControlProcessor() {
             VinylControl* pProcessor = m_processors.at(i);
             m_processors[i] = NULL;
             delete pProcessor;
-
-            delete m_samplePipes[i];
-            m_samplePipes[i] = NULL;
         }
     }
 
@@ -68,91 +65,58 @@ void VinylControlProcessor::setSignalQualityReporting(bool enable) {
 }
 
 void VinylControlProcessor::shutdown() {
-    m_bQuit = true;
-    m_samplesAvailableSignal.wakeAll();
-}
-
-void VinylControlProcessor::requestReloadConfig() {
-    m_bReloadConfig = true;
-    m_samplesAvailableSignal.wakeAll();
-}
-
-void VinylControlProcessor::run() {
-    unsigned static id = 0; //the id of this thread, for debugging purposes //XXX copypasta (should factor this out somehow), -kousu 2/2009
-    QThread::currentThread()->setObjectName(QString("VinylControlProcessor %1").arg(++id));
-
-    while (!m_bQuit) {
-        if (m_bReloadConfig) {
-            reloadConfig();
-            m_bReloadConfig = false;
-        }
-
-        for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
-            QMutexLocker locker(&m_processorsLock);
-            VinylControl* pProcessor = m_processors[i];
-            locker.unlock();
-            FIFO<CSAMPLE>* pSamplePipe = m_samplePipes[i];
-
-            if (pSamplePipe->readAvailable() > 0) {
-                int samplesRead = pSamplePipe->read(m_pWorkBuffer, MAX_BUFFER_LEN);
-
-                if (samplesRead % 2 != 0) {
-                    qWarning() << "VinylControlProcessor received non-even number of samples via sample FIFO.";
-                    samplesRead--;
-                }
-                int framesRead = samplesRead / 2;
-
-                if (pProcessor) {
-                    pProcessor->analyzeSamples(m_pWorkBuffer, framesRead);
-                } else {
-                    // Samples are being written to a non-existent processor. Warning?
-                    qWarning() << "Samples written to non-existent VinylControl processor:" << i;
-                }
-            }
-
-            // TODO(rryan) define a time-based update rate. This will update way
-            // too quickly.
-            if (pProcessor && m_bReportSignalQuality) {
-                VinylSignalQualityReport report;
-                if (pProcessor->writeQualityReport(&report)) {
-                    report.processor = i;
-                    if (m_signalQualityFifo.write(&report, 1) != 1) {
-                        qWarning() << "VinylControlProcessor could not write signal quality report for VC index:" << i;
-                    }
-                }
-            }
-        }
-
-        if (m_bQuit) {
-            break;
+    for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
+        if (m_decoders[i]) {
+            m_decoders[i]->stop();
         }
-
-        // Wait for a signal from the main thread or engine thread that we
-        // should wake up and process input.
-        m_waitForSampleMutex.lock();
-        m_samplesAvailableSignal.wait(&m_waitForSampleMutex);
-        m_waitForSampleMutex.unlock();
     }
 }
 
-void VinylControlProcessor::reloadConfig() {
+void VinylControlProcessor::requestReloadConfig() {
     for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
         QMutexLocker locker(&m_processorsLock);
         VinylControl* pCurrent = m_processors[i];
+        locker.unlock();
 
         if (pCurrent == NULL) {
             continue;
         }
 
-        VinylControl *pNew = new VinylControlXwax(
-            m_pConfig, kVCGroup.arg(i + 1));
-        m_processors.replace(i, pNew);
-        locker.unlock();
-        // Delete outside of the critical section to avoid deadlocks.
-        delete pCurrent;
+        replaceProcessor(i, new VinylControlXwax(
+            m_pConfig, kVCGroup.arg(i + 1)));
+    }
+}
+
+void VinylControlProcessor::reportSignalQuality(int index, VinylControl* pVinylControl) {
+    // TODO(rryan) define a time-based update rate. This will update way
+    // too quickly.
+    if (!m_bReportSignalQuality) {
+        return;
+    }
+    VinylSignalQualityReport report;
+    if (pVinylControl->writeQualityReport(&report)) {
+        report.processor = index;
+        QMutexLocker locker(&m_signalQualityFifoMutex);
+        if (m_signalQualityFifo.write(&report, 1) != 1) {
+            qWarning() << "VinylControlProcessor could not write signal quality report for VC index:" << index;
+        }
     }
 }
 
+void VinylControlProcessor::replaceProcessor(int index, VinylControl* pNew) {
+    QMutexLocker locker(&m_processorsLock);
+    VinylControl* pCurrent = m_processors.at(index);
+    m_processors.replace(index, pNew);
+    locker.unlock();
+
+    // Returns when the decoder has finished the samples it is decoding with
+    // the current processor.
+    VinylControl* pDecoding = m_decoders[index]->setVinylControl(pNew);
+    DEBUG_ASSERT(pDecoding == pCurrent);
+    // Delete outside of the critical section to avoid deadlocks.
+    delete pCurrent;
+}
+
 void VinylControlProcessor::onInputConfigured(AudioInput input) {
     if (input.getType() != AudioInput::VINYLCONTROL) {
         qDebug() << "WARNING: AudioInput type is not VINYLCONTROL. Ignoring.";
@@ -168,13 +132,7 @@ void VinylControlProcessor::onInputConfigured(AudioInput input) {
 
     VinylControl *pNew = new VinylControlXwax(
         m_pConfig, kVCGroup.arg(index + 1));
-
-    QMutexLocker locker(&m_processorsLock);
-    VinylControl* pCurrent = m_processors.at(index);
-    m_processors.replace(index, pNew);
-    locker.unlock();
-    // Delete outside of the critical section to avoid deadlocks.
-    delete pCurrent;
+    replaceProcessor(index, pNew);
 }
 
 void VinylControlProcessor::onInputUnconfigured(AudioInput input) {
@@ -191,12 +149,7 @@ void VinylControlProcessor::onInputUnconfigured(AudioInput input) {
         return;
     }
 
-    QMutexLocker locker(&m_processorsLock);
-    VinylControl* pVC = m_processors.at(index);
-    m_processors.replace(index, NULL);
-    locker.unlock();
-    // Delete outside of the critical section to avoid deadlocks.
-    delete pVC;
+    replaceProcessor(index, NULL);
 }
 
 bool VinylControlProcessor::deckConfigured(int index) const {
@@ -219,23 +172,14 @@ void VinylControlProcessor::receiveBuffer(AudioInput input,
         return;
     }
 
-    FIFO<CSAMPLE>* pSamplePipe = m_samplePipes[vcIndex];
+    VinylControlDecoder* pDecoder = m_decoders[vcIndex];
 
-    if (pSamplePipe == NULL) {
+    if (pDecoder == NULL) {
         // Should not be possible.
         return;
     }
 
-    const int kChannels = 2;
-    const int nSamples = nFrames * kChannels;
-    int samplesWritten = pSamplePipe->write(pBuffer, nSamples);
-
-    if (samplesWritten < nSamples) {
-        qWarning() << "ERROR: Buffer overflow in VinylControlProcessor. Dropping samples on the floor."
-                   << "VCIndex:" << vcIndex;
-    }
-
-    m_samplesAvailableSignal.wakeAll();
+    pDecoder->receiveBuffer(pBuffer, nFrames);
 }
 
 void VinylControlProcessor::toggleDeck(double value) {
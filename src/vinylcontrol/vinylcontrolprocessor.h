@@ -2,10 +2,8 @@
 #define VINYLCONTROLPROCESSOR_H
 
 #include <QObject>
-#include <QThread>
 #include <QVector>
 #include <QMutex>
-#include <QWaitCondition>
 
 #include "preferences/usersettings.h"
 #include "util/fifo.h"
@@ -13,13 +11,15 @@
 #include "soundio/soundmanagerutil.h"
 
 class VinylControl;
+class VinylControlDecoder;
 class ControlPushButton;
 
-// VinylControlProcessor is a thread that is in charge of receiving samples from
-// the engine callback and feeding those samples to the VinylControl
-// classes. The most important thing is that the connection between the engine
-// callback and VinylControlProcessor (the receiveBuffer method) is lock-free.
-class VinylControlProcessor : public QThread, public AudioDestination {
+// VinylControlProcessor is in charge of receiving samples from the engine
+// callback and feeding those samples to the VinylControl classes. Each input
+// is decoded by a VinylControlDecoder thread of its own. The most important
+// thing is that the connection between the engine callback and the decoders
+// (the receiveBuffer method) is lock-free.
+class VinylControlProcessor : public QObject, public AudioDestination {
     Q_OBJECT
   public:
     VinylControlProcessor(QObject* pParent, UserSettingsPointer pConfig);
@@ -28,10 +28,11 @@ class VinylControlProcessor : public QThread, public AudioDestination {
     // Called from main thread. Must only touch m_bReportSignalQuality.
     void setSignalQualityReporting(bool enable);
 
-    // Called from the main thread. Must only touch m_bQuit;
+    // Called from the main thread. Stops the decoders.
     void shutdown();
 
-    // Called from the main thread. Must only touch m_bReload;
+    // Called from the main thread. Recreates the VinylControl of every
+    // configured input with the current preferences.
     void requestReloadConfig();
 
     bool deckConfigured(int index) const;
@@ -40,12 +41,15 @@ class VinylControlProcessor : public QThread, public AudioDestination {
         return &m_signalQualityFifo;
     }
 
+    // Called by the decoder threads after decoding the samples of an input
+    void reportSignalQuality(int index, VinylControl* pVinylControl);
+
   public slots:
     virtual void onInputConfigured(AudioInput input);
     virtual void onInputUnconfigured(AudioInput input);
 
     // Called by the engine callback. Must not touch any state in
-    // VinylControlProcessor except for m_samplePipes. NOTE:
+    // VinylControlProcessor except for m_decoders. NOTE:
 
     // This is called by SoundManager whenever there are new samples from the
     // configured input to be processed. This is run in the callback thread of
@@ -56,30 +60,26 @@ class VinylControlProcessor : public QThread, public AudioDestination {
     void receiveBuffer(AudioInput input, const CSAMPLE* pBuffer,
                        unsigned int iNumFrames);
 
-  protected:
-    void run();
-
   private slots:
     void toggleDeck(double value);
 
   private:
-    void reloadConfig();
+    // Replaces the VinylControl of an input, which may be NULL, and deletes
+    // the previous one.
+    void replaceProcessor(int index, VinylControl* pNew);
 
     UserSettingsPointer m_pConfig;
     ControlPushButton* m_pToggle;
-    // A pre-allocated array of FIFOs for writing samples from the engine
-    // callback to the processor thread. There is a maximum of
-    // kMaximumVinylControlInputs pipes.
-    FIFO<CSAMPLE>* m_samplePipes[kMaximumVinylControlInputs];
-    CSAMPLE* m_pWorkBuffer;
-    QWaitCondition m_samplesAvailableSignal;
-    QMutex m_waitForSampleMutex;
+    // A pre-allocated array of decoder threads with the FIFOs for writing
+    // samples from the engine callback. There is a maximum of
+    // kMaximumVinylControlInputs decoders.
+    VinylControlDecoder* m_decoders[kMaximumVinylControlInputs];
     QMutex m_processorsLock;
     QVector<VinylControl*> m_processors;
+    // Written by all decoder threads
+    QMutex m_signalQualityFifoMutex;
     FIFO<VinylSignalQualityReport> m_signalQualityFifo;
     volatile bool m_bReportSignalQuality;
-    volatile bool m_bQuit;
-    volatile bool m_bReloadConfig;
 };
 
 
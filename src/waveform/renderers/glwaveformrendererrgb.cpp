@@ -3,6 +3,7 @@
 
 #include "waveformwidgetrenderer.h"
 #include "waveform/waveform.h"
+#include "waveform/waveformpyramid.h"
 #include "waveform/waveformwidgetfactory.h"
 #include "widget/wwidget.h"
 #include "widget/wskincolor.h"
@@ -63,6 +64,21 @@ void GLWaveformRendererRGB::draw(QPainter* painter, QPaintEvent* /*event*/) {
 
     const float kHeightScaleFactor = 255.0 / sqrtf(255 * 255 * 3);
 
+    // When zoomed out, draw one line per frame of a downsampled level of
+    // the waveform instead of one line per visual frame.
+    const WaveformData* levelData = data;
+    int framesPerLevelFrame = 1;
+    const WaveformPyramid* pyramid = waveform->pyramid();
+    if (pyramid) {
+        const int level = pyramid->findLevel(
+                m_waveformRenderer->getVisualSamplePerPixel() / 2.0);
+        if (level >= 0) {
+            levelData = pyramid->levelData(level);
+            framesPerLevelFrame = WaveformPyramid::framesPerLevelFrame(level);
+        }
+    }
+    const int visualIndexStep = 2 * framesPerLevelFrame;
+
     if (m_alignment == Qt::AlignCenter) {
         glMatrixMode(GL_PROJECTION);
         glPushMatrix();
@@ -96,15 +112,17 @@ void GLWaveformRendererRGB::draw(QPainter* painter, QPaintEvent* /*event*/) {
         glBegin(GL_LINES); {
 
             int firstIndex = math_max(static_cast<int>(firstVisualIndex), 0);
+            firstIndex -= firstIndex % visualIndexStep;
             int lastIndex = math_min(static_cast<int>(lastVisualIndex), dataSize);
 
             for (int visualIndex = firstIndex;
                     visualIndex < lastIndex;
-                    visualIndex += 2) {
+                    visualIndex += visualIndexStep) {
+                const int levelIndex = visualIndex / framesPerLevelFrame;
 
-                float left_low    = lowGain  * (float) data[visualIndex].filtered.low;
-                float left_mid    = midGain  * (float) data[visualIndex].filtered.mid;
-                float left_high   = highGain * (float) data[visualIndex].filtered.high;
+                float left_low    = lowGain  * (float) levelData[levelIndex].filtered.low;
+                float left_mid    = midGain  * (float) levelData[levelIndex].filtered.mid;
+                float left_high   = highGain * (float) levelData[levelIndex].filtered.high;
                 float left_all    = sqrtf(left_low * left_low + left_mid * left_mid + left_high * left_high) * kHeightScaleFactor;
                 float left_red    = left_low  * m_rgbLowColor_r + left_mid  * m_rgbMidColor_r + left_high  * m_rgbHighColor_r;
                 float left_green  = left_low  * m_rgbLowColor_g + left_mid  * m_rgbMidColor_g + left_high  * m_rgbHighColor_g;
@@ -116,9 +134,9 @@ void GLWaveformRendererRGB::draw(QPainter* painter, QPaintEvent* /*event*/) {
                     glVertex2f(visualIndex, left_all);
                 }
 
-                float right_low   = lowGain  * (float) data[visualIndex+1].filtered.low;
-                float right_mid   = midGain  * (float) data[visualIndex+1].filtered.mid;
-                float right_high  = highGain * (float) data[visualIndex+1].filtered.high;
+                float right_low   = lowGain  * (float) levelData[levelIndex + 1].filtered.low;
+                float right_mid   = midGain  * (float) levelData[levelIndex + 1].filtered.mid;
+                float right_high  = highGain * (float) levelData[levelIndex + 1].filtered.high;
                 float right_all   = sqrtf(right_low * right_low + right_mid * right_mid + right_high * right_high) * kHeightScaleFactor;
                 float right_red   = right_low * m_rgbLowColor_r + right_mid * m_rgbMidColor_r + right_high * m_rgbHighColor_r;
                 float right_green = right_low * m_rgbLowColor_g + right_mid * m_rgbMidColor_g + right_high * m_rgbHighColor_g;
@@ -160,15 +178,17 @@ void GLWaveformRendererRGB::draw(QPainter* painter, QPaintEvent* /*event*/) {
         glBegin(GL_LINES); {
 
             int firstIndex = math_max(static_cast<int>(firstVisualIndex), 0);
+            firstIndex -= firstIndex % visualIndexStep;
             int lastIndex = math_min(static_cast<int>(lastVisualIndex), dataSize);
 
             for (int visualIndex = firstIndex;
                     visualIndex < lastIndex;
-                    visualIndex += 2) {
+                    visualIndex += visualIndexStep) {
+                const int levelIndex = visualIndex / framesPerLevelFrame;
 
-                float low  = lowGain  * (float) math_max(data[visualIndex].filtered.low,  data[visualIndex+1].filtered.low);
-                float mid  = midGain  * (float) math_max(data[visualIndex].filtered.mid,  data[visualIndex+1].filtered.mid);
-                float high = highGain * (float) math_max(data[visualIndex].filtered.high, data[visualIndex+1].filtered.high);
+                float low  = lowGain  * (float) math_max(levelData[levelIndex].filtered.low,  levelData[levelIndex + 1].filtered.low);
+                float mid  = midGain  * (float) math_max(levelData[levelIndex].filtered.mid,  levelData[levelIndex + 1].filtered.mid);
+                float high = highGain * (float) math_max(levelData[levelIndex].filtered.high, levelData[levelIndex + 1].filtered.high);
 
                 float all = sqrtf(low * low + mid * mid + high * high) * kHeightScaleFactor;
 
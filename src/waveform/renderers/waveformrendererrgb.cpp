@@ -2,6 +2,7 @@
 
 #include "waveformwidgetrenderer.h"
 #include "waveform/waveform.h"
+#include "waveform/waveformpyramid.h"
 #include "waveform/waveformwidgetfactory.h"
 
 #include "widget/wskincolor.h"
@@ -64,6 +65,21 @@ void WaveformRendererRGB::draw(QPainter* painter,
     const double gain = (lastVisualIndex - firstVisualIndex) /
             (double)m_waveformRenderer->getLength();
 
+    // When zoomed out, read from a downsampled level of the waveform that
+    // still provides at least one frame per pixel.
+    const WaveformData* levelData = data;
+    int levelDataSize = dataSize;
+    int framesPerLevelFrame = 1;
+    const WaveformPyramid* pyramid = waveform->pyramid();
+    if (pyramid) {
+        const int level = pyramid->findLevel(gain / 2.0);
+        if (level >= 0) {
+            levelData = pyramid->levelData(level);
+            levelDataSize = pyramid->levelDataSize(level);
+            framesPerLevelFrame = WaveformPyramid::framesPerLevelFrame(level);
+        }
+    }
+
     // Per-band gain from the EQ knobs.
     float allGain(1.0), lowGain(1.0), midGain(1.0), highGain(1.0);
     getGains(&allGain, &lowGain, &midGain, &highGain);
@@ -111,8 +127,9 @@ void WaveformRendererRGB::draw(QPainter* painter,
         visualFrameStart = math_clamp(visualFrameStart, 0, lastVisualFrame);
         visualFrameStop = math_clamp(visualFrameStop, 0, lastVisualFrame);
 
-        int visualIndexStart = visualFrameStart * 2;
-        int visualIndexStop  = visualFrameStop * 2;
+        // Map the visual frames to the frames of the selected level
+        int visualIndexStart = visualFrameStart / framesPerLevelFrame * 2;
+        int visualIndexStop  = visualFrameStop / framesPerLevelFrame * 2;
 
         unsigned char maxLow  = 0;
         unsigned char maxMid  = 0;
@@ -121,9 +138,9 @@ void WaveformRendererRGB::draw(QPainter* painter,
         float maxAllNext = 0.;
 
         for (int i = visualIndexStart;
-             i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop; i += 2) {
-            const WaveformData& waveformData = data[i];
-            const WaveformData& waveformDataNext = data[i + 1];
+             i >= 0 && i + 1 < levelDataSize && i + 1 <= visualIndexStop; i += 2) {
+            const WaveformData& waveformData = levelData[i];
+            const WaveformData& waveformDataNext = levelData[i + 1];
 
             maxLow  = math_max3(maxLow,  waveformData.filtered.low,  waveformDataNext.filtered.low);
             maxMid  = math_max3(maxMid,  waveformData.filtered.mid,  waveformDataNext.filtered.mid);
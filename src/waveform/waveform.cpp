@@ -1,11 +1,46 @@
+#include <QDataStream>
+#include <QVector>
 #include <QtDebug>
 
+#include <algorithm>
+#include <limits>
+
 #include "waveform/waveform.h"
 #include "proto/waveform.pb.h"
+#include "util/math.h"
+#include "waveform/waveformpyramid.h"
 
 using namespace mixxx::track;
 
-const int kNumChannels = 2;
+namespace {
+
+// Flat binary format (little endian):
+//  - magic bytes
+//  - quint32 format version
+//  - quint32 number of data elements
+//  - quint32 number of data elements per region (except the last region)
+//  - quint32 number of regions
+//  - double visual sample rate
+//  - double audio/visual ratio
+//  - for each region: quint32 codec, quint32 number of payload bytes
+//  - the payload of all regions, i.e. the WaveformData elements as
+//    laid out in memory, either uncompressed or compressed with qCompress()
+const char kFlatMagic[4] = {'M', 'X', 'W', 'F'};
+const quint32 kFlatVersion = 1;
+
+enum class FlatRegionCodec : quint32 {
+    None = 0,
+    Zlib = 1,
+};
+
+// 256 KB of uncompressed data per region
+const int kFlatRegionSize = 64 * 1024;
+
+// Waveform data compresses well even with the fastest level that
+// is also the fastest for decompressing
+const int kFlatCompressionLevel = 1;
+
+} // anonymous namespace
 
 // Return the smallest power of 2 which is greater than the desired size when
 // squared.
@@ -65,65 +100,77 @@ Waveform::Waveform(int audioSampleRate, int audioSamples,
 }
 
 Waveform::~Waveform() {
+    delete m_pPyramid.loadAcquire();
+}
+
+void Waveform::buildPyramid() {
+    if (m_pPyramid.loadAcquire()) {
+        return;
+    }
+    const WaveformPyramid* pPyramid = new WaveformPyramid(m_data.data(), getDataSize());
+    if (!m_pPyramid.testAndSetOrdered(nullptr, pPyramid)) {
+        // Built concurrently by another thread
+        delete pPyramid;
+    }
 }
 
 QByteArray Waveform::toByteArray() const {
-    io::Waveform waveform;
-    waveform.set_visual_sample_rate(m_visualSampleRate);
-    waveform.set_audio_visual_ratio(m_audioVisualRatio);
-
-    io::Waveform::Signal* all = waveform.mutable_signal_all();
-    io::Waveform::FilteredSignal* filtered = waveform.mutable_signal_filtered();
-    // TODO(rryan) get the actual cutoff values from analyzerwaveform.cpp so
-    // that if they change we don't have to remember to update these.
-
-    // Frequency cutoffs for butterworth filters:
-    // filtered->set_low_cutoff_frequency(200);
-    // filtered->set_mid_low_cutoff_frequency(200);
-    // filtered->set_mid_high_cutoff_frequency(2000);
-    // filtered->set_high_cutoff_frequency(2000);
-
-    // Frequency cutoff for bessel_lowpass4
-    filtered->set_low_cutoff_frequency(600);
-    // Frequency cutoff for bessel_bandpass
-    filtered->set_mid_low_cutoff_frequency(600);
-    filtered->set_mid_high_cutoff_frequency(4000);
-    // Frequency cutoff for bessel_highpass4
-    filtered->set_high_cutoff_frequency(4000);
-
-    io::Waveform::Signal* low = filtered->mutable_low();
-    io::Waveform::Signal* mid = filtered->mutable_mid();
-    io::Waveform::Signal* high = filtered->mutable_high();
-
-    // TODO(vrince) set max/min for each signal
-    int numChannels = kNumChannels;
-    all->set_units(io::Waveform::RMS);
-    all->set_channels(numChannels);
-    low->set_units(io::Waveform::RMS);
-    low->set_channels(numChannels);
-    mid->set_units(io::Waveform::RMS);
-    mid->set_channels(numChannels);
-    high->set_units(io::Waveform::RMS);
-    high->set_channels(numChannels);
+    const int dataSize = getDataSize();
+    const int regionCount = (dataSize + kFlatRegionSize - 1) / kFlatRegionSize;
 
-    int dataSize = getDataSize();
-    for (int i = 0; i < dataSize; ++i) {
-        const WaveformData& datum = m_data.at(i);
-        all->add_value(datum.filtered.all);
-        low->add_value(datum.filtered.low);
-        mid->add_value(datum.filtered.mid);
-        high->add_value(datum.filtered.high);
+    // Regions are compressed independently and only if they become smaller
+    QVector<QByteArray> regions;
+    QVector<FlatRegionCodec> regionCodecs;
+    regions.reserve(regionCount);
+    regionCodecs.reserve(regionCount);
+    for (int region = 0; region < regionCount; ++region) {
+        const int begin = region * kFlatRegionSize;
+        const int count = math_min(kFlatRegionSize, dataSize - begin);
+        const QByteArray raw = QByteArray::fromRawData(
+                reinterpret_cast<const char*>(&m_data[begin]),
+                count * static_cast<int>(sizeof(WaveformData)));
+        QByteArray compressed = qCompress(raw, kFlatCompressionLevel);
+        if (compressed.size() < raw.size()) {
+            regions.append(compressed);
+            regionCodecs.append(FlatRegionCodec::Zlib);
+        } else {
+            // Deep copy, because raw only references m_data
+            regions.append(QByteArray(raw.constData(), raw.size()));
+            regionCodecs.append(FlatRegionCodec::None);
+        }
     }
 
-    qDebug() << "Writing waveform from byte array:"
+    QByteArray output;
+    QDataStream out(&output, QIODevice::WriteOnly);
+    out.setByteOrder(QDataStream::LittleEndian);
+    out.setFloatingPointPrecision(QDataStream::DoublePrecision);
+    out.writeRawData(kFlatMagic, sizeof(kFlatMagic));
+    out << kFlatVersion
+        << static_cast<quint32>(dataSize)
+        << static_cast<quint32>(kFlatRegionSize)
+        << static_cast<quint32>(regionCount)
+        << m_visualSampleRate
+        << m_audioVisualRatio;
+    for (int region = 0; region < regionCount; ++region) {
+        out << static_cast<quint32>(regionCodecs[region])
+            << static_cast<quint32>(regions[region].size());
+    }
+    for (const auto& region : qAsConst(regions)) {
+        out.writeRawData(region.constData(), region.size());
+    }
+
+    qDebug() << "Writing waveform to byte array:"
              << "dataSize" << dataSize
-             << "allSignalSize" << all->value_size()
-             << "visualSampleRate" << waveform.visual_sample_rate()
-             << "audioVisualRatio" << waveform.audio_visual_ratio();
+             << "regionCount" << regionCount
+             << "byteArraySize" << output.size()
+             << "visualSampleRate" << m_visualSampleRate
+             << "audioVisualRatio" << m_audioVisualRatio;
+    return output;
+}
 
-    std::string output;
-    waveform.SerializeToString(&output);
-    return QByteArray(output.data(), output.length());
+// static
+bool Waveform::isFlatByteArray(const QByteArray& data) {
+    return data.startsWith(QByteArray::fromRawData(kFlatMagic, sizeof(kFlatMagic)));
 }
 
 void Waveform::readByteArray(const QByteArray& data) {
@@ -131,12 +178,123 @@ void Waveform::readByteArray(const QByteArray& data) {
         return;
     }
 
+    bool success;
+    if (isFlatByteArray(data)) {
+        success = readFlatByteArray(data);
+    } else {
+        // Waveforms that have been stored by previous versions
+        success = readProtobufByteArray(data);
+    }
+    if (!success) {
+        resize(0);
+        m_saveState = SaveState::NotSaved;
+        return;
+    }
+    m_completion = getDataSize();
+    m_saveState = SaveState::Saved;
+    buildPyramid();
+}
+
+bool Waveform::readFlatByteArray(const QByteArray& data) {
+    QDataStream in(data);
+    in.setByteOrder(QDataStream::LittleEndian);
+    in.setFloatingPointPrecision(QDataStream::DoublePrecision);
+    in.skipRawData(sizeof(kFlatMagic));
+    quint32 version = 0;
+    quint32 dataSize = 0;
+    quint32 regionSize = 0;
+    quint32 regionCount = 0;
+    double visualSampleRate = 0;
+    double audioVisualRatio = 0;
+    in >> version
+       >> dataSize
+       >> regionSize
+       >> regionCount
+       >> visualSampleRate
+       >> audioVisualRatio;
+    if (in.status() != QDataStream::Ok || version != kFlatVersion) {
+        qDebug() << "ERROR: Unsupported waveform format version" << version;
+        return false;
+    }
+    if (regionSize == 0 ||
+            dataSize > static_cast<quint32>(std::numeric_limits<int>::max()) ||
+            regionCount != (dataSize + regionSize - 1) / regionSize) {
+        qDebug() << "ERROR: Invalid waveform header:"
+                 << "dataSize" << dataSize
+                 << "regionSize" << regionSize
+                 << "regionCount" << regionCount;
+        return false;
+    }
+
+    QVector<quint32> regionCodecs(regionCount);
+    QVector<quint32> regionBytes(regionCount);
+    for (quint32 region = 0; region < regionCount; ++region) {
+        in >> regionCodecs[region] >> regionBytes[region];
+    }
+    if (in.status() != QDataStream::Ok) {
+        qDebug() << "ERROR: Truncated waveform region table";
+        return false;
+    }
+
+    resize(dataSize);
+    m_visualSampleRate = visualSampleRate;
+    m_audioVisualRatio = audioVisualRatio;
+
+    // The payload of each region is copied or inflated directly into
+    // the texture buffer without parsing individual values
+    qint64 offset = in.device()->pos();
+    for (quint32 region = 0; region < regionCount; ++region) {
+        const quint32 begin = region * regionSize;
+        const int expectedBytes = static_cast<int>(
+                math_min(regionSize, dataSize - begin) * sizeof(WaveformData));
+        if (offset + regionBytes[region] > data.size()) {
+            qDebug() << "ERROR: Truncated waveform region" << region;
+            return false;
+        }
+        const char* const pRegionData = data.constData() + offset;
+        offset += regionBytes[region];
+        char* const pTarget = reinterpret_cast<char*>(&m_data[begin]);
+        switch (static_cast<FlatRegionCodec>(regionCodecs[region])) {
+        case FlatRegionCodec::None:
+            if (static_cast<int>(regionBytes[region]) != expectedBytes) {
+                qDebug() << "ERROR: Invalid size of waveform region" << region;
+                return false;
+            }
+            std::copy(pRegionData, pRegionData + expectedBytes, pTarget);
+            break;
+        case FlatRegionCodec::Zlib: {
+            const QByteArray inflated = qUncompress(
+                    reinterpret_cast<const uchar*>(pRegionData),
+                    static_cast<int>(regionBytes[region]));
+            if (inflated.size() != expectedBytes) {
+                qDebug() << "ERROR: Failed to decompress waveform region" << region;
+                return false;
+            }
+            std::copy(inflated.constBegin(), inflated.constEnd(), pTarget);
+            break;
+        }
+        default:
+            qDebug() << "ERROR: Unknown codec" << regionCodecs[region]
+                     << "of waveform region" << region;
+            return false;
+        }
+    }
+
+    qDebug() << "Reading waveform from byte array:"
+             << "dataSize" << dataSize
+             << "regionCount" << regionCount
+             << "visualSampleRate" << m_visualSampleRate
+             << "audioVisualRatio" << m_audioVisualRatio;
+    return true;
+}
+
+bool Waveform::readProtobufByteArray(const QByteArray& data) {
     io::Waveform waveform;
 
     if (!waveform.ParseFromArray(data.constData(), data.size())) {
         qDebug() << "ERROR: Could not parse Waveform from QByteArray of size "
                  << data.size();
-        return;
+        return false;
     }
 
     if (!waveform.has_visual_sample_rate() ||
@@ -147,7 +305,7 @@ void Waveform::readByteArray(const QByteArray& data) {
         !waveform.signal_filtered().has_mid() ||
         !waveform.signal_filtered().has_high()) {
         qDebug() << "ERROR: Waveform proto is missing key data. Skipping.";
-        return;
+        return false;
     }
 
     const io::Waveform::Signal& all = waveform.signal_all();
@@ -155,7 +313,7 @@ void Waveform::readByteArray(const QByteArray& data) {
     const io::Waveform::Signal& mid = waveform.signal_filtered().mid();
     const io::Waveform::Signal& high = waveform.signal_filtered().high();
 
-    qDebug() << "Reading waveform from byte array:"
+    qDebug() << "Reading waveform from protobuf byte array:"
              << "allSignalSize" << all.value_size()
              << "visualSampleRate" << waveform.visual_sample_rate()
              << "audioVisualRatio" << waveform.audio_visual_ratio();
@@ -166,9 +324,7 @@ void Waveform::readByteArray(const QByteArray& data) {
     if (all.value_size() != dataSize) {
         qDebug() << "ERROR: Couldn't resize Waveform to" << all.value_size()
                  << "while reading.";
-        resize(0);
-        m_saveState = SaveState::NotSaved;
-        return;
+        return false;
     }
 
     m_visualSampleRate = waveform.visual_sample_rate();
@@ -193,8 +349,7 @@ void Waveform::readByteArray(const QByteArray& data) {
         m_data[i].filtered.mid = use_mid ? static_cast<unsigned char>(mid.value(i)) : 0;
         m_data[i].filtered.high = use_high ? static_cast<unsigned char>(high.value(i)) : 0;
     }
-    m_completion = dataSize;
-    m_saveState = SaveState::Saved;
+    return true;
 }
 
 void Waveform::resize(int size) {
@@ -7,6 +7,7 @@
 #include <QByteArray>
 #include <QString>
 #include <QAtomicInt>
+#include <QAtomicPointer>
 #include <QSharedPointer>
 #include <QMutexLocker>
 
@@ -16,6 +17,8 @@
 enum FilterIndex { Low = 0, Mid = 1, High = 2, FilterCount = 3};
 enum ChannelIndex { Left = 0, Right = 1, ChannelCount = 2};
 
+class WaveformPyramid;
+
 union WaveformData {
     struct {
         unsigned char low;
@@ -73,8 +76,15 @@ class Waveform {
         m_description = description;
     }
 
+    // Serializes the waveform into a flat binary format that is stored
+    // in the analysis directory. Waveforms can also be restored from the
+    // legacy protobuf format that has been used before.
     QByteArray toByteArray() const;
 
+    // Checks if the data has been created by toByteArray(). The flat
+    // format is already compressed and must not be compressed again.
+    static bool isFlatByteArray(const QByteArray& data);
+
     // We do not lock the mutex since m_dataSize and m_visualSampleRate are not
     // changed after the constructor runs.
     bool isValid() const {
@@ -133,10 +143,23 @@ class Waveform {
     // constructor runs.
     const WaveformData* data() const { return &m_data[0];}
 
+    // Downsampled levels for rendering the waveform when zoomed out.
+    // Returns nullptr until buildPyramid() has been called.
+    const WaveformPyramid* pyramid() const {
+        return m_pPyramid.loadAcquire();
+    }
+
+    // Builds the pyramid from the complete data. Must only be called after
+    // the data has been finalized, i.e. after analysis or loading. Calling it
+    // again has no effect.
+    void buildPyramid();
+
     void dump() const;
 
   private:
     void readByteArray(const QByteArray& data);
+    bool readFlatByteArray(const QByteArray& data);
+    bool readProtobufByteArray(const QByteArray& data);
     void resize(int size);
     void assign(int size, int value = 0);
 
@@ -178,6 +201,9 @@ class Waveform {
     // the mutex. The completion of the waveform calculation.
     QAtomicInt m_completion;
 
+    // Published once by buildPyramid() and owned by the waveform
+    QAtomicPointer<const WaveformPyramid> m_pPyramid;
+
     mutable QMutex m_mutex;
 
     DISALLOW_COPY_AND_ASSIGN(Waveform);
@@ -0,0 +1,49 @@
+#include "waveform/waveformpyramid.h"
+
+#include "util/math.h"
+
+namespace {
+
+// Levels with fewer frames are not worth it
+constexpr int kMinLevelFrames = 64;
+
+inline WaveformData maxOf(const WaveformData& lhs, const WaveformData& rhs) {
+    WaveformData result;
+    result.filtered.low = math_max(lhs.filtered.low, rhs.filtered.low);
+    result.filtered.mid = math_max(lhs.filtered.mid, rhs.filtered.mid);
+    result.filtered.high = math_max(lhs.filtered.high, rhs.filtered.high);
+    result.filtered.all = math_max(lhs.filtered.all, rhs.filtered.all);
+    return result;
+}
+
+} // anonymous namespace
+
+WaveformPyramid::WaveformPyramid(const WaveformData* pData, int dataSize) {
+    const WaveformData* pSource = pData;
+    int sourceFrames = dataSize / 2;
+    while (sourceFrames / 2 >= kMinLevelFrames) {
+        // A trailing odd frame is combined with itself
+        const int frames = (sourceFrames + 1) / 2;
+        std::vector<WaveformData> level(frames * 2);
+        for (int frame = 0; frame < frames; ++frame) {
+            const int first = 2 * frame;
+            const int second = math_min(first + 1, sourceFrames - 1);
+            // left
+            level[2 * frame] = maxOf(pSource[2 * first], pSource[2 * second]);
+            // right
+            level[2 * frame + 1] = maxOf(pSource[2 * first + 1], pSource[2 * second + 1]);
+        }
+        m_levels.push_back(std::move(level));
+        pSource = m_levels.back().data();
+        sourceFrames = frames;
+    }
+}
+
+int WaveformPyramid::findLevel(double visualFramesPerPixel) const {
+    int level = -1;
+    while (level + 1 < levelCount() &&
+            framesPerLevelFrame(level + 1) <= visualFramesPerPixel) {
+        ++level;
+    }
+    return level;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+
+#include "waveform/waveform.h"
+
+// Successively downsampled copies of the interleaved stereo data of a
+// waveform. Each level has half the resolution of the previous level,
+// starting with 2 visual frames per frame. Every element contains the
+// maximum of each band of the elements that it covers.
+//
+// Renderers pick the coarsest level that still provides at least one
+// frame per pixel instead of reducing hundreds of visual frames for
+// each pixel on every frame when zoomed out. The per-band maxima are
+// exact, the total amplitude that is calculated from the band maxima
+// is an upper bound that matches the peaks of the full resolution data
+// closely.
+//
+// Immutable after construction.
+class WaveformPyramid {
+  public:
+    WaveformPyramid(const WaveformData* pData, int dataSize);
+
+    int levelCount() const {
+        return static_cast<int>(m_levels.size());
+    }
+
+    // The number of visual frames of the full resolution waveform that
+    // are covered by each frame of the given level.
+    static int framesPerLevelFrame(int level) {
+        return 2 << level;
+    }
+
+    const WaveformData* levelData(int level) const {
+        return m_levels[level].data();
+    }
+
+    // The number of elements of the level, i.e. twice the number of frames
+    int levelDataSize(int level) const {
+        return static_cast<int>(m_levels[level].size());
+    }
+
+    // Returns the coarsest level that covers at most the given number of
+    // visual frames per frame or -1 if the full resolution data should
+    // be used.
+    int findLevel(double visualFramesPerPixel) const;
+
+  private:
+    std::vector<std::vector<WaveformData>> m_levels;
+};
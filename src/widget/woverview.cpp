@@ -247,7 +247,7 @@ void WOverview::slotWaveformSummaryUpdated() {
         // If the waveform is already complete, just draw it.
         if (m_pWaveform->getCompletion() == m_pWaveform->getDataSize()) {
             m_actualCompletion = 0;
-            if (drawNextPixmapPart()) {
+            if (!drawNextWaveformPart().isEmpty()) {
                 update();
             }
         }
@@ -263,16 +263,129 @@ void WOverview::slotWaveformSummaryUpdated() {
     }
 }
 
+void WOverview::slotWaveformSummaryAnalyzed(int dataBegin, int dataEnd) {
+    Q_UNUSED(dataBegin);
+    // The notification is queued from the analyzer thread and may arrive
+    // after the columns have already been drawn on a progress update
+    if (dataEnd <= m_actualCompletion) {
+        return;
+    }
+    const QRect dirtyRect = drawNextWaveformPart();
+    if (!dirtyRect.isEmpty()) {
+        update(dirtyRect);
+    }
+}
+
 void WOverview::onTrackAnalyzerProgress(TrackId trackId, AnalyzerProgress analyzerProgress) {
     if (!m_pCurrentTrack || (m_pCurrentTrack->getId() != trackId)) {
         return;
     }
 
-    bool updateNeeded = drawNextPixmapPart();
-    if (updateNeeded || (m_analyzerProgress != analyzerProgress)) {
+    QRect dirtyRect = drawNextWaveformPart();
+    if (m_analyzerProgress != analyzerProgress) {
+        dirtyRect |= analyzerProgressRect(m_analyzerProgress, analyzerProgress);
         m_analyzerProgress = analyzerProgress;
-        update();
     }
+    if (!dirtyRect.isEmpty()) {
+        update(dirtyRect);
+    }
+}
+
+QRect WOverview::drawNextWaveformPart() {
+    const int previousCompletion = m_actualCompletion;
+    if (!drawNextPixmapPart()) {
+        return QRect();
+    }
+    // A complete waveform may be normalized with a different gain, which
+    // requires to rescale the whole image in drawWaveformPixmap()
+    if (previousCompletion == 0 || m_pixmapDone || m_waveformImageScaled.isNull()) {
+        m_waveformImageScaled = QImage();
+        return rect();
+    }
+
+    // Each column of the source image holds two visual samples. Rescale
+    // all columns of the scaled image that are affected by the new ones.
+    const int sourceWidth = m_waveformSourceImage.width();
+    const int scaledLength = m_orientation == Qt::Horizontal
+            ? m_waveformImageScaled.width()
+            : m_waveformImageScaled.height();
+    const int scaledBegin = previousCompletion / 2 * scaledLength / sourceWidth;
+    const int scaledEnd = math_min(scaledLength,
+            (m_actualCompletion / 2 * scaledLength + sourceWidth - 1) / sourceWidth);
+    if (scaledBegin >= scaledEnd) {
+        return QRect();
+    }
+    const int sourceBegin = scaledBegin * sourceWidth / scaledLength;
+    const int sourceEnd = math_min(sourceWidth,
+            (scaledEnd * sourceWidth + scaledLength - 1) / scaledLength);
+    const QImage scaledPart = scaleWaveformImage(
+            sourceBegin, sourceEnd, scaledEnd - scaledBegin);
+
+    QPainter painter(&m_waveformImageScaled);
+    // Replace the columns that have been partially drawn before
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    if (m_orientation == Qt::Horizontal) {
+        painter.drawImage(scaledBegin, 0, scaledPart);
+    } else {
+        painter.drawImage(0, scaledBegin, scaledPart);
+    }
+
+    return lengthRect(
+            static_cast<int>(scaledBegin / m_devicePixelRatio),
+            static_cast<int>(std::ceil(scaledEnd / m_devicePixelRatio)));
+}
+
+QImage WOverview::scaleWaveformImage(
+        int sourceBegin, int sourceEnd, int scaledLength) const {
+    QRect sourceRect(sourceBegin,
+            m_diffGain,
+            sourceEnd - sourceBegin,
+            m_waveformSourceImage.height() - 2 * m_diffGain);
+    QImage croppedImage = m_waveformSourceImage.copy(sourceRect);
+    QSize scaledSize = size() * m_devicePixelRatio;
+    if (m_orientation == Qt::Vertical) {
+        // Rotate pixmap
+        croppedImage = croppedImage.transformed(QTransform(0, 1, 1, 0, 0, 0));
+        scaledSize.setHeight(scaledLength);
+    } else {
+        scaledSize.setWidth(scaledLength);
+    }
+    return croppedImage.scaled(scaledSize,
+            Qt::IgnoreAspectRatio,
+            Qt::SmoothTransformation);
+}
+
+QRect WOverview::lengthRect(int begin, int end) const {
+    if (m_orientation == Qt::Horizontal) {
+        return QRect(begin, 0, end - begin, height());
+    } else {
+        return QRect(0, begin, width(), end - begin);
+    }
+}
+
+QRect WOverview::analyzerProgressRect(
+        AnalyzerProgress oldProgress, AnalyzerProgress newProgress) const {
+    // See drawAnalyzerProgress() for what is drawn in which state
+    const auto textState = [](AnalyzerProgress progress) {
+        if (progress < kAnalyzerProgressNone || progress >= kAnalyzerProgressDone) {
+            return 0;
+        } else if (progress <= kAnalyzerProgressHalf) {
+            return 1;
+        } else if (progress >= kAnalyzerProgressFinalizing) {
+            return 2;
+        }
+        return 3;
+    };
+    if (textState(oldProgress) != textState(newProgress) ||
+            oldProgress <= kAnalyzerProgressNone ||
+            newProgress <= kAnalyzerProgressNone) {
+        return rect();
+    }
+    // Only the start of the progress line has moved
+    const int margin = static_cast<int>(std::ceil(2 * m_scaleFactor));
+    const int begin = static_cast<int>(length() * math_min(oldProgress, newProgress));
+    const int end = static_cast<int>(std::ceil(length() * math_max(oldProgress, newProgress)));
+    return lengthRect(begin - margin, end + margin);
 }
 
 void WOverview::slotTrackLoaded(TrackPointer pTrack) {
@@ -292,6 +405,8 @@ void WOverview::slotLoadingTrack(TrackPointer pNewTrack, TrackPointer pOldTrack)
     if (m_pCurrentTrack != nullptr) {
         disconnect(m_pCurrentTrack.get(), SIGNAL(waveformSummaryUpdated()),
                    this, SLOT(slotWaveformSummaryUpdated()));
+        disconnect(m_pCurrentTrack.get(), &Track::waveformSummaryAnalyzed,
+                this, &WOverview::slotWaveformSummaryAnalyzed);
     }
 
     m_waveformSourceImage = QImage();
@@ -308,6 +423,8 @@ void WOverview::slotLoadingTrack(TrackPointer pNewTrack, TrackPointer pOldTrack)
 
         connect(pNewTrack.get(), SIGNAL(waveformSummaryUpdated()),
                 this, SLOT(slotWaveformSummaryUpdated()));
+        connect(pNewTrack.get(), &Track::waveformSummaryAnalyzed,
+                this, &WOverview::slotWaveformSummaryAnalyzed);
         slotWaveformSummaryUpdated();
         connect(pNewTrack.get(), SIGNAL(cuesUpdated()),
                 this, SLOT(receiveCuesUpdated()));
@@ -596,16 +713,10 @@ void WOverview::drawWaveformPixmap(QPainter* pPainter) {
         }
 
         if (m_diffGain != diffGain || m_waveformImageScaled.isNull()) {
-            QRect sourceRect(0, diffGain, m_waveformSourceImage.width(), m_waveformSourceImage.height() - 2 * diffGain);
-            QImage croppedImage = m_waveformSourceImage.copy(sourceRect);
-            if (m_orientation == Qt::Vertical) {
-                // Rotate pixmap
-                croppedImage = croppedImage.transformed(QTransform(0, 1, 1, 0, 0, 0));
-            }
-            m_waveformImageScaled = croppedImage.scaled(size() * m_devicePixelRatio,
-                    Qt::IgnoreAspectRatio,
-                    Qt::SmoothTransformation);
             m_diffGain = diffGain;
+            m_waveformImageScaled = scaleWaveformImage(0,
+                    m_waveformSourceImage.width(),
+                    qRound(length() * m_devicePixelRatio));
         }
 
         pPainter->drawImage(rect(), m_waveformImageScaled);
@@ -101,12 +101,23 @@ class WOverview : public WWidget, public TrackDropTarget {
     void receiveCuesUpdated();
 
     void slotWaveformSummaryUpdated();
+    void slotWaveformSummaryAnalyzed(int dataBegin, int dataEnd);
     void slotCueMenuPopupAboutToHide();
 
   private:
     // Append the waveform overview pixmap according to available data
     // in waveform
     virtual bool drawNextPixmapPart() = 0;
+    // Calls drawNextPixmapPart() and rescales only the newly drawn columns
+    // into m_waveformImageScaled. Returns the area of the widget that needs
+    // to be repainted, which is empty if nothing has been drawn.
+    QRect drawNextWaveformPart();
+    QImage scaleWaveformImage(int sourceBegin, int sourceEnd, int scaledLength) const;
+    // The area of the widget between the positions begin and end along the
+    // track, e.g. the columns of a horizontal overview
+    QRect lengthRect(int begin, int end) const;
+    QRect analyzerProgressRect(AnalyzerProgress oldProgress,
+            AnalyzerProgress newProgress) const;
     void drawEndOfTrackBackground(QPainter* pPainter);
     void drawAxis(QPainter* pPainter);
     void drawWaveformPixmap(QPainter* pPainter);